@@ -1,42 +1,53 @@
 #include <stdio.h>
-#include <stdarg.h>
 #include <stdlib.h>
-#include <string.h>
-#include <sys/malloc.h>
-#include <errno.h>
-#include <ctype.h>
-#include <sys/types.h>
-#include <sys/stat.h>
-#include <fcntl.h>
-#include <time.h>
 #include <math.h>
 
+//
+// Writes the pitch tables used by params.c:
+// the 1V/oct CV and PITCH pot curves (in octaves), and a table of 2^x for 0 <= x <= 1 to interpolate
+//
 
-#ifdef T_MSVC
-#include <float.h>
-#define NAN nan_global
-#endif
+#define ADCVALS_PER_OCTAVE 408
+#define CENTER_ADC 2048
 
-#include <sys/ioctl.h>
-#include <sys/times.h>
+//2^(i/EXP2_LUT_SIZE) is interpolated linearly: max error is about (ln2)^2/8 / EXP2_LUT_SIZE^2 (0.002 cents with 256)
+#define EXP2_LUT_BITS 8
+#define EXP2_LUT_SIZE (1<<EXP2_LUT_BITS)
+
+//PITCH pot: 4 octaves down on the left, 2 octaves up on the right, with a plateau at 1.0 in the center
+//and one semitone on each side of it spread over a wider range, so the center is easy to find
+#define NUM_PITCH_POT_POINTS 6
+static const int pitch_pot_adc[NUM_PITCH_POT_POINTS] 		= {0, 		1850, 			1920, 	2175, 	2275, 			4095};
+static const double pitch_pot_oct[NUM_PITCH_POT_POINTS] 	= {-4.0, 	-1.0/12.0, 		0.0, 	0.0, 	1.0/12.0, 		2.0};
 
-#define ADCVALS_PER_OCTAVE 408.0
-#define CENTER_ADC 2048
 int main(void){
 	int i;
-	double v;
-	double pitch_per_adcval;
 
-	pitch_per_adcval = pow(2.0, 1.0/ADCVALS_PER_OCTAVE);
+	printf("//\n// pitch_lut.h: generated by calcs/voltoct\n//\n\n");
+	printf("#pragma once\n\n");
 
-	printf ("const float voltoct[4096]={\n");
+	printf("//1V/oct CV: octaves = (VOLTOCT_CENTER_ADC - adc) / VOLTOCT_ADC_PER_OCTAVE\n");
+	printf("#define VOLTOCT_ADC_PER_OCTAVE %d\n", ADCVALS_PER_OCTAVE);
+	printf("#define VOLTOCT_CENTER_ADC %d\n\n", CENTER_ADC);
 
-	for (i=0;i<4096;i++)
-	{
-		v = pow(pitch_per_adcval, (CENTER_ADC - i));
+	printf("//PITCH pot: octaves at each point, linear in between\n");
+	printf("#define NUM_PITCH_POT_POINTS %d\n", NUM_PITCH_POT_POINTS);
+	printf("const uint16_t pitch_pot_adc[NUM_PITCH_POT_POINTS] = {");
+	for (i=0;i<NUM_PITCH_POT_POINTS;i++)
+		printf("%d%s", pitch_pot_adc[i], (i!=NUM_PITCH_POT_POINTS-1) ? ", " : "};\n");
+	printf("const float pitch_pot_oct[NUM_PITCH_POT_POINTS] = {");
+	for (i=0;i<NUM_PITCH_POT_POINTS;i++)
+		printf("%.9g%s", pitch_pot_oct[i], (i!=NUM_PITCH_POT_POINTS-1) ? ", " : "};\n\n");
+
+	printf("//2^(i/EXP2_LUT_SIZE)\n");
+	printf("#define EXP2_LUT_BITS %d\n", EXP2_LUT_BITS);
+	printf("#define EXP2_LUT_SIZE (1<<EXP2_LUT_BITS)\n");
+	printf("const float exp2_lut[EXP2_LUT_SIZE+1]={\n");
 
-		printf("%.16g",v);
-		if (i!=4095) 	printf(",");
+	for (i=0;i<=EXP2_LUT_SIZE;i++)
+	{
+		printf("%.9g", pow(2.0, (double)i / EXP2_LUT_SIZE));
+		if (i!=EXP2_LUT_SIZE) 	printf(",");
 		printf("\t//%d\n",i);
 	}
 	printf ("};\n");
@@ -0,0 +1,277 @@
+//
+// pitch_lut.h: generated by calcs/voltoct
+//
+
+#pragma once
+
+//1V/oct CV: octaves = (VOLTOCT_CENTER_ADC - adc) / VOLTOCT_ADC_PER_OCTAVE
+#define VOLTOCT_ADC_PER_OCTAVE 408
+#define VOLTOCT_CENTER_ADC 2048
+
+//PITCH pot: octaves at each point, linear in between
+#define NUM_PITCH_POT_POINTS 6
+const uint16_t pitch_pot_adc[NUM_PITCH_POT_POINTS] = {0, 1850, 1920, 2175, 2275, 4095};
+const float pitch_pot_oct[NUM_PITCH_POT_POINTS] = {-4, -0.0833333333, 0, 0, 0.0833333333, 2};
+
+//2^(i/EXP2_LUT_SIZE)
+#define EXP2_LUT_BITS 8
+#define EXP2_LUT_SIZE (1<<EXP2_LUT_BITS)
+const float exp2_lut[EXP2_LUT_SIZE+1]={
+1,	//0
+1.00271128,	//1
+1.0054299,	//2
+1.0081559,	//3
+1.01088929,	//4
+1.01363008,	//5
+1.01637831,	//6
+1.019134,	//7
+1.02189715,	//8
+1.02466779,	//9
+1.02744595,	//10
+1.03023164,	//11
+1.03302488,	//12
+1.03582569,	//13
+1.0386341,	//14
+1.04145012,	//15
+1.04427378,	//16
+1.0471051,	//17
+1.04994409,	//18
+1.05279077,	//19
+1.05564518,	//20
+1.05850732,	//21
+1.06137723,	//22
+1.06425491,	//23
+1.0671404,	//24
+1.07003371,	//25
+1.07293487,	//26
+1.07584389,	//27
+1.0787608,	//28
+1.08168561,	//29
+1.08461836,	//30
+1.08755906,	//31
+1.09050773,	//32
+1.0934644,	//33
+1.09642908,	//34
+1.0994018,	//35
+1.10238258,	//36
+1.10537145,	//37
+1.10836841,	//38
+1.1113735,	//39
+1.11438674,	//40
+1.11740815,	//41
+1.12043775,	//42
+1.12347557,	//43
+1.12652162,	//44
+1.12957593,	//45
+1.13263852,	//46
+1.13570941,	//47
+1.13878863,	//48
+1.1418762,	//49
+1.14497214,	//50
+1.14807648,	//51
+1.15118923,	//52
+1.15431042,	//53
+1.15744007,	//54
+1.16057821,	//55
+1.16372486,	//56
+1.16688004,	//57
+1.17004377,	//58
+1.17321608,	//59
+1.17639699,	//60
+1.17958653,	//61
+1.18278471,	//62
+1.18599157,	//63
+1.18920712,	//64
+1.19243138,	//65
+1.19566439,	//66
+1.19890617,	//67
+1.20215673,	//68
+1.20541611,	//69
+1.20868432,	//70
+1.2119614,	//71
+1.21524736,	//72
+1.21854223,	//73
+1.22184603,	//74
+1.22515879,	//75
+1.22848054,	//76
+1.23181128,	//77
+1.23515106,	//78
+1.2384999,	//79
+1.24185781,	//80
+1.24522483,	//81
+1.24860098,	//82
+1.25198628,	//83
+1.25538076,	//84
+1.25878444,	//85
+1.26219735,	//86
+1.26561951,	//87
+1.26905096,	//88
+1.2724917,	//89
+1.27594178,	//90
+1.27940121,	//91
+1.28287002,	//92
+1.28634823,	//93
+1.28983587,	//94
+1.29333297,	//95
+1.29683955,	//96
+1.30035564,	//97
+1.30388127,	//98
+1.30741645,	//99
+1.31096121,	//100
+1.31451559,	//101
+1.3180796,	//102
+1.32165328,	//103
+1.32523664,	//104
+1.32882972,	//105
+1.33243255,	//106
+1.33604514,	//107
+1.33966752,	//108
+1.34329973,	//109
+1.34694179,	//110
+1.35059372,	//111
+1.35425555,	//112
+1.35792731,	//113
+1.36160902,	//114
+1.36530072,	//115
+1.36900242,	//116
+1.37271417,	//117
+1.37643597,	//118
+1.38016787,	//119
+1.38390988,	//120
+1.38766204,	//121
+1.39142438,	//122
+1.39519691,	//123
+1.39897967,	//124
+1.40277269,	//125
+1.40657599,	//126
+1.41038961,	//127
+1.41421356,	//128
+1.41804788,	//129
+1.4218926,	//130
+1.42574774,	//131
+1.42961334,	//132
+1.43348941,	//133
+1.437376,	//134
+1.44127312,	//135
+1.44518081,	//136
+1.44909909,	//137
+1.453028,	//138
+1.45696755,	//139
+1.46091779,	//140
+1.46487874,	//141
+1.46885043,	//142
+1.47283289,	//143
+1.47682615,	//144
+1.48083023,	//145
+1.48484517,	//146
+1.48887099,	//147
+1.49290773,	//148
+1.49695541,	//149
+1.50101407,	//150
+1.50508373,	//151
+1.50916443,	//152
+1.51325619,	//153
+1.51735904,	//154
+1.52147302,	//155
+1.52559815,	//156
+1.52973447,	//157
+1.533882,	//158
+1.53804077,	//159
+1.54221083,	//160
+1.54639218,	//161
+1.55058488,	//162
+1.55478894,	//163
+1.5590044,	//164
+1.56323129,	//165
+1.56746964,	//166
+1.57171948,	//167
+1.57598085,	//168
+1.58025376,	//169
+1.58453827,	//170
+1.58883438,	//171
+1.59314215,	//172
+1.5974616,	//173
+1.60179276,	//174
+1.60613566,	//175
+1.61049033,	//176
+1.61485681,	//177
+1.61923514,	//178
+1.62362533,	//179
+1.62802742,	//180
+1.63244145,	//181
+1.63686745,	//182
+1.64130545,	//183
+1.64575548,	//184
+1.65021757,	//185
+1.65469177,	//186
+1.65917809,	//187
+1.66367658,	//188
+1.66818727,	//189
+1.67271018,	//190
+1.67724536,	//191
+1.68179283,	//192
+1.68635263,	//193
+1.6909248,	//194
+1.69550936,	//195
+1.70010635,	//196
+1.70471581,	//197
+1.70933776,	//198
+1.71397225,	//199
+1.7186193,	//200
+1.72327895,	//201
+1.72795123,	//202
+1.73263618,	//203
+1.73733384,	//204
+1.74204423,	//205
+1.74676739,	//206
+1.75150335,	//207
+1.75625216,	//208
+1.76101384,	//209
+1.76578844,	//210
+1.77057597,	//211
+1.77537649,	//212
+1.78019003,	//213
+1.78501661,	//214
+1.78985628,	//215
+1.79470908,	//216
+1.79957502,	//217
+1.80445417,	//218
+1.80934654,	//219
+1.81425218,	//220
+1.81917111,	//221
+1.82410339,	//222
+1.82904903,	//223
+1.83400809,	//224
+1.83898059,	//225
+1.84396657,	//226
+1.84896607,	//227
+1.85397913,	//228
+1.85900577,	//229
+1.86404605,	//230
+1.86909999,	//231
+1.87416763,	//232
+1.87924902,	//233
+1.88434418,	//234
+1.88945315,	//235
+1.89457598,	//236
+1.8997127,	//237
+1.90486334,	//238
+1.91002795,	//239
+1.91520656,	//240
+1.92039921,	//241
+1.92560594,	//242
+1.93082679,	//243
+1.93606179,	//244
+1.94131099,	//245
+1.94657442,	//246
+1.95185212,	//247
+1.95714412,	//248
+1.96245048,	//249
+1.96777122,	//250
+1.97310639,	//251
+1.97845603,	//252
+1.98382016,	//253
+1.98919885,	//254
+1.99459211,	//255
+2	//256
+};
@@ -1,4098 +0,0 @@
-const float voltoct[4096]={
-32.43788481032838,	//0
-32.38282319245161,	//1
-32.3278550387998,	//2
-32.27298019072231,	//3
-32.21819848983779,	//4
-32.16350977803373,	//5
-32.10891389746602,	//6
-32.05441069055848,	//7
-32.0000000000024,	//8
-31.9456816687561,	//9
-31.89145554004447,	//10
-31.83732145735851,	//11
-31.7832792644549,	//12
-31.72932880535552,	//13
-31.67546992434702,	//14
-31.62170246598037,	//15
-31.56802627507041,	//16
-31.51444119669538,	//17
-31.4609470761965,	//18
-31.40754375917753,	//19
-31.3542310915043,	//20
-31.30100891930426,	//21
-31.24787708896607,	//22
-31.19483544713914,	//23
-31.14188384073315,	//24
-31.0890221169177,	//25
-31.03625012312176,	//26
-30.9835677070333,	//27
-30.93097471659884,	//28
-30.878471000023,	//29
-30.82605640576805,	//30
-30.77373078255351,	//31
-30.72149397935566,	//32
-30.66934584540717,	//33
-30.6172862301966,	//34
-30.56531498346803,	//35
-30.51343195522055,	//36
-30.4616369957079,	//37
-30.40992995543798,	//38
-30.35831068517248,	//39
-30.30677903592638,	//40
-30.25533485896758,	//41
-30.20397800581642,	//42
-30.1527083282453,	//43
-30.10152567827822,	//44
-30.05042990819036,	//45
-29.99942087050765,	//46
-29.94849841800636,	//47
-29.89766240371266,	//48
-29.8469126809022,	//49
-29.79624910309969,	//50
-29.74567152407846,	//51
-29.69517979786007,	//52
-29.64477377871387,	//53
-29.59445332115657,	//54
-29.54421827995183,	//55
-29.49406851010985,	//56
-29.44400386688694,	//57
-29.39402420578511,	//58
-29.34412938255162,	//59
-29.29431925317864,	//60
-29.24459367390273,	//61
-29.19495250120454,	//62
-29.14539559180828,	//63
-29.0959228026814,	//64
-29.04653399103413,	//65
-28.99722901431907,	//66
-28.94800773023081,	//67
-28.89886999670546,	//68
-28.84981567192032,	//69
-28.80084461429338,	//70
-28.751956682483,	//71
-28.70315173538743,	//72
-28.65442963214445,	//73
-28.60579023213093,	//74
-28.55723339496247,	//75
-28.50875898049292,	//76
-28.46036684881408,	//77
-28.41205686025517,	//78
-28.36382887538255,	//79
-28.31568275499923,	//80
-28.26761836014451,	//81
-28.21963555209356,	//82
-28.17173419235705,	//83
-28.12391414268071,	//84
-28.07617526504494,	//85
-28.02851742166445,	//86
-27.98094047498781,	//87
-27.93344428769708,	//88
-27.88602872270742,	//89
-27.83869364316668,	//90
-27.79143891245501,	//91
-27.74426439418444,	//92
-27.69716995219857,	//93
-27.65015545057205,	//94
-27.60322075361031,	//95
-27.55636572584909,	//96
-27.50959023205406,	//97
-27.46289413722048,	//98
-27.41627730657275,	//99
-27.36973960556404,	//100
-27.32328089987592,	//101
-27.27690105541795,	//102
-27.23059993832731,	//103
-27.18437741496839,	//104
-27.13823335193243,	//105
-27.09216761603713,	//106
-27.04618007432626,	//107
-27.00027059406925,	//108
-26.95443904276087,	//109
-26.90868528812078,	//110
-26.86300919809321,	//111
-26.81741064084651,	//112
-26.77188948477284,	//113
-26.72644559848774,	//114
-26.68107885082978,	//115
-26.63578911086016,	//116
-26.59057624786234,	//117
-26.54544013134168,	//118
-26.50038063102502,	//119
-26.45539761686037,	//120
-26.41049095901646,	//121
-26.36566052788243,	//122
-26.3209061940674,	//123
-26.27622782840015,	//124
-26.23162530192871,	//125
-26.18709848591999,	//126
-26.14264725185944,	//127
-26.09827147145064,	//128
-26.05397101661496,	//129
-26.00974575949115,	//130
-25.96559557243503,	//131
-25.92152032801906,	//132
-25.87751989903203,	//133
-25.83359415847865,	//134
-25.7897429795792,	//135
-25.74596623576915,	//136
-25.70226380069882,	//137
-25.65863554823301,	//138
-25.6150813524506,	//139
-25.57160108764425,	//140
-25.52819462831998,	//141
-25.48486184919682,	//142
-25.44160262520649,	//143
-25.39841683149297,	//144
-25.3553043434122,	//145
-25.3122650365317,	//146
-25.26929878663019,	//147
-25.22640546969726,	//148
-25.183584961933,	//149
-25.14083713974764,	//150
-25.0981618797612,	//151
-25.05555905880314,	//152
-25.01302855391198,	//153
-24.97057024233496,	//154
-24.92818400152771,	//155
-24.88586970915385,	//156
-24.84362724308466,	//157
-24.80145648139875,	//158
-24.75935730238165,	//159
-24.71732958452552,	//160
-24.67537320652876,	//161
-24.6334880472957,	//162
-24.59167398593618,	//163
-24.54993090176527,	//164
-24.5082586743029,	//165
-24.46665718327351,	//166
-24.42512630860568,	//167
-24.38366593043182,	//168
-24.34227592908781,	//169
-24.30095618511266,	//170
-24.25970657924814,	//171
-24.21852699243847,	//172
-24.17741730582995,	//173
-24.13637740077063,	//174
-24.09540715880999,	//175
-24.05450646169853,	//176
-24.01367519138751,	//177
-23.97291323002855,	//178
-23.93222045997332,	//179
-23.89159676377319,	//180
-23.85104202417889,	//181
-23.81055612414018,	//182
-23.77013894680551,	//183
-23.72979037552167,	//184
-23.68951029383345,	//185
-23.64929858548336,	//186
-23.60915513441121,	//187
-23.56907982475383,	//188
-23.52907254084473,	//189
-23.48913316721374,	//190
-23.4492615885867,	//191
-23.40945768988514,	//192
-23.36972135622592,	//193
-23.33005247292088,	//194
-23.29045092547658,	//195
-23.25091659959391,	//196
-23.21144938116776,	//197
-23.17204915628673,	//198
-23.13271581123278,	//199
-23.09344923248087,	//200
-23.0542493066987,	//201
-23.01511592074633,	//202
-22.97604896167586,	//203
-22.93704831673113,	//204
-22.89811387334737,	//205
-22.85924551915087,	//206
-22.82044314195869,	//207
-22.78170662977831,	//208
-22.74303587080731,	//209
-22.70443075343303,	//210
-22.6658911662323,	//211
-22.62741699797105,	//212
-22.58900813760405,	//213
-22.55066447427457,	//214
-22.51238589731401,	//215
-22.47417229624168,	//216
-22.43602356076438,	//217
-22.39793958077615,	//218
-22.35992024635793,	//219
-22.32196544777723,	//220
-22.28407507548783,	//221
-22.24624902012946,	//222
-22.2084871725275,	//223
-22.17078942369261,	//224
-22.13315566482049,	//225
-22.0955857872915,	//226
-22.0580796826704,	//227
-22.02063724270602,	//228
-21.9832583593309,	//229
-21.94594292466105,	//230
-21.90869083099561,	//231
-21.87150197081653,	//232
-21.83437623678825,	//233
-21.79731352175744,	//234
-21.76031371875262,	//235
-21.72337672098392,	//236
-21.68650242184271,	//237
-21.64969071490136,	//238
-21.61294149391287,	//239
-21.57625465281058,	//240
-21.5396300857079,	//241
-21.50306768689796,	//242
-21.46656735085332,	//243
-21.43012897222568,	//244
-21.39375244584555,	//245
-21.35743766672196,	//246
-21.32118453004218,	//247
-21.28499293117136,	//248
-21.24886276565228,	//249
-21.21279392920504,	//250
-21.17678631772673,	//251
-21.14083982729116,	//252
-21.10495435414855,	//253
-21.06912979472521,	//254
-21.03336604562331,	//255
-20.99766300362047,	//256
-20.96202056566957,	//257
-20.9264386288984,	//258
-20.89091709060934,	//259
-20.85545584827913,	//260
-20.82005479955853,	//261
-20.78471384227202,	//262
-20.74943287441751,	//263
-20.7142117941661,	//264
-20.67905049986168,	//265
-20.64394889002073,	//266
-20.60890686333199,	//267
-20.57392431865616,	//268
-20.53900115502563,	//269
-20.50413727164417,	//270
-20.46933256788665,	//271
-20.43458694329874,	//272
-20.39990029759664,	//273
-20.36527253066675,	//274
-20.33070354256545,	//275
-20.29619323351872,	//276
-20.26174150392194,	//277
-20.22734825433954,	//278
-20.19301338550474,	//279
-20.15873679831928,	//280
-20.12451839385309,	//281
-20.09035807334405,	//282
-20.05625573819766,	//283
-20.02221128998679,	//284
-19.98822463045138,	//285
-19.95429566149819,	//286
-19.92042428520045,	//287
-19.88661040379763,	//288
-19.85285391969514,	//289
-19.81915473546407,	//290
-19.78551275384087,	//291
-19.75192787772709,	//292
-19.71840001018911,	//293
-19.68492905445785,	//294
-19.65151491392848,	//295
-19.61815749216015,	//296
-19.58485669287574,	//297
-19.55161241996153,	//298
-19.51842457746695,	//299
-19.4852930696043,	//300
-19.45221780074849,	//301
-19.41919867543674,	//302
-19.3862355983683,	//303
-19.35332847440421,	//304
-19.32047720856699,	//305
-19.28768170604038,	//306
-19.25494187216908,	//307
-19.22225761245843,	//308
-19.18962883257421,	//309
-19.15705543834229,	//310
-19.12453733574844,	//311
-19.09207443093796,	//312
-19.0596666302155,	//313
-19.02731384004475,	//314
-18.99501596704816,	//315
-18.9627729180067,	//316
-18.93058459985956,	//317
-18.8984509197039,	//318
-18.86637178479457,	//319
-18.83434710254388,	//320
-18.80237678052126,	//321
-18.77046072645308,	//322
-18.7385988482223,	//323
-18.70679105386826,	//324
-18.67503725158641,	//325
-18.64333734972801,	//326
-18.61169125679992,	//327
-18.58009888146428,	//328
-18.54856013253827,	//329
-18.51707491899386,	//330
-18.48564314995754,	//331
-18.45426473471003,	//332
-18.42293958268607,	//333
-18.3916676034741,	//334
-18.36044870681607,	//335
-18.32928280260708,	//336
-18.29816980089524,	//337
-18.2671096118813,	//338
-18.23610214591847,	//339
-18.20514731351212,	//340
-18.17424502531953,	//341
-18.14339519214963,	//342
-18.11259772496277,	//343
-18.08185253487041,	//344
-18.05115953313492,	//345
-18.02051863116927,	//346
-17.98992974053684,	//347
-17.95939277295109,	//348
-17.92890764027536,	//349
-17.89847425452258,	//350
-17.86809252785507,	//351
-17.83776237258421,	//352
-17.80748370117025,	//353
-17.77725642622203,	//354
-17.74708046049672,	//355
-17.7169557168996,	//356
-17.68688210848377,	//357
-17.65685954844993,	//358
-17.62688795014612,	//359
-17.59696722706745,	//360
-17.56709729285589,	//361
-17.53727806129997,	//362
-17.50750944633459,	//363
-17.47779136204073,	//364
-17.4481237226452,	//365
-17.41850644252042,	//366
-17.38893943618415,	//367
-17.35942261829927,	//368
-17.32995590367348,	//369
-17.30053920725912,	//370
-17.27117244415289,	//371
-17.2418555295956,	//372
-17.21258837897193,	//373
-17.18337090781021,	//374
-17.15420303178213,	//375
-17.12508466670255,	//376
-17.09601572852922,	//377
-17.06699613336252,	//378
-17.0380257974453,	//379
-17.00910463716253,	//380
-16.98023256904115,	//381
-16.95140950974976,	//382
-16.92263537609844,	//383
-16.89391008503847,	//384
-16.86523355366209,	//385
-16.83660569920228,	//386
-16.80802643903251,	//387
-16.77949569066651,	//388
-16.75101337175803,	//389
-16.72257940010059,	//390
-16.69419369362724,	//391
-16.66585617041035,	//392
-16.63756674866137,	//393
-16.60932534673056,	//394
-16.58113188310677,	//395
-16.55298627641723,	//396
-16.5248884454273,	//397
-16.49683830904021,	//398
-16.46883578629687,	//399
-16.44088079637559,	//400
-16.41297325859189,	//401
-16.38511309239824,	//402
-16.35730021738384,	//403
-16.32953455327437,	//404
-16.30181601993179,	//405
-16.27414453735408,	//406
-16.24652002567501,	//407
-16.21894240516395,	//408
-16.19141159622556,	//409
-16.16392751939966,	//410
-16.13649009536092,	//411
-16.10909924491865,	//412
-16.08175488901662,	//413
-16.05445694873277,	//414
-16.027205345279,	//415
-16.00000000000096,	//416
-15.97284083437781,	//417
-15.945727770022,	//418
-15.91866072867902,	//419
-15.89163963222721,	//420
-15.86466440267752,	//421
-15.83773496217327,	//422
-15.81085123298995,	//423
-15.78401313753497,	//424
-15.75722059834745,	//425
-15.73047353809802,	//426
-15.70377187958853,	//427
-15.67711554575191,	//428
-15.65050445965189,	//429
-15.6239385444828,	//430
-15.59741772356933,	//431
-15.57094192036634,	//432
-15.54451105845862,	//433
-15.51812506156065,	//434
-15.49178385351642,	//435
-15.46548735829919,	//436
-15.43923550001127,	//437
-15.41302820288379,	//438
-15.38686539127652,	//439
-15.3607469896776,	//440
-15.33467292270335,	//441
-15.30864311509807,	//442
-15.28265749173379,	//443
-15.25671597761005,	//444
-15.23081849785372,	//445
-15.20496497771876,	//446
-15.17915534258601,	//447
-15.15338951796296,	//448
-15.12766742948356,	//449
-15.10198900290798,	//450
-15.07635416412242,	//451
-15.05076283913889,	//452
-15.02521495409495,	//453
-14.9997104352536,	//454
-14.97424920900296,	//455
-14.94883120185611,	//456
-14.92345634045088,	//457
-14.89812455154962,	//458
-14.87283576203901,	//459
-14.84758989892981,	//460
-14.82238688935671,	//461
-14.79722666057806,	//462
-14.77210913997569,	//463
-14.74703425505471,	//464
-14.72200193344325,	//465
-14.69701210289233,	//466
-14.67206469127559,	//467
-14.6471596265891,	//468
-14.62229683695115,	//469
-14.59747625060205,	//470
-14.57269779590392,	//471
-14.54796140134048,	//472
-14.52326699551685,	//473
-14.49861450715932,	//474
-14.47400386511519,	//475
-14.44943499835252,	//476
-14.42490783595994,	//477
-14.40042230714648,	//478
-14.37597834124128,	//479
-14.3515758676935,	//480
-14.32721481607201,	//481
-14.30289511606525,	//482
-14.27861669748102,	//483
-14.25437949024625,	//484
-14.23018342440682,	//485
-14.20602843012737,	//486
-14.18191443769106,	//487
-14.1578413774994,	//488
-14.13380918007204,	//489
-14.10981777604657,	//490
-14.08586709617832,	//491
-14.06195707134014,	//492
-14.03808763252226,	//493
-14.01425871083202,	//494
-13.99047023749369,	//495
-13.96672214384833,	//496
-13.9430143613535,	//497
-13.91934682158313,	//498
-13.89571945622729,	//499
-13.87213219709201,	//500
-13.84858497609908,	//501
-13.82507772528582,	//502
-13.80161037680495,	//503
-13.77818286292434,	//504
-13.75479511602683,	//505
-13.73144706861004,	//506
-13.70813865328617,	//507
-13.68486980278182,	//508
-13.66164044993775,	//509
-13.63845052770877,	//510
-13.61529996916345,	//511
-13.59218870748399,	//512
-13.56911667596601,	//513
-13.54608380801836,	//514
-13.52309003716293,	//515
-13.50013529703442,	//516
-13.47721952138023,	//517
-13.45434264406019,	//518
-13.4315045990464,	//519
-13.40870532042305,	//520
-13.38594474238622,	//521
-13.36322279924367,	//522
-13.34053942541469,	//523
-13.31789455542988,	//524
-13.29528812393097,	//525
-13.27272006567064,	//526
-13.25019031551231,	//527
-13.22769880842999,	//528
-13.20524547950803,	//529
-13.18283026394102,	//530
-13.1604530970335,	//531
-13.13811391419988,	//532
-13.11581265096416,	//533
-13.0935492429598,	//534
-13.07132362592953,	//535
-13.04913573572513,	//536
-13.02698550830728,	//537
-13.00487287974538,	//538
-12.98279778621732,	//539
-12.96076016400934,	//540
-12.93875994951582,	//541
-12.91679707923913,	//542
-12.8948714897894,	//543
-12.87298311788438,	//544
-12.85113190034922,	//545
-12.82931777411631,	//546
-12.80754067622511,	//547
-12.78580054382194,	//548
-12.7640973141598,	//549
-12.74243092459822,	//550
-12.72080131260305,	//551
-12.69920841574629,	//552
-12.67765217170591,	//553
-12.65613251826566,	//554
-12.63464939331491,	//555
-12.61320273484844,	//556
-12.59179248096631,	//557
-12.57041856987363,	//558
-12.54908093988041,	//559
-12.52777952940138,	//560
-12.5065142769558,	//561
-12.48528512116729,	//562
-12.46409200076367,	//563
-12.44293485457674,	//564
-12.42181362154215,	//565
-12.40072824069919,	//566
-12.37967865119064,	//567
-12.35866479226257,	//568
-12.3376866032642,	//569
-12.31674402364766,	//570
-12.2958369929679,	//571
-12.27496545088245,	//572
-12.25412933715127,	//573
-12.23332859163657,	//574
-12.21256315430266,	//575
-12.19183296521573,	//576
-12.17113796454372,	//577
-12.15047809255615,	//578
-12.12985328962389,	//579
-12.10926349621905,	//580
-12.08870865291479,	//581
-12.06818870038514,	//582
-12.04770357940481,	//583
-12.02725323084909,	//584
-12.00683759569358,	//585
-11.9864566150141,	//586
-11.96611022998648,	//587
-11.94579838188642,	//588
-11.92552101208927,	//589
-11.90527806206991,	//590
-11.88506947340258,	//591
-11.86489518776066,	//592
-11.84475514691655,	//593
-11.8246492927415,	//594
-11.80457756720543,	//595
-11.78453991237674,	//596
-11.76453627042219,	//597
-11.74456658360669,	//598
-11.72463079429318,	//599
-11.7047288449424,	//600
-11.68486067811278,	//601
-11.66502623646027,	//602
-11.64522546273812,	//603
-11.62545829979678,	//604
-11.60572469058371,	//605
-11.58602457814319,	//606
-11.56635790561621,	//607
-11.54672461624026,	//608
-11.52712465334918,	//609
-11.50755796037299,	//610
-11.48802448083776,	//611
-11.46852415836539,	//612
-11.44905693667351,	//613
-11.42962275957526,	//614
-11.41022157097918,	//615
-11.39085331488899,	//616
-11.37151793540348,	//617
-11.35221537671634,	//618
-11.33294558311598,	//619
-11.31370849898535,	//620
-11.29450406880186,	//621
-11.27533223713711,	//622
-11.25619294865684,	//623
-11.23708614812067,	//624
-11.21801178038202,	//625
-11.19896979038791,	//626
-11.1799601231788,	//627
-11.16098272388845,	//628
-11.14203753774375,	//629
-11.12312451006457,	//630
-11.10424358626358,	//631
-11.08539471184614,	//632
-11.06657783241008,	//633
-11.04779289364558,	//634
-11.02903984133504,	//635
-11.01031862135284,	//636
-10.99162917966528,	//637
-10.97297146233036,	//638
-10.95434541549764,	//639
-10.9357509854081,	//640
-10.91718811839396,	//641
-10.89865676087856,	//642
-10.88015685937615,	//643
-10.8616883604918,	//644
-10.8432512109212,	//645
-10.82484535745052,	//646
-10.80647074695627,	//647
-10.78812732640513,	//648
-10.76981504285379,	//649
-10.75153384344882,	//650
-10.7332836754265,	//651
-10.71506448611268,	//652
-10.69687622292261,	//653
-10.67871883336082,	//654
-10.66059226502093,	//655
-10.64249646558552,	//656
-10.62443138282598,	//657
-10.60639696460236,	//658
-10.58839315886321,	//659
-10.57041991364542,	//660
-10.55247717707412,	//661
-10.53456489736245,	//662
-10.5166830228115,	//663
-10.49883150181008,	//664
-10.48101028283463,	//665
-10.46321931444904,	//666
-10.44545854530451,	//667
-10.42772792413941,	//668
-10.41002739977911,	//669
-10.39235692113585,	//670
-10.3747164372086,	//671
-10.35710589708289,	//672
-10.33952524993068,	//673
-10.32197444501021,	//674
-10.30445343166584,	//675
-10.28696215932793,	//676
-10.26950057751266,	//677
-10.25206863582193,	//678
-10.23466628394317,	//679
-10.21729347164922,	//680
-10.19995014879817,	//681
-10.18263626533322,	//682
-10.16535177128257,	//683
-10.14809661675921,	//684
-10.13087075196082,	//685
-10.11367412716961,	//686
-10.09650669275222,	//687
-10.07936839915949,	//688
-10.0622591969264,	//689
-10.04517903667187,	//690
-10.02812786909868,	//691
-10.01110564499324,	//692
-9.994112315225543,	//693
-9.977147830748946,	//694
-9.960212142600074,	//695
-9.943305201898664,	//696
-9.926426959847422,	//697
-9.909577367731886,	//698
-9.892756376920286,	//699
-9.875963938863396,	//700
-9.859200005094406,	//701
-9.842464527228776,	//702
-9.825757456964091,	//703
-9.80907874607993,	//704
-9.792428346437726,	//705
-9.775806209980619,	//706
-9.759212288733327,	//707
-9.742646534802004,	//708
-9.726108900374101,	//709
-9.709599337718224,	//710
-9.693117799184005,	//711
-9.67666423720196,	//712
-9.66023860428335,	//713
-9.643840853020047,	//714
-9.627470936084395,	//715
-9.611128806229072,	//716
-9.59481441628696,	//717
-9.578527719171005,	//718
-9.562268667874074,	//719
-9.546037215468836,	//720
-9.529833315107608,	//721
-9.513656920022232,	//722
-9.497507983523938,	//723
-9.481386459003209,	//724
-9.465292299929638,	//725
-9.449225459851807,	//726
-9.433185892397146,	//727
-9.417173551271798,	//728
-9.401188390260492,	//729
-9.385230363226398,	//730
-9.369299424111006,	//731
-9.353395526933989,	//732
-9.337518625793063,	//733
-9.321668674863867,	//734
-9.305845628399821,	//735
-9.290049440731998,	//736
-9.274280066268995,	//737
-9.258537459496791,	//738
-9.242821574978629,	//739
-9.227132367354876,	//740
-9.211469791342894,	//741
-9.195833801736914,	//742
-9.180224353407894,	//743
-9.164641401303403,	//744
-9.14908490044748,	//745
-9.133554805940513,	//746
-9.118051072959098,	//747
-9.102573656755922,	//748
-9.087122512659626,	//749
-9.07169759607468,	//750
-9.056298862481247,	//751
-9.040926267435069,	//752
-9.025579766567324,	//753
-9.010259315584502,	//754
-8.994964870268285,	//755
-8.97969638647541,	//756
-8.964453820137544,	//757
-8.949237127261158,	//758
-8.934046263927401,	//759
-8.918881186291973,	//760
-8.903741850584993,	//761
-8.888628213110881,	//762
-8.873540230248226,	//763
-8.858477858449666,	//764
-8.843441054241753,	//765
-8.828429774224833,	//766
-8.813443975072927,	//767
-8.798483613533593,	//768
-8.783548646427812,	//769
-8.768639030649855,	//770
-8.753754723167166,	//771
-8.738895681020235,	//772
-8.72406186132247,	//773
-8.709253221260081,	//774
-8.694469718091947,	//775
-8.679711309149504,	//776
-8.66497795183661,	//777
-8.650269603629431,	//778
-8.635586222076315,	//779
-8.620927764797669,	//780
-8.606294189485835,	//781
-8.591685453904974,	//782
-8.577101515890938,	//783
-8.562542333351148,	//784
-8.548007864264479,	//785
-8.533498066681133,	//786
-8.519012898722522,	//787
-8.504552318581139,	//788
-8.490116284520447,	//789
-8.475704754874753,	//790
-8.461317688049094,	//791
-8.446955042519107,	//792
-8.432616776830917,	//793
-8.418302849601012,	//794
-8.404013219516129,	//795
-8.389747845333131,	//796
-8.375506685878891,	//797
-8.361289700050168,	//798
-8.347096846813495,	//799
-8.332928085205053,	//800
-8.318783374330561,	//801
-8.304662673365153,	//802
-8.290565941553259,	//803
-8.276493138208492,	//804
-8.262444222713528,	//805
-8.248419154519985,	//806
-8.234417893148311,	//807
-8.220440398187673,	//808
-8.206486629295823,	//809
-8.192556546198999,	//810
-8.178650108691798,	//811
-8.164767276637065,	//812
-8.150908009965773,	//813
-8.137072268676917,	//814
-8.123260012837385,	//815
-8.109471202581851,	//816
-8.095705798112659,	//817
-8.081963759699709,	//818
-8.068245047680337,	//819
-8.054549622459206,	//820
-8.040877444508192,	//821
-8.027228474366265,	//822
-8.013602672639379,	//823
-8.000000000000361,	//824
-7.986420417188786,	//825
-7.972863885010878,	//826
-7.959330364339389,	//827
-7.945819816113487,	//828
-7.932332201338642,	//829
-7.918867481086518,	//830
-7.905425616494856,	//831
-7.892006568767366,	//832
-7.878610299173608,	//833
-7.86523676904889,	//834
-7.851885939794148,	//835
-7.83855777287584,	//836
-7.82525222982583,	//837
-7.811969272241284,	//838
-7.79870886178455,	//839
-7.785470960183056,	//840
-7.772255529229191,	//841
-7.759062530780207,	//842
-7.745891926758093,	//843
-7.732743679149479,	//844
-7.719617750005519,	//845
-7.706514101441782,	//846
-7.693432695638146,	//847
-7.680373494838685,	//848
-7.667336461351562,	//849
-7.654321557548922,	//850
-7.641328745866779,	//851
-7.628357988804908,	//852
-7.615409248926746,	//853
-7.602482488859267,	//854
-7.589577671292892,	//855
-7.576694758981367,	//856
-7.563833714741667,	//857
-7.550994501453879,	//858
-7.538177082061099,	//859
-7.52538141956933,	//860
-7.512607477047365,	//861
-7.499855217626688,	//862
-7.487124604501366,	//863
-7.474415600927942,	//864
-7.461728170225326,	//865
-7.449062275774698,	//866
-7.436417881019391,	//867
-7.423794949464795,	//868
-7.411193444678245,	//869
-7.39861333028892,	//870
-7.386054569987736,	//871
-7.373517127527242,	//872
-7.361000966721515,	//873
-7.348506051446057,	//874
-7.336032345637686,	//875
-7.323579813294439,	//876
-7.311148418475464,	//877
-7.298738125300916,	//878
-7.286348897951851,	//879
-7.273980700670132,	//880
-7.261633497758314,	//881
-7.24930725357955,	//882
-7.237001932557485,	//883
-7.224717499176149,	//884
-7.212453917979864,	//885
-7.20021115357313,	//886
-7.187989170620535,	//887
-7.175787933846642,	//888
-7.163607408035897,	//889
-7.151447558032519,	//890
-7.139308348740403,	//891
-7.127189745123017,	//892
-7.115091712203305,	//893
-7.103014215063579,	//894
-7.090957218845424,	//895
-7.078920688749594,	//896
-7.066904590035914,	//897
-7.054908888023179,	//898
-7.042933548089052,	//899
-7.030978535669966,	//900
-7.019043816261025,	//901
-7.007129355415902,	//902
-6.995235118746742,	//903
-6.983361071924061,	//904
-6.971507180676647,	//905
-6.959673410791462,	//906
-6.947859728113543,	//907
-6.936066098545903,	//908
-6.924292488049434,	//909
-6.912538862642806,	//910
-6.900805188402371,	//911
-6.889091431462065,	//912
-6.87739755801331,	//913
-6.865723534304915,	//914
-6.854069326642982,	//915
-6.842434901390805,	//916
-6.830820224968775,	//917
-6.819225263854283,	//918
-6.807649984581622,	//919
-6.796094353741893,	//920
-6.784558337982904,	//921
-6.77304190400908,	//922
-6.761545018581361,	//923
-6.750067648517111,	//924
-6.738609760690015,	//925
-6.727171322029994,	//926
-6.7157522995231,	//927
-6.704352660211426,	//928
-6.692972371193009,	//929
-6.681611399621735,	//930
-6.670269712707245,	//931
-6.65894727771484,	//932
-6.647644061965386,	//933
-6.636360032835221,	//934
-6.625095157756058,	//935
-6.613849404214895,	//936
-6.602622739753918,	//937
-6.591415131970409,	//938
-6.580226548516652,	//939
-6.56905695709984,	//940
-6.55790632548198,	//941
-6.546774621479802,	//942
-6.535661812964665,	//943
-6.524567867862466,	//944
-6.513492754153544,	//945
-6.502436439872592,	//946
-6.491398893108562,	//947
-6.480380082004571,	//948
-6.469379974757814,	//949
-6.458398539619469,	//950
-6.447435744894605,	//951
-6.436491558942094,	//952
-6.425565950174512,	//953
-6.414658887058059,	//954
-6.403770338112459,	//955
-6.392900271910872,	//956
-6.382048657079803,	//957
-6.371215462299014,	//958
-6.360400656301431,	//959
-6.349604207873051,	//960
-6.338826085852861,	//961
-6.328066259132735,	//962
-6.317324696657358,	//963
-6.306601367424125,	//964
-6.295896240483061,	//965
-6.285209284936721,	//966
-6.274540469940113,	//967
-6.263889764700597,	//968
-6.253257138477807,	//969
-6.242642560583554,	//970
-6.232046000381741,	//971
-6.221467427288276,	//972
-6.21090681077098,	//973
-6.200364120349501,	//974
-6.189839325595226,	//975
-6.179332396131194,	//976
-6.168843301632006,	//977
-6.158372011823739,	//978
-6.14791849648386,	//979
-6.137482725441133,	//980
-6.127064668575542,	//981
-6.116664295818193,	//982
-6.106281577151236,	//983
-6.095916482607771,	//984
-6.085568982271771,	//985
-6.075239046277982,	//986
-6.064926644811853,	//987
-6.054631748109434,	//988
-6.044354326457306,	//989
-6.034094350192478,	//990
-6.023851789702316,	//991
-6.013626615424453,	//992
-6.003418797846698,	//993
-5.993228307506958,	//994
-5.983055114993151,	//995
-5.972899190943118,	//996
-5.962760506044544,	//997
-5.952639031034868,	//998
-5.9425347367012,	//999
-5.932447593880238,	//1000
-5.922377573458186,	//1001
-5.912324646370664,	//1002
-5.902288783602626,	//1003
-5.892269956188281,	//1004
-5.882268135211006,	//1005
-5.872283291803258,	//1006
-5.8623153971465,	//1007
-5.852364422471111,	//1008
-5.842430339056304,	//1009
-5.832513118230046,	//1010
-5.822612731368971,	//1011
-5.812729149898303,	//1012
-5.802862345291766,	//1013
-5.79301228907151,	//1014
-5.78317895280802,	//1015
-5.773362308120045,	//1016
-5.763562326674503,	//1017
-5.75377898018641,	//1018
-5.744012240418793,	//1019
-5.734262079182611,	//1020
-5.72452846833667,	//1021
-5.714811379787546,	//1022
-5.705110785489502,	//1023
-5.695426657444408,	//1024
-5.685758967701656,	//1025
-5.676107688358087,	//1026
-5.666472791557903,	//1027
-5.656854249492592,	//1028
-5.647252034400844,	//1029
-5.637666118568472,	//1030
-5.628096474328334,	//1031
-5.61854307406025,	//1032
-5.609005890190926,	//1033
-5.59948489519387,	//1034
-5.589980061589314,	//1035
-5.580491361944139,	//1036
-5.571018768871791,	//1037
-5.561562255032199,	//1038
-5.552121793131708,	//1039
-5.542697355922986,	//1040
-5.533288916204955,	//1041
-5.523896446822709,	//1042
-5.514519920667436,	//1043
-5.505159310676339,	//1044
-5.495814589832559,	//1045
-5.486485731165098,	//1046
-5.477172707748739,	//1047
-5.467875492703969,	//1048
-5.4585940591969,	//1049
-5.449328380439196,	//1050
-5.440078429687992,	//1051
-5.430844180245816,	//1052
-5.421625605460516,	//1053
-5.412422678725179,	//1054
-5.403235373478055,	//1055
-5.394063663202484,	//1056
-5.384907521426814,	//1057
-5.375766921724328,	//1058
-5.366641837713169,	//1059
-5.357532243056259,	//1060
-5.348438111461227,	//1061
-5.339359416680331,	//1062
-5.330296132510385,	//1063
-5.321248232792681,	//1064
-5.312215691412912,	//1065
-5.303198482301101,	//1066
-5.294196579431524,	//1067
-5.285209956822632,	//1068
-5.276238588536978,	//1069
-5.267282448681145,	//1070
-5.258341511405669,	//1071
-5.24941575090496,	//1072
-5.240505141417236,	//1073
-5.231609657224442,	//1074
-5.222729272652178,	//1075
-5.213863962069627,	//1076
-5.205013699889476,	//1077
-5.196178460567848,	//1078
-5.187358218604223,	//1079
-5.178552948541369,	//1080
-5.169762624965265,	//1081
-5.160987222505027,	//1082
-5.152226715832843,	//1083
-5.143481079663886,	//1084
-5.134750288756253,	//1085
-5.126034317910888,	//1086
-5.117333141971509,	//1087
-5.108646735824532,	//1088
-5.099975074399007,	//1089
-5.091318132666536,	//1090
-5.082675885641209,	//1091
-5.074048308379528,	//1092
-5.065435375980332,	//1093
-5.056837063584732,	//1094
-5.048253346376034,	//1095
-5.039684199579669,	//1096
-5.031129598463123,	//1097
-5.022589518335861,	//1098
-5.014063934549263,	//1099
-5.005552822496546,	//1100
-4.997056157612696,	//1101
-4.988573915374398,	//1102
-4.980106071299963,	//1103
-4.971652600949257,	//1104
-4.963213479923636,	//1105
-4.954788683865869,	//1106
-4.946378188460068,	//1107
-4.937981969431624,	//1108
-4.929600002547129,	//1109
-4.921232263614314,	//1110
-4.912878728481972,	//1111
-4.904539373039892,	//1112
-4.896214173218789,	//1113
-4.887903104990236,	//1114
-4.879606144366591,	//1115
-4.871323267400929,	//1116
-4.863054450186977,	//1117
-4.854799668859039,	//1118
-4.84655889959193,	//1119
-4.838332118600907,	//1120
-4.830119302141603,	//1121
-4.821920426509951,	//1122
-4.813735468042124,	//1123
-4.805564403114464,	//1124
-4.797407208143408,	//1125
-4.78926385958543,	//1126
-4.781134333936966,	//1127
-4.773018607734346,	//1128
-4.764916657553732,	//1129
-4.756828460011045,	//1130
-4.748753991761898,	//1131
-4.740693229501533,	//1132
-4.732646149964748,	//1133
-4.724612729925832,	//1134
-4.716592946198502,	//1135
-4.708586775635829,	//1136
-4.700594195130175,	//1137
-4.692615181613128,	//1138
-4.684649712055433,	//1139
-4.676697763466924,	//1140
-4.668759312896461,	//1141
-4.660834337431863,	//1142
-4.65292281419984,	//1143
-4.64502472036593,	//1144
-4.637140033134427,	//1145
-4.629268729748325,	//1146
-4.621410787489245,	//1147
-4.613566183677369,	//1148
-4.605734895671378,	//1149
-4.597916900868388,	//1150
-4.590112176703879,	//1151
-4.582320700651633,	//1152
-4.574542450223672,	//1153
-4.566777402970188,	//1154
-4.559025536479481,	//1155
-4.551286828377893,	//1156
-4.543561256329745,	//1157
-4.535848798037271,	//1158
-4.528149431240556,	//1159
-4.520463133717467,	//1160
-4.512789883283594,	//1161
-4.505129657792184,	//1162
-4.497482435134075,	//1163
-4.489848193237638,	//1164
-4.482226910068705,	//1165
-4.474618563630512,	//1166
-4.467023131963634,	//1167
-4.459440593145919,	//1168
-4.451870925292429,	//1169
-4.444314106555374,	//1170
-4.436770115124046,	//1171
-4.429238929224766,	//1172
-4.42172052712081,	//1173
-4.41421488711235,	//1174
-4.406721987536398,	//1175
-4.399241806766731,	//1176
-4.39177432321384,	//1177
-4.384319515324862,	//1178
-4.376877361583518,	//1179
-4.369447840510052,	//1180
-4.362030930661169,	//1181
-4.354626610629975,	//1182
-4.347234859045908,	//1183
-4.339855654574686,	//1184
-4.332488975918239,	//1185
-4.32513480181465,	//1186
-4.317793111038092,	//1187
-4.31046388239877,	//1188
-4.303147094742854,	//1189
-4.295842726952423,	//1190
-4.288550757945404,	//1191
-4.28127116667551,	//1192
-4.274003932132175,	//1193
-4.266749033340503,	//1194
-4.259506449361197,	//1195
-4.252276159290505,	//1196
-4.245058142260159,	//1197
-4.237852377437314,	//1198
-4.230658844024484,	//1199
-4.223477521259491,	//1200
-4.216308388415396,	//1201
-4.209151424800443,	//1202
-4.202006609758001,	//1203
-4.194873922666503,	//1204
-4.187753342939383,	//1205
-4.180644850025021,	//1206
-4.173548423406684,	//1207
-4.166464042602464,	//1208
-4.159391687165218,	//1209
-4.152331336682514,	//1210
-4.145282970776567,	//1211
-4.138246569104185,	//1212
-4.131222111356702,	//1213
-4.12420957725993,	//1214
-4.117208946574094,	//1215
-4.110220199093774,	//1216
-4.10324331464785,	//1217
-4.096278273099438,	//1218
-4.089325054345838,	//1219
-4.082383638318471,	//1220
-4.075454004982826,	//1221
-4.068536134338398,	//1222
-4.061630006418632,	//1223
-4.054735601290865,	//1224
-4.047852899056269,	//1225
-4.040981879849793,	//1226
-4.034122523840107,	//1227
-4.027274811229542,	//1228
-4.020438722254036,	//1229
-4.013614237183072,	//1230
-4.006801336319629,	//1231
-4.00000000000012,	//1232
-3.993210208594333,	//1233
-3.986431942505379,	//1234
-3.979665182169635,	//1235
-3.972909908056684,	//1236
-3.966166100669262,	//1237
-3.9594337405432,	//1238
-3.952712808247369,	//1239
-3.946003284383623,	//1240
-3.939305149586745,	//1241
-3.932618384524386,	//1242
-3.925942969897015,	//1243
-3.919278886437861,	//1244
-3.912626114912857,	//1245
-3.905984636120583,	//1246
-3.899354430892217,	//1247
-3.892735480091469,	//1248
-3.886127764614538,	//1249
-3.879531265390045,	//1250
-3.872945963378989,	//1251
-3.866371839574682,	//1252
-3.859808875002702,	//1253
-3.853257050720833,	//1254
-3.846716347819015,	//1255
-3.840186747419285,	//1256
-3.833668230675724,	//1257
-3.827160778774404,	//1258
-3.820664372933332,	//1259
-3.814178994402397,	//1260
-3.807704624463315,	//1261
-3.801241244429577,	//1262
-3.794788835646389,	//1263
-3.788347379490627,	//1264
-3.781916857370777,	//1265
-3.775497250726882,	//1266
-3.769088541030493,	//1267
-3.762690709784609,	//1268
-3.756303738523626,	//1269
-3.749927608813288,	//1270
-3.743562302250627,	//1271
-3.737207800463915,	//1272
-3.730864085112607,	//1273
-3.724531137887293,	//1274
-3.71820894050964,	//1275
-3.711897474732342,	//1276
-3.705596722339067,	//1277
-3.699306665144404,	//1278
-3.693027284993812,	//1279
-3.686758563763566,	//1280
-3.680500483360702,	//1281
-3.674253025722973,	//1282
-3.668016172818788,	//1283
-3.661789906647165,	//1284
-3.655574209237678,	//1285
-3.649369062650403,	//1286
-3.643174448975871,	//1287
-3.636990350335011,	//1288
-3.630816748879103,	//1289
-3.624653626789721,	//1290
-3.618500966278688,	//1291
-3.612358749588021,	//1292
-3.606226958989878,	//1293
-3.600105576786511,	//1294
-3.593994585310213,	//1295
-3.587893966923267,	//1296
-3.581803704017895,	//1297
-3.575723779016206,	//1298
-3.569654174370148,	//1299
-3.563594872561455,	//1300
-3.557545856101599,	//1301
-3.551507107531736,	//1302
-3.545478609422659,	//1303
-3.539460344374744,	//1304
-3.533452295017904,	//1305
-3.527454444011537,	//1306
-3.521466774044473,	//1307
-3.51548926783493,	//1308
-3.50952190813046,	//1309
-3.503564677707899,	//1310
-3.497617559373319,	//1311
-3.491680535961978,	//1312
-3.485753590338271,	//1313
-3.479836705395678,	//1314
-3.47392986405672,	//1315
-3.4680330492729,	//1316
-3.462146244024665,	//1317
-3.456269431321351,	//1318
-3.450402594201134,	//1319
-3.444545715730981,	//1320
-3.438698779006603,	//1321
-3.432861767152406,	//1322
-3.427034663321439,	//1323
-3.421217450695351,	//1324
-3.415410112484336,	//1325
-3.40961263192709,	//1326
-3.40382499229076,	//1327
-3.398047176870895,	//1328
-3.392279168991402,	//1329
-3.386520952004489,	//1330
-3.38077250929063,	//1331
-3.375033824258505,	//1332
-3.369304880344957,	//1333
-3.363585661014946,	//1334
-3.3578761497615,	//1335
-3.352176330105663,	//1336
-3.346486185596454,	//1337
-3.340805699810817,	//1338
-3.335134856353573,	//1339
-3.32947363885737,	//1340
-3.323822030982643,	//1341
-3.318180016417561,	//1342
-3.312547578877979,	//1343
-3.306924702107398,	//1344
-3.301311369876909,	//1345
-3.295707565985155,	//1346
-3.290113274258277,	//1347
-3.284528478549871,	//1348
-3.278953162740941,	//1349
-3.273387310739852,	//1350
-3.267830906482283,	//1351
-3.262283933931184,	//1352
-3.256746377076723,	//1353
-3.251218219936248,	//1354
-3.245699446554232,	//1355
-3.240190041002237,	//1356
-3.234689987378859,	//1357
-3.229199269809686,	//1358
-3.223717872447254,	//1359
-3.218245779470998,	//1360
-3.212782975087208,	//1361
-3.207329443528982,	//1362
-3.201885169056181,	//1363
-3.196450135955388,	//1364
-3.191024328539854,	//1365
-3.18560773114946,	//1366
-3.180200328150668,	//1367
-3.174802103936478,	//1368
-3.169413042926383,	//1369
-3.16403312956632,	//1370
-3.158662348328632,	//1371
-3.153300683712016,	//1372
-3.147948120241483,	//1373
-3.142604642468314,	//1374
-3.137270234970009,	//1375
-3.131944882350251,	//1376
-3.126628569238857,	//1377
-3.12132128029173,	//1378
-3.116023000190824,	//1379
-3.110733713644092,	//1380
-3.105453405385443,	//1381
-3.100182060174704,	//1382
-3.094919662797567,	//1383
-3.089666198065551,	//1384
-3.084421650815957,	//1385
-3.079186005911823,	//1386
-3.073959248241884,	//1387
-3.068741362720521,	//1388
-3.063532334287725,	//1389
-3.058332147909051,	//1390
-3.053140788575572,	//1391
-3.04795824130384,	//1392
-3.04278449113584,	//1393
-3.037619523138946,	//1394
-3.032463322405881,	//1395
-3.027315874054672,	//1396
-3.022177163228607,	//1397
-3.017047175096194,	//1398
-3.011925894851113,	//1399
-3.006813307712181,	//1400
-3.001709398923304,	//1401
-2.996614153753434,	//1402
-2.991527557496531,	//1403
-2.986449595471514,	//1404
-2.981380253022227,	//1405
-2.976319515517389,	//1406
-2.971267368350555,	//1407
-2.966223796940075,	//1408
-2.961188786729049,	//1409
-2.956162323185287,	//1410
-2.951144391801269,	//1411
-2.946134978094097,	//1412
-2.941134067605459,	//1413
-2.936141645901585,	//1414
-2.931157698573206,	//1415
-2.926182211235512,	//1416
-2.921215169528108,	//1417
-2.916256559114979,	//1418
-2.911306365684442,	//1419
-2.906364574949108,	//1420
-2.901431172645839,	//1421
-2.896506144535711,	//1422
-2.891589476403967,	//1423
-2.886681154059979,	//1424
-2.881781163337208,	//1425
-2.876889490093162,	//1426
-2.872006120209353,	//1427
-2.867131039591262,	//1428
-2.862264234168292,	//1429
-2.85740568989373,	//1430
-2.852555392744708,	//1431
-2.847713328722161,	//1432
-2.842879483850786,	//1433
-2.838053844179001,	//1434
-2.83323639577891,	//1435
-2.828427124746254,	//1436
-2.82362601720038,	//1437
-2.818833059284194,	//1438
-2.814048237164125,	//1439
-2.809271537030083,	//1440
-2.804502945095421,	//1441
-2.799742447596893,	//1442
-2.794990030794615,	//1443
-2.790245680972028,	//1444
-2.785509384435853,	//1445
-2.780781127516058,	//1446
-2.776060896565812,	//1447
-2.771348677961452,	//1448
-2.766644458102436,	//1449
-2.761948223411313,	//1450
-2.757259960333676,	//1451
-2.752579655338128,	//1452
-2.747907294916238,	//1453
-2.743242865582508,	//1454
-2.738586353874328,	//1455
-2.733937746351943,	//1456
-2.729297029598409,	//1457
-2.724664190219557,	//1458
-2.720039214843955,	//1459
-2.715422090122868,	//1460
-2.710812802730217,	//1461
-2.706211339362549,	//1462
-2.701617686738987,	//1463
-2.697031831601202,	//1464
-2.692453760713367,	//1465
-2.687883460862124,	//1466
-2.683320918856544,	//1467
-2.678766121528089,	//1468
-2.674219055730573,	//1469
-2.669679708340126,	//1470
-2.665148066255153,	//1471
-2.6606241163963,	//1472
-2.656107845706416,	//1473
-2.651599241150511,	//1474
-2.647098289715722,	//1475
-2.642604978411276,	//1476
-2.638119294268449,	//1477
-2.633641224340533,	//1478
-2.629170755702795,	//1479
-2.624707875452441,	//1480
-2.620252570708579,	//1481
-2.615804828612182,	//1482
-2.61136463632605,	//1483
-2.606931981034774,	//1484
-2.602506849944699,	//1485
-2.598089230283885,	//1486
-2.593679109302073,	//1487
-2.589276474270646,	//1488
-2.584881312482593,	//1489
-2.580493611252475,	//1490
-2.576113357916383,	//1491
-2.571740539831904,	//1492
-2.567375144378088,	//1493
-2.563017158955406,	//1494
-2.558666570985716,	//1495
-2.554323367912227,	//1496
-2.549987537199465,	//1497
-2.54565906633323,	//1498
-2.541337942820566,	//1499
-2.537024154189726,	//1500
-2.532717687990128,	//1501
-2.528418531792328,	//1502
-2.524126673187979,	//1503
-2.519842099789797,	//1504
-2.515564799231524,	//1505
-2.511294759167893,	//1506
-2.507031967274594,	//1507
-2.502776411248235,	//1508
-2.498528078806311,	//1509
-2.494286957687161,	//1510
-2.490053035649944,	//1511
-2.485826300474592,	//1512
-2.481606739961781,	//1513
-2.477394341932897,	//1514
-2.473189094229997,	//1515
-2.468990984715775,	//1516
-2.464800001273528,	//1517
-2.46061613180712,	//1518
-2.456439364240949,	//1519
-2.452269686519909,	//1520
-2.448107086609358,	//1521
-2.443951552495081,	//1522
-2.439803072183259,	//1523
-2.435661633700428,	//1524
-2.431527225093452,	//1525
-2.427399834429483,	//1526
-2.423279449795928,	//1527
-2.419166059300418,	//1528
-2.415059651070765,	//1529
-2.410960213254939,	//1530
-2.406867734021026,	//1531
-2.402782201557196,	//1532
-2.398703604071668,	//1533
-2.394631929792679,	//1534
-2.390567166968447,	//1535
-2.386509303867137,	//1536
-2.38245832877683,	//1537
-2.378414230005487,	//1538
-2.374376995880914,	//1539
-2.370346614750731,	//1540
-2.366323074982339,	//1541
-2.362306364962881,	//1542
-2.358296473099216,	//1543
-2.354293387817879,	//1544
-2.350297097565052,	//1545
-2.346307590806529,	//1546
-2.342324856027681,	//1547
-2.338348881733427,	//1548
-2.334379656448196,	//1549
-2.330417168715897,	//1550
-2.326461407099885,	//1551
-2.32251236018293,	//1552
-2.318570016567179,	//1553
-2.314634364874128,	//1554
-2.310705393744588,	//1555
-2.30678309183865,	//1556
-2.302867447835655,	//1557
-2.29895845043416,	//1558
-2.295056088351905,	//1559
-2.291160350325782,	//1560
-2.287271225111802,	//1561
-2.28338870148506,	//1562
-2.279512768239706,	//1563
-2.275643414188912,	//1564
-2.271780628164839,	//1565
-2.267924399018602,	//1566
-2.264074715620244,	//1567
-2.2602315668587,	//1568
-2.256394941641763,	//1569
-2.252564828896058,	//1570
-2.248741217567004,	//1571
-2.244924096618785,	//1572
-2.241113455034319,	//1573
-2.237309281815222,	//1574
-2.233511565981783,	//1575
-2.229720296572926,	//1576
-2.225935462646181,	//1577
-2.222157053277654,	//1578
-2.21838505756199,	//1579
-2.21461946461235,	//1580
-2.210860263560372,	//1581
-2.207107443556142,	//1582
-2.203360993768166,	//1583
-2.199620903383332,	//1584
-2.195887161606887,	//1585
-2.192159757662398,	//1586
-2.188438680791726,	//1587
-2.184723920254993,	//1588
-2.181015465330552,	//1589
-2.177313305314954,	//1590
-2.173617429522921,	//1591
-2.169927827287311,	//1592
-2.166244487959087,	//1593
-2.162567400907293,	//1594
-2.158896555519014,	//1595
-2.155231941199353,	//1596
-2.151573547371394,	//1597
-2.147921363476179,	//1598
-2.14427537897267,	//1599
-2.140635583337723,	//1600
-2.137001966066056,	//1601
-2.133374516670219,	//1602
-2.129753224680567,	//1603
-2.126138079645221,	//1604
-2.122529071130048,	//1605
-2.118926188718625,	//1606
-2.115329422012211,	//1607
-2.111738760629714,	//1608
-2.108154194207666,	//1609
-2.10457571240019,	//1610
-2.101003304878969,	//1611
-2.09743696133322,	//1612
-2.09387667146966,	//1613
-2.090322425012479,	//1614
-2.086774211703311,	//1615
-2.083232021301201,	//1616
-2.079695843582578,	//1617
-2.076165668341226,	//1618
-2.072641485388253,	//1619
-2.069123284552061,	//1620
-2.06561105567832,	//1621
-2.062104788629934,	//1622
-2.058604473287016,	//1623
-2.055110099546857,	//1624
-2.051621657323894,	//1625
-2.048139136549688,	//1626
-2.044662527172888,	//1627
-2.041191819159205,	//1628
-2.037727002491382,	//1629
-2.034268067169168,	//1630
-2.030815003209285,	//1631
-2.027367800645402,	//1632
-2.023926449528104,	//1633
-2.020490939924867,	//1634
-2.017061261920023,	//1635
-2.013637405614741,	//1636
-2.010219361126988,	//1637
-2.006807118591506,	//1638
-2.003400668159785,	//1639
-2.00000000000003,	//1640
-1.996605104297136,	//1641
-1.99321597125266,	//1642
-1.989832591084788,	//1643
-1.986454954028312,	//1644
-1.983083050334601,	//1645
-1.97971687027157,	//1646
-1.976356404123655,	//1647
-1.973001642191782,	//1648
-1.969652574793343,	//1649
-1.966309192262163,	//1650
-1.962971484948478,	//1651
-1.959639443218901,	//1652
-1.956313057456399,	//1653
-1.952992318060262,	//1654
-1.949677215446079,	//1655
-1.946367740045706,	//1656
-1.94306388230724,	//1657
-1.939765632694993,	//1658
-1.936472981689465,	//1659
-1.933185919787312,	//1660
-1.929904437501322,	//1661
-1.926628525360388,	//1662
-1.923358173909479,	//1663
-1.920093373709614,	//1664
-1.916834115337833,	//1665
-1.913580389387173,	//1666
-1.910332186466637,	//1667
-1.90708949720117,	//1668
-1.903852312231629,	//1669
-1.90062062221476,	//1670
-1.897394417823166,	//1671
-1.894173689745285,	//1672
-1.89095842868536,	//1673
-1.887748625363413,	//1674
-1.884544270515218,	//1675
-1.881345354892276,	//1676
-1.878151869261785,	//1677
-1.874963804406616,	//1678
-1.871781151125285,	//1679
-1.868603900231929,	//1680
-1.865432042556276,	//1681
-1.862265568943619,	//1682
-1.859104470254792,	//1683
-1.855948737366143,	//1684
-1.852798361169506,	//1685
-1.849653332572174,	//1686
-1.846513642496879,	//1687
-1.843379281881755,	//1688
-1.840250241680324,	//1689
-1.837126512861459,	//1690
-1.834008086409367,	//1691
-1.830894953323555,	//1692
-1.827787104618811,	//1693
-1.824684531325174,	//1694
-1.821587224487908,	//1695
-1.818495175167478,	//1696
-1.815408374439524,	//1697
-1.812326813394833,	//1698
-1.809250483139317,	//1699
-1.806179374793983,	//1700
-1.803113479494912,	//1701
-1.800052788393228,	//1702
-1.79699729265508,	//1703
-1.793946983461607,	//1704
-1.790901852008921,	//1705
-1.787861889508076,	//1706
-1.784827087185047,	//1707
-1.781797436280701,	//1708
-1.778772928050773,	//1709
-1.775753553765842,	//1710
-1.772739304711303,	//1711
-1.769730172187346,	//1712
-1.766726147508926,	//1713
-1.763727222005742,	//1714
-1.76073338702221,	//1715
-1.757744633917439,	//1716
-1.754760954065204,	//1717
-1.751782338853923,	//1718
-1.748808779686633,	//1719
-1.745840267980963,	//1720
-1.742876795169109,	//1721
-1.739918352697813,	//1722
-1.736964932028334,	//1723
-1.734016524636424,	//1724
-1.731073122012307,	//1725
-1.72813471566065,	//1726
-1.725201297100541,	//1727
-1.722272857865464,	//1728
-1.719349389503276,	//1729
-1.716430883576177,	//1730
-1.713517331660694,	//1731
-1.71060872534765,	//1732
-1.707705056242143,	//1733
-1.70480631596352,	//1734
-1.701912496145354,	//1735
-1.699023588435422,	//1736
-1.696139584495675,	//1737
-1.693260476002219,	//1738
-1.69038625464529,	//1739
-1.687516912129227,	//1740
-1.684652440172453,	//1741
-1.681792830507448,	//1742
-1.678938074880725,	//1743
-1.676088165052806,	//1744
-1.673243092798202,	//1745
-1.670402849905384,	//1746
-1.667567428176761,	//1747
-1.66473681942866,	//1748
-1.661911015491297,	//1749
-1.659090008208755,	//1750
-1.656273789438965,	//1751
-1.653462351053674,	//1752
-1.65065568493843,	//1753
-1.647853782992553,	//1754
-1.645056637129114,	//1755
-1.642264239274911,	//1756
-1.639476581370446,	//1757
-1.636693655369901,	//1758
-1.633915453241117,	//1759
-1.631141966965568,	//1760
-1.628373188538337,	//1761
-1.625609109968099,	//1762
-1.622849723277092,	//1763
-1.620095020501094,	//1764
-1.617344993689405,	//1765
-1.614599634904819,	//1766
-1.611858936223603,	//1767
-1.609122889735475,	//1768
-1.60639148754358,	//1769
-1.603664721764467,	//1770
-1.600942584528067,	//1771
-1.59822506797767,	//1772
-1.595512164269903,	//1773
-1.592803865574706,	//1774
-1.59010016407531,	//1775
-1.587401051968215,	//1776
-1.584706521463168,	//1777
-1.582016564783136,	//1778
-1.579331174164292,	//1779
-1.576650341855984,	//1780
-1.573974060120718,	//1781
-1.571302321234133,	//1782
-1.568635117484981,	//1783
-1.565972441175102,	//1784
-1.563314284619405,	//1785
-1.560660640145842,	//1786
-1.558011500095388,	//1787
-1.555366856822022,	//1788
-1.552726702692698,	//1789
-1.550091030087329,	//1790
-1.54745983139876,	//1791
-1.544833099032752,	//1792
-1.542210825407955,	//1793
-1.539593002955889,	//1794
-1.536979624120919,	//1795
-1.534370681360237,	//1796
-1.53176616714384,	//1797
-1.529166073954503,	//1798
-1.526570394287763,	//1799
-1.523979120651897,	//1800
-1.521392245567897,	//1801
-1.51880976156945,	//1802
-1.516231661202918,	//1803
-1.513657937027313,	//1804
-1.511088581614281,	//1805
-1.508523587548074,	//1806
-1.505962947425534,	//1807
-1.503406653856068,	//1808
-1.500854699461629,	//1809
-1.498307076876695,	//1810
-1.495763778748243,	//1811
-1.493224797735735,	//1812
-1.490690126511091,	//1813
-1.488159757758672,	//1814
-1.485633684175255,	//1815
-1.483111898470015,	//1816
-1.480594393364502,	//1817
-1.478081161592621,	//1818
-1.475572195900612,	//1819
-1.473067489047026,	//1820
-1.470567033802707,	//1821
-1.46807082295077,	//1822
-1.465578849286581,	//1823
-1.463091105617734,	//1824
-1.460607584764032,	//1825
-1.458128279557468,	//1826
-1.455653182842199,	//1827
-1.453182287474532,	//1828
-1.450715586322898,	//1829
-1.448253072267834,	//1830
-1.445794738201962,	//1831
-1.443340577029968,	//1832
-1.440890581668582,	//1833
-1.438444745046559,	//1834
-1.436003060104655,	//1835
-1.43356551979561,	//1836
-1.431132117084124,	//1837
-1.428702844946844,	//1838
-1.426277696372333,	//1839
-1.423856664361059,	//1840
-1.421439741925371,	//1841
-1.419026922089479,	//1842
-1.416618197889433,	//1843
-1.414213562373106,	//1844
-1.411813008600169,	//1845
-1.409416529642076,	//1846
-1.407024118582041,	//1847
-1.40463576851502,	//1848
-1.402251472547689,	//1849
-1.399871223798425,	//1850
-1.397495015397287,	//1851
-1.395122840485993,	//1852
-1.392754692217906,	//1853
-1.390390563758008,	//1854
-1.388030448282885,	//1855
-1.385674338980705,	//1856
-1.383322229051197,	//1857
-1.380974111705636,	//1858
-1.378629980166818,	//1859
-1.376289827669043,	//1860
-1.373953647458098,	//1861
-1.371621432791233,	//1862
-1.369293176937144,	//1863
-1.366968873175951,	//1864
-1.364648514799184,	//1865
-1.362332095109758,	//1866
-1.360019607421957,	//1867
-1.357711045061413,	//1868
-1.355406401365088,	//1869
-1.353105669681254,	//1870
-1.350808843369473,	//1871
-1.34851591580058,	//1872
-1.346226880356663,	//1873
-1.343941730431042,	//1874
-1.341660459428252,	//1875
-1.339383060764024,	//1876
-1.337109527865266,	//1877
-1.334839854170043,	//1878
-1.332574033127556,	//1879
-1.33031205819813,	//1880
-1.328053922853188,	//1881
-1.325799620575236,	//1882
-1.323549144857841,	//1883
-1.321302489205618,	//1884
-1.319059647134205,	//1885
-1.316820612170247,	//1886
-1.314585377851378,	//1887
-1.312353937726201,	//1888
-1.31012628535427,	//1889
-1.307902414306071,	//1890
-1.305682318163005,	//1891
-1.303465990517368,	//1892
-1.30125342497233,	//1893
-1.299044615141923,	//1894
-1.296839554651017,	//1895
-1.294638237135304,	//1896
-1.292440656241277,	//1897
-1.290246805626218,	//1898
-1.288056678958172,	//1899
-1.285870269915933,	//1900
-1.283687572189025,	//1901
-1.281508579477684,	//1902
-1.279333285492839,	//1903
-1.277161683956095,	//1904
-1.274993768599713,	//1905
-1.272829533166596,	//1906
-1.270668971410264,	//1907
-1.268512077094844,	//1908
-1.266358843995045,	//1909
-1.264209265896145,	//1910
-1.262063336593971,	//1911
-1.259921049894879,	//1912
-1.257782399615743,	//1913
-1.255647379583928,	//1914
-1.253515983637278,	//1915
-1.251388205624099,	//1916
-1.249264039403137,	//1917
-1.247143478843562,	//1918
-1.245026517824953,	//1919
-1.242913150237277,	//1920
-1.240803369980872,	//1921
-1.23869717096643,	//1922
-1.23659454711498,	//1923
-1.234495492357869,	//1924
-1.232400000636745,	//1925
-1.230308065903542,	//1926
-1.228219682120456,	//1927
-1.226134843259936,	//1928
-1.224053543304661,	//1929
-1.221975776247522,	//1930
-1.219901536091611,	//1931
-1.217830816850196,	//1932
-1.215763612546708,	//1933
-1.213699917214723,	//1934
-1.211639724897946,	//1935
-1.209583029650191,	//1936
-1.207529825535364,	//1937
-1.205480106627452,	//1938
-1.203433867010495,	//1939
-1.20139110077858,	//1940
-1.199351802035816,	//1941
-1.197315964896322,	//1942
-1.195283583484205,	//1943
-1.193254651933551,	//1944
-1.191229164388397,	//1945
-1.189207115002725,	//1946
-1.187188497940439,	//1947
-1.185173307375348,	//1948
-1.183161537491151,	//1949
-1.181153182481423,	//1950
-1.17914823654959,	//1951
-1.177146693908922,	//1952
-1.175148548782509,	//1953
-1.173153795403247,	//1954
-1.171162428013823,	//1955
-1.169174440866696,	//1956
-1.16718982822408,	//1957
-1.165208584357931,	//1958
-1.163230703549925,	//1959
-1.161256180091448,	//1960
-1.159285008283572,	//1961
-1.157317182437047,	//1962
-1.155352696872277,	//1963
-1.153391545919308,	//1964
-1.15143372391781,	//1965
-1.149479225217062,	//1966
-1.147528044175935,	//1967
-1.145580175162874,	//1968
-1.143635612555884,	//1969
-1.141694350742513,	//1970
-1.139756384119836,	//1971
-1.137821707094439,	//1972
-1.135890314082402,	//1973
-1.133962199509284,	//1974
-1.132037357810105,	//1975
-1.130115783429333,	//1976
-1.128197470820865,	//1977
-1.126282414448012,	//1978
-1.124370608783485,	//1979
-1.122462048309376,	//1980
-1.120556727517143,	//1981
-1.118654640907594,	//1982
-1.116755782990875,	//1983
-1.114860148286446,	//1984
-1.112967731323074,	//1985
-1.11107852663881,	//1986
-1.109192528780979,	//1987
-1.107309732306158,	//1988
-1.105430131780169,	//1989
-1.103553721778054,	//1990
-1.101680496884066,	//1991
-1.09981045169165,	//1992
-1.097943580803427,	//1993
-1.096079878831183,	//1994
-1.094219340395847,	//1995
-1.09236196012748,	//1996
-1.09050773266526,	//1997
-1.088656652657461,	//1998
-1.086808714761444,	//1999
-1.084963913643639,	//2000
-1.083122243979527,	//2001
-1.08128370045363,	//2002
-1.079448277759491,	//2003
-1.07761597059966,	//2004
-1.075786773685681,	//2005
-1.073960681738074,	//2006
-1.072137689486319,	//2007
-1.070317791668845,	//2008
-1.068500983033012,	//2009
-1.066687258335094,	//2010
-1.064876612340267,	//2011
-1.063069039822594,	//2012
-1.061264535565008,	//2013
-1.059463094359297,	//2014
-1.057664711006089,	//2015
-1.055869380314841,	//2016
-1.054077097103817,	//2017
-1.052287856200079,	//2018
-1.050501652439469,	//2019
-1.048718480666594,	//2020
-1.046938335734814,	//2021
-1.045161212506224,	//2022
-1.04338710585164,	//2023
-1.041616010650585,	//2024
-1.039847921791273,	//2025
-1.038082834170597,	//2026
-1.036320742694111,	//2027
-1.034561642276015,	//2028
-1.032805527839144,	//2029
-1.031052394314952,	//2030
-1.029302236643493,	//2031
-1.027555049773413,	//2032
-1.025810828661932,	//2033
-1.024069568274829,	//2034
-1.022331263586429,	//2035
-1.020595909579587,	//2036
-1.018863501245676,	//2037
-1.017134033584569,	//2038
-1.015407501604628,	//2039
-1.013683900322686,	//2040
-1.011963224764037,	//2041
-1.010245469962418,	//2042
-1.008530630959997,	//2043
-1.006818702807355,	//2044
-1.005109680563479,	//2045
-1.003403559295738,	//2046
-1.001700334079877,	//2047
-1,	//2048
-0.9983025521485532,	//2049
-0.9966079856263149,	//2050
-0.9949162955423789,	//2051
-0.9932274770141412,	//2052
-0.9915415251672857,	//2053
-0.9898584351357702,	//2054
-0.9881782020618126,	//2055
-0.9865008210958763,	//2056
-0.9848262873966567,	//2057
-0.9831545961310669,	//2058
-0.9814857424742243,	//2059
-0.9798197216094359,	//2060
-0.9781565287281848,	//2061
-0.9764961590301166,	//2062
-0.9748386077230249,	//2063
-0.9731838700228381,	//2064
-0.9715319411536053,	//2065
-0.9698828163474822,	//2066
-0.9682364908447181,	//2067
-0.9665929598936414,	//2068
-0.9649522187506464,	//2069
-0.9633142626801794,	//2070
-0.9616790869547249,	//2071
-0.9600466868547923,	//2072
-0.9584170576689022,	//2073
-0.9567901946935722,	//2074
-0.9551660932333043,	//2075
-0.9535447486005707,	//2076
-0.9519261561158003,	//2077
-0.9503103111073656,	//2078
-0.9486972089115687,	//2079
-0.9470868448726283,	//2080
-0.9454792143426658,	//2081
-0.9438743126816923,	//2082
-0.942272135257595,	//2083
-0.9406726774461239,	//2084
-0.9390759346308784,	//2085
-0.9374819022032939,	//2086
-0.9358905755626287,	//2087
-0.9343019501159506,	//2088
-0.9327160212781238,	//2089
-0.9311327844717954,	//2090
-0.9295522351273821,	//2091
-0.9279743686830576,	//2092
-0.9263991805847389,	//2093
-0.9248266662860734,	//2094
-0.9232568212484255,	//2095
-0.9216896409408638,	//2096
-0.920125120840148,	//2097
-0.9185632564307158,	//2098
-0.9170040432046695,	//2099
-0.9154474766617637,	//2100
-0.913893552309392,	//2101
-0.9123422656625734,	//2102
-0.9107936122439404,	//2103
-0.9092475875837255,	//2104
-0.9077041872197484,	//2105
-0.906163406697403,	//2106
-0.9046252415696449,	//2107
-0.903089687396978,	//2108
-0.9015567397474423,	//2109
-0.9000263941966007,	//2110
-0.8984986463275264,	//2111
-0.8969734917307899,	//2112
-0.8954509260044469,	//2113
-0.8939309447540246,	//2114
-0.8924135435925101,	//2115
-0.8908987181403371,	//2116
-0.8893864640253731,	//2117
-0.8878767768829074,	//2118
-0.8863696523556381,	//2119
-0.8848650860936594,	//2120
-0.8833630737544496,	//2121
-0.8818636110028577,	//2122
-0.8803666935110919,	//2123
-0.8788723169587062,	//2124
-0.8773804770325886,	//2125
-0.8758911694269483,	//2126
-0.8744043898433035,	//2127
-0.8729201339904683,	//2128
-0.8714383975845417,	//2129
-0.8699591763488935,	//2130
-0.8684824660141538,	//2131
-0.8670082623181989,	//2132
-0.8655365610061403,	//2133
-0.8640673578303119,	//2134
-0.8626006485502575,	//2135
-0.8611364289327194,	//2136
-0.8596746947516251,	//2137
-0.8582154417880757,	//2138
-0.8567586658303342,	//2139
-0.8553043626738122,	//2140
-0.8538525281210585,	//2141
-0.852403157981747,	//2142
-0.8509562480726645,	//2143
-0.8495117942176984,	//2144
-0.8480697922478249,	//2145
-0.8466302380010969,	//2146
-0.8451931273226322,	//2147
-0.8437584560646009,	//2148
-0.8423262200862139,	//2149
-0.8408964152537114,	//2150
-0.8394690374403497,	//2151
-0.8380440825263905,	//2152
-0.8366215463990885,	//2153
-0.8352014249526793,	//2154
-0.8337837140883682,	//2155
-0.8323684097143176,	//2156
-0.8309555077456359,	//2157
-0.8295450041043653,	//2158
-0.8281368947194699,	//2159
-0.8267311755268246,	//2160
-0.8253278424692025,	//2161
-0.8239268914962641,	//2162
-0.8225283185645446,	//2163
-0.821132119637443,	//2164
-0.8197382906852106,	//2165
-0.8183468276849384,	//2166
-0.8169577266205463,	//2167
-0.8155709834827715,	//2168
-0.8141865942691564,	//2169
-0.8128045549840375,	//2170
-0.8114248616385337,	//2171
-0.8100475102505349,	//2172
-0.8086724968446903,	//2173
-0.8072998174523973,	//2174
-0.8059294681117894,	//2175
-0.8045614448677254,	//2176
-0.8031957437717778,	//2177
-0.8018323608822213,	//2178
-0.8004712922640214,	//2179
-0.799112533988823,	//2180
-0.7977560821349395,	//2181
-0.7964019327873409,	//2182
-0.7950500820376432,	//2183
-0.7937005259840958,	//2184
-0.792353260731572,	//2185
-0.7910082823915563,	//2186
-0.7896655870821342,	//2187
-0.7883251709279803,	//2188
-0.7869870300603472,	//2189
-0.7856511606170548,	//2190
-0.7843175587424788,	//2191
-0.7829862205875394,	//2192
-0.7816571423096906,	//2193
-0.7803303200729091,	//2194
-0.7790057500476826,	//2195
-0.7776834284109996,	//2196
-0.7763633513463376,	//2197
-0.7750455150436527,	//2198
-0.7737299156993684,	//2199
-0.7724165495163645,	//2200
-0.771105412703966,	//2201
-0.7697965014779328,	//2202
-0.7684898120604479,	//2203
-0.7671853406801071,	//2204
-0.7658830835719083,	//2205
-0.7645830369772397,	//2206
-0.7632851971438701,	//2207
-0.7619895603259372,	//2208
-0.7606961227839371,	//2209
-0.7594048807847137,	//2210
-0.7581158306014475,	//2211
-0.7568289685136453,	//2212
-0.7555442908071291,	//2213
-0.7542617937740258,	//2214
-0.7529814737127557,	//2215
-0.7517033269280228,	//2216
-0.7504273497308035,	//2217
-0.7491535384383361,	//2218
-0.7478818893741102,	//2219
-0.7466123988678562,	//2220
-0.7453450632555345,	//2221
-0.7440798788793249,	//2222
-0.7428168420876164,	//2223
-0.7415559492349965,	//2224
-0.7402971966822399,	//2225
-0.7390405807962996,	//2226
-0.737786097950295,	//2227
-0.7365337445235021,	//2228
-0.7352835169013426,	//2229
-0.7340354114753742,	//2230
-0.7327894246432796,	//2231
-0.7315455528088559,	//2232
-0.7303037923820052,	//2233
-0.729064139778723,	//2234
-0.7278265914210886,	//2235
-0.7265911437372552,	//2236
-0.7253577931614381,	//2237
-0.7241265361339061,	//2238
-0.72289736910097,	//2239
-0.7216702885149732,	//2240
-0.7204452908342804,	//2241
-0.7192223725232689,	//2242
-0.7180015300523168,	//2243
-0.7167827598977941,	//2244
-0.7155660585420516,	//2245
-0.7143514224734111,	//2246
-0.7131388481861557,	//2247
-0.711928332180519,	//2248
-0.7107198709626751,	//2249
-0.709513461044729,	//2250
-0.7083090989447061,	//2251
-0.7071067811865422,	//2252
-0.7059065043000737,	//2253
-0.7047082648210273,	//2254
-0.7035120592910101,	//2255
-0.7023178842574997,	//2256
-0.7011257362738342,	//2257
-0.6999356118992022,	//2258
-0.6987475076986328,	//2259
-0.6975614202429861,	//2260
-0.6963773461089424,	//2261
-0.6951952818789937,	//2262
-0.6940152241414322,	//2263
-0.692837169490342,	//2264
-0.6916611145255883,	//2265
-0.6904870558528076,	//2266
-0.6893149900833985,	//2267
-0.6881449138345114,	//2268
-0.686976823729039,	//2269
-0.6858107163956064,	//2270
-0.6846465884685615,	//2271
-0.6834844365879653,	//2272
-0.6823242573995818,	//2273
-0.6811660475548689,	//2274
-0.6800098037109684,	//2275
-0.6788555225306965,	//2276
-0.677703200682534,	//2277
-0.6765528348406169,	//2278
-0.6754044216847265,	//2279
-0.6742579579002801,	//2280
-0.6731134401783214,	//2281
-0.6719708652155109,	//2282
-0.670830229714116,	//2283
-0.6696915303820022,	//2284
-0.6685547639326233,	//2285
-0.6674199270850113,	//2286
-0.6662870165637682,	//2287
-0.6651560290990551,	//2288
-0.6640269614265841,	//2289
-0.6628998102876079,	//2290
-0.6617745724289107,	//2291
-0.6606512446027992,	//2292
-0.6595298235670926,	//2293
-0.6584103060851135,	//2294
-0.657292688925679,	//2295
-0.6561769688630905,	//2296
-0.6550631426771251,	//2297
-0.6539512071530258,	//2298
-0.6528411590814929,	//2299
-0.651732995258674,	//2300
-0.6506267124861552,	//2301
-0.6495223075709518,	//2302
-0.6484197773254987,	//2303
-0.647319118567642,	//2304
-0.646220328120629,	//2305
-0.6451234028130994,	//2306
-0.6440283394790763,	//2307
-0.6429351349579567,	//2308
-0.6418437860945028,	//2309
-0.6407542897388322,	//2310
-0.6396666427464098,	//2311
-0.6385808419780378,	//2312
-0.6374968842998471,	//2313
-0.6364147665832883,	//2314
-0.6353344857051225,	//2315
-0.6342560385474124,	//2316
-0.633179421997513,	//2317
-0.6321046329480631,	//2318
-0.6310316682969759,	//2319
-0.6299605249474303,	//2320
-0.628891199807862,	//2321
-0.6278236897919545,	//2322
-0.6267579918186297,	//2323
-0.6256941028120401,	//2324
-0.6246320197015589,	//2325
-0.6235717394217717,	//2326
-0.6225132589124673,	//2327
-0.6214565751186293,	//2328
-0.6204016849904267,	//2329
-0.6193485854832057,	//2330
-0.6182972735574808,	//2331
-0.6172477461789252,	//2332
-0.6162000003183634,	//2333
-0.6151540329517616,	//2334
-0.6141098410602188,	//2335
-0.6130674216299589,	//2336
-0.6120267716523211,	//2337
-0.610987888123752,	//2338
-0.6099507680457964,	//2339
-0.6089154084250887,	//2340
-0.6078818062733448,	//2341
-0.6068499586073526,	//2342
-0.605819862448964,	//2343
-0.6047915148250862,	//2344
-0.6037649127676732,	//2345
-0.6027400533137167,	//2346
-0.6017169335052385,	//2347
-0.6006955503892809,	//2348
-0.599675901017899,	//2349
-0.5986579824481518,	//2350
-0.5976417917420938,	//2351
-0.5966273259667664,	//2352
-0.5956145821941897,	//2353
-0.5946035575013539,	//2354
-0.5935942489702106,	//2355
-0.5925866536876649,	//2356
-0.5915807687455669,	//2357
-0.5905765912407025,	//2358
-0.5895741182747862,	//2359
-0.5885733469544521,	//2360
-0.5875742743912454,	//2361
-0.5865768977016147,	//2362
-0.5855812140069028,	//2363
-0.5845872204333392,	//2364
-0.5835949141120315,	//2365
-0.5826042921789567,	//2366
-0.5816153517749539,	//2367
-0.580628090045715,	//2368
-0.5796425041417773,	//2369
-0.5786585912185147,	//2370
-0.5776763484361297,	//2371
-0.5766957729596451,	//2372
-0.5757168619588964,	//2373
-0.5747396126085226,	//2374
-0.573764022087959,	//2375
-0.5727900875814284,	//2376
-0.5718178062779332,	//2377
-0.5708471753712477,	//2378
-0.5698781920599094,	//2379
-0.568910853547211,	//2380
-0.5679451570411925,	//2381
-0.5669810997546334,	//2382
-0.566018678905044,	//2383
-0.5650578917146579,	//2384
-0.5640987354104239,	//2385
-0.5631412072239976,	//2386
-0.5621853043917342,	//2387
-0.5612310241546795,	//2388
-0.5602783637585629,	//2389
-0.5593273204537889,	//2390
-0.558377891495429,	//2391
-0.5574300741432148,	//2392
-0.5564838656615286,	//2393
-0.5555392633193967,	//2394
-0.5545962643904809,	//2395
-0.5536548661530709,	//2396
-0.5527150658900764,	//2397
-0.551776860889019,	//2398
-0.5508402484420249,	//2399
-0.5499052258458166,	//2400
-0.5489717904017053,	//2401
-0.548039939415583,	//2402
-0.5471096701979151,	//2403
-0.5461809800637319,	//2404
-0.5452538663326216,	//2405
-0.5443283263287223,	//2406
-0.543404357380714,	//2407
-0.5424819568218114,	//2408
-0.5415611219897556,	//2409
-0.540641850226807,	//2410
-0.5397241388797374,	//2411
-0.538807985299822,	//2412
-0.5378933868428325,	//2413
-0.5369803408690287,	//2414
-0.5360688447431514,	//2415
-0.5351588958344147,	//2416
-0.5342504915164979,	//2417
-0.5333436291675389,	//2418
-0.5324383061701257,	//2419
-0.5315345199112892,	//2420
-0.5306322677824961,	//2421
-0.5297315471796403,	//2422
-0.5288323555030368,	//2423
-0.5279346901574126,	//2424
-0.5270385485519007,	//2425
-0.5261439281000316,	//2426
-0.5252508262197265,	//2427
-0.5243592403332893,	//2428
-0.5234691678673993,	//2429
-0.5225806062531041,	//2430
-0.5216935529258121,	//2431
-0.5208080053252846,	//2432
-0.5199239608956289,	//2433
-0.5190414170852909,	//2434
-0.5181603713470476,	//2435
-0.5172808211379998,	//2436
-0.5164027639195645,	//2437
-0.5155261971574681,	//2438
-0.5146511183217386,	//2439
-0.5137775248866987,	//2440
-0.5129054143309582,	//2441
-0.5120347841374067,	//2442
-0.5111656317932067,	//2443
-0.5102979547897859,	//2444
-0.5094317506228303,	//2445
-0.5085670167922769,	//2446
-0.5077037508023061,	//2447
-0.5068419501613353,	//2448
-0.5059816123820109,	//2449
-0.5051227349812015,	//2450
-0.5042653154799908,	//2451
-0.5034093514036702,	//2452
-0.5025548402817318,	//2453
-0.5017017796478614,	//2454
-0.5008501670399311,	//2455
-0.4999999999999925,	//2456
-0.4991512760742692,	//2457
-0.49830399281315,	//2458
-0.497458147771182,	//2459
-0.4966137385070631,	//2460
-0.4957707625836354,	//2461
-0.4949292175678777,	//2462
-0.4940891010308989,	//2463
-0.4932504105479307,	//2464
-0.492413143698321,	//2465
-0.4915772980655261,	//2466
-0.4907428712371048,	//2467
-0.4899098608047106,	//2468
-0.4890782643640851,	//2469
-0.4882480795150509,	//2470
-0.4874193038615051,	//2471
-0.4865919350114118,	//2472
-0.4857659705767953,	//2473
-0.4849414081737338,	//2474
-0.4841182454223518,	//2475
-0.4832964799468135,	//2476
-0.482476109375316,	//2477
-0.4816571313400825,	//2478
-0.4808395434773552,	//2479
-0.480023343427389,	//2480
-0.4792085288344439,	//2481
-0.4783950973467789,	//2482
-0.477583046616645,	//2483
-0.4767723743002782,	//2484
-0.475963078057893,	//2485
-0.4751551555536757,	//2486
-0.4743486044557773,	//2487
-0.473543422436307,	//2488
-0.4727396071713258,	//2489
-0.4719371563408391,	//2490
-0.4711360676287905,	//2491
-0.4703363387230549,	//2492
-0.4695379673154321,	//2493
-0.4687409511016399,	//2494
-0.4679452877813073,	//2495
-0.4671509750579683,	//2496
-0.4663580106390549,	//2497
-0.4655663922358907,	//2498
-0.4647761175636841,	//2499
-0.4639871843415219,	//2500
-0.4631995902923625,	//2501
-0.4624133331430297,	//2502
-0.4616284106242058,	//2503
-0.460844820470425,	//2504
-0.4600625604200671,	//2505
-0.459281628215351,	//2506
-0.4585020216023279,	//2507
-0.457723738330875,	//2508
-0.4569467761546891,	//2509
-0.4561711328312799,	//2510
-0.4553968061219634,	//2511
-0.4546237937918559,	//2512
-0.4538520936098674,	//2513
-0.4530817033486947,	//2514
-0.4523126207848157,	//2515
-0.4515448436984822,	//2516
-0.4507783698737144,	//2517
-0.4500131970982936,	//2518
-0.4492493231637564,	//2519
-0.4484867458653882,	//2520
-0.4477254630022167,	//2521
-0.4469654723770056,	//2522
-0.4462067717962484,	//2523
-0.4454493590701619,	//2524
-0.4446932320126799,	//2525
-0.4439383884414471,	//2526
-0.4431848261778124,	//2527
-0.4424325430468231,	//2528
-0.4416815368772182,	//2529
-0.4409318055014222,	//2530
-0.4401833467555393,	//2531
-0.4394361584793465,	//2532
-0.4386902385162877,	//2533
-0.4379455847134676,	//2534
-0.4372021949216451,	//2535
-0.4364600669952276,	//2536
-0.4357191987922643,	//2537
-0.4349795881744403,	//2538
-0.4342412330070704,	//2539
-0.433504131159093,	//2540
-0.4327682805030637,	//2541
-0.4320336789151494,	//2542
-0.4313003242751223,	//2543
-0.4305682144663532,	//2544
-0.4298373473758061,	//2545
-0.4291077208940314,	//2546
-0.4283793329151607,	//2547
-0.4276521813368996,	//2548
-0.4269262640605228,	//2549
-0.4262015789908671,	//2550
-0.4254781240363258,	//2551
-0.4247558971088428,	//2552
-0.4240348961239061,	//2553
-0.4233151190005421,	//2554
-0.4225965636613098,	//2555
-0.4218792280322941,	//2556
-0.4211631100431007,	//2557
-0.4204482076268494,	//2558
-0.4197345187201686,	//2559
-0.419022041263189,	//2560
-0.418310773199538,	//2561
-0.4176007124763334,	//2562
-0.4168918570441778,	//2563
-0.4161842048571526,	//2564
-0.4154777538728117,	//2565
-0.4147725020521764,	//2566
-0.4140684473597288,	//2567
-0.4133655877634061,	//2568
-0.4126639212345951,	//2569
-0.4119634457481259,	//2570
-0.4112641592822661,	//2571
-0.4105660598187154,	//2572
-0.4098691453425992,	//2573
-0.409173413842463,	//2574
-0.4084788633102671,	//2575
-0.4077854917413796,	//2576
-0.4070932971345721,	//2577
-0.4064022774920126,	//2578
-0.4057124308192608,	//2579
-0.4050237551252614,	//2580
-0.4043362484223391,	//2581
-0.4036499087261926,	//2582
-0.4029647340558887,	//2583
-0.4022807224338567,	//2584
-0.4015978718858829,	//2585
-0.4009161804411047,	//2586
-0.4002356461320047,	//2587
-0.3995562669944055,	//2588
-0.3988780410674638,	//2589
-0.3982009663936645,	//2590
-0.3975250410188156,	//2591
-0.396850262992042,	//2592
-0.39617663036578,	//2593
-0.3955041411957722,	//2594
-0.3948327935410612,	//2595
-0.3941625854639842,	//2596
-0.3934935150301677,	//2597
-0.3928255803085215,	//2598
-0.3921587793712335,	//2599
-0.3914931102937638,	//2600
-0.3908285711548395,	//2601
-0.3901651600364487,	//2602
-0.3895028750238355,	//2603
-0.3888417142054939,	//2604
-0.388181675673163,	//2605
-0.3875227575218205,	//2606
-0.3868649578496784,	//2607
-0.3862082747581765,	//2608
-0.3855527063519772,	//2609
-0.3848982507389606,	//2610
-0.3842449060302182,	//2611
-0.3835926703400478,	//2612
-0.3829415417859484,	//2613
-0.3822915184886141,	//2614
-0.3816425985719293,	//2615
-0.3809947801629629,	//2616
-0.3803480613919629,	//2617
-0.3797024403923511,	//2618
-0.379057915300718,	//2619
-0.378414484256817,	//2620
-0.3777721454035589,	//2621
-0.3771308968870072,	//2622
-0.3764907368563722,	//2623
-0.3758516634640058,	//2624
-0.3752136748653961,	//2625
-0.3745767692191624,	//2626
-0.3739409446870495,	//2627
-0.3733061994339225,	//2628
-0.3726725316277616,	//2629
-0.3720399394396569,	//2630
-0.3714084210438027,	//2631
-0.3707779746174927,	//2632
-0.3701485983411144,	//2633
-0.3695202903981443,	//2634
-0.368893048975142,	//2635
-0.3682668722617455,	//2636
-0.3676417584506658,	//2637
-0.3670177057376816,	//2638
-0.3663947123216343,	//2639
-0.3657727764044225,	//2640
-0.3651518961909971,	//2641
-0.364532069889356,	//2642
-0.3639132957105389,	//2643
-0.3632955718686221,	//2644
-0.3626788965807136,	//2645
-0.3620632680669476,	//2646
-0.3614486845504796,	//2647
-0.3608351442574811,	//2648
-0.3602226454171348,	//2649
-0.3596111862616291,	//2650
-0.359000765026153,	//2651
-0.3583913799488916,	//2652
-0.3577830292710204,	//2653
-0.3571757112367002,	//2654
-0.3565694240930725,	//2655
-0.3559641660902541,	//2656
-0.3553599354813322,	//2657
-0.3547567305223592,	//2658
-0.3541545494723477,	//2659
-0.3535533905932658,	//2660
-0.3529532521500315,	//2661
-0.3523541324105083,	//2662
-0.3517560296454998,	//2663
-0.3511589421287446,	//2664
-0.3505628681369118,	//2665
-0.3499678059495959,	//2666
-0.3493737538493112,	//2667
-0.3487807101214878,	//2668
-0.348188673054466,	//2669
-0.3475976409394916,	//2670
-0.3470076120707109,	//2671
-0.3464185847451658,	//2672
-0.3458305572627889,	//2673
-0.3452435279263986,	//2674
-0.3446574950416941,	//2675
-0.3440724569172505,	//2676
-0.3434884118645143,	//2677
-0.342905358197798,	//2678
-0.3423232942342757,	//2679
-0.3417422182939775,	//2680
-0.3411621286997857,	//2681
-0.3405830237774293,	//2682
-0.3400049018554791,	//2683
-0.3394277612653431,	//2684
-0.3388516003412619,	//2685
-0.3382764174203033,	//2686
-0.3377022108423582,	//2687
-0.337128978950135,	//2688
-0.3365567200891557,	//2689
-0.3359854326077504,	//2690
-0.3354151148570529,	//2691
-0.3348457651909961,	//2692
-0.3342773819663066,	//2693
-0.3337099635425007,	//2694
-0.3331435082818791,	//2695
-0.3325780145495226,	//2696
-0.3320134807132871,	//2697
-0.331449905143799,	//2698
-0.3308872862144504,	//2699
-0.3303256223013947,	//2700
-0.3297649117835413,	//2701
-0.3292051530425518,	//2702
-0.3286463444628346,	//2703
-0.3280884844315403,	//2704
-0.3275315713385576,	//2705
-0.326975603576508,	//2706
-0.3264205795407416,	//2707
-0.3258664976293321,	//2708
-0.3253133562430727,	//2709
-0.324761153785471,	//2710
-0.3242098886627445,	//2711
-0.3236595592838162,	//2712
-0.3231101640603096,	//2713
-0.3225617014065449,	//2714
-0.3220141697395333,	//2715
-0.3214675674789736,	//2716
-0.3209218930472466,	//2717
-0.3203771448694113,	//2718
-0.3198333213732001,	//2719
-0.3192904209890141,	//2720
-0.3187484421499188,	//2721
-0.3182073832916394,	//2722
-0.3176672428525565,	//2723
-0.3171280192737014,	//2724
-0.3165897109987518,	//2725
-0.3160523164740268,	//2726
-0.3155158341484832,	//2727
-0.3149802624737104,	//2728
-0.3144455999039263,	//2729
-0.3139118448959725,	//2730
-0.3133789959093102,	//2731
-0.3128470514060154,	//2732
-0.3123160098507748,	//2733
-0.3117858697108812,	//2734
-0.311256629456229,	//2735
-0.31072828755931,	//2736
-0.3102008424952087,	//2737
-0.3096742927415982,	//2738
-0.3091486367787357,	//2739
-0.308623873089458,	//2740
-0.3081000001591771,	//2741
-0.3075770164758762,	//2742
-0.3070549205301048,	//2743
-0.3065337108149748,	//2744
-0.3060133858261559,	//2745
-0.3054939440618714,	//2746
-0.3049753840228936,	//2747
-0.3044577042125398,	//2748
-0.3039409031366678,	//2749
-0.3034249793036717,	//2750
-0.3029099312244775,	//2751
-0.3023957574125386,	//2752
-0.301882456383832,	//2753
-0.3013700266568539,	//2754
-0.3008584667526147,	//2755
-0.300347775194636,	//2756
-0.299837950508945,	//2757
-0.2993289912240714,	//2758
-0.2988208958710424,	//2759
-0.2983136629833787,	//2760
-0.2978072910970904,	//2761
-0.2973017787506725,	//2762
-0.2967971244851009,	//2763
-0.296293326843828,	//2764
-0.295790384372779,	//2765
-0.2952882956203468,	//2766
-0.2947870591373887,	//2767
-0.2942866734772216,	//2768
-0.2937871371956183,	//2769
-0.2932884488508029,	//2770
-0.292790607003447,	//2771
-0.2922936102166652,	//2772
-0.2917974570560113,	//2773
-0.291302146089474,	//2774
-0.2908076758874726,	//2775
-0.2903140450228532,	//2776
-0.2898212520708843,	//2777
-0.289329295609253,	//2778
-0.2888381742180605,	//2779
-0.2883478864798182,	//2780
-0.2878584309794439,	//2781
-0.287369806304257,	//2782
-0.2868820110439751,	//2783
-0.2863950437907098,	//2784
-0.2859089031389623,	//2785
-0.2854235876856196,	//2786
-0.2849390960299504,	//2787
-0.2844554267736012,	//2788
-0.283972578520592,	//2789
-0.2834905498773125,	//2790
-0.2830093394525178,	//2791
-0.2825289458573247,	//2792
-0.2820493677052077,	//2793
-0.2815706036119946,	//2794
-0.2810926521958629,	//2795
-0.2806155120773355,	//2796
-0.2801391818792772,	//2797
-0.2796636602268902,	//2798
-0.2791889457477104,	//2799
-0.2787150370716032,	//2800
-0.2782419328307602,	//2801
-0.2777696316596942,	//2802
-0.2772981321952363,	//2803
-0.2768274330765313,	//2804
-0.276357532945034,	//2805
-0.2758884304445053,	//2806
-0.2754201242210083,	//2807
-0.2749526129229042,	//2808
-0.2744858952008485,	//2809
-0.2740199697077874,	//2810
-0.2735548350989535,	//2811
-0.2730904900318619,	//2812
-0.2726269331663068,	//2813
-0.2721641631643571,	//2814
-0.271702178690353,	//2815
-0.2712409784109016,	//2816
-0.2707805609948737,	//2817
-0.2703209251133994,	//2818
-0.2698620694398646,	//2819
-0.2694039926499069,	//2820
-0.2689466934214122,	//2821
-0.2684901704345103,	//2822
-0.2680344223715717,	//2823
-0.2675794479172033,	//2824
-0.267125245758245,	//2825
-0.2666718145837654,	//2826
-0.2662191530850588,	//2827
-0.2657672599556407,	//2828
-0.265316133891244,	//2829
-0.2648657735898162,	//2830
-0.2644161777515144,	//2831
-0.2639673450787023,	//2832
-0.2635192742759464,	//2833
-0.2630719640500119,	//2834
-0.2626254131098593,	//2835
-0.2621796201666407,	//2836
-0.2617345839336957,	//2837
-0.2612903031265482,	//2838
-0.2608467764629021,	//2839
-0.2604040026626384,	//2840
-0.2599619804478105,	//2841
-0.2595207085426416,	//2842
-0.2590801856735199,	//2843
-0.258640410568996,	//2844
-0.2582013819597784,	//2845
-0.2577630985787301,	//2846
-0.2573255591608655,	//2847
-0.2568887624433455,	//2848
-0.2564527071654752,	//2849
-0.2560173920686995,	//2850
-0.2555828158965995,	//2851
-0.2551489773948891,	//2852
-0.2547158753114113,	//2853
-0.2542835083961346,	//2854
-0.2538518754011493,	//2855
-0.2534209750806639,	//2856
-0.2529908061910017,	//2857
-0.2525613674905969,	//2858
-0.2521326577399916,	//2859
-0.2517046757018313,	//2860
-0.2512774201408621,	//2861
-0.2508508898239269,	//2862
-0.2504250835199618,	//2863
-0.2499999999999925,	//2864
-0.2495756380371308,	//2865
-0.2491519964065713,	//2866
-0.2487290738855873,	//2867
-0.2483068692535279,	//2868
-0.247885381291814,	//2869
-0.2474646087839351,	//2870
-0.2470445505154457,	//2871
-0.2466252052739617,	//2872
-0.2462065718491568,	//2873
-0.2457886490327594,	//2874
-0.2453714356185487,	//2875
-0.2449549304023516,	//2876
-0.2445391321820388,	//2877
-0.2441240397575218,	//2878
-0.2437096519307489,	//2879
-0.2432959675057022,	//2880
-0.242882985288394,	//2881
-0.2424707040868633,	//2882
-0.2420591227111722,	//2883
-0.2416482399734031,	//2884
-0.2412380546876544,	//2885
-0.2408285656700376,	//2886
-0.240419771738674,	//2887
-0.2400116717136909,	//2888
-0.2396042644172184,	//2889
-0.2391975486733859,	//2890
-0.2387915233083189,	//2891
-0.2383861871501355,	//2892
-0.237981539028943,	//2893
-0.2375775777768343,	//2894
-0.2371743022278851,	//2895
-0.23677171121815,	//2896
-0.2363698035856594,	//2897
-0.235968578170416,	//2898
-0.2355680338143917,	//2899
-0.2351681693615239,	//2900
-0.2347689836577125,	//2901
-0.2343704755508164,	//2902
-0.2339726438906501,	//2903
-0.2335754875289807,	//2904
-0.233179005319524,	//2905
-0.2327831961179418,	//2906
-0.2323880587818385,	//2907
-0.2319935921707574,	//2908
-0.2315997951461778,	//2909
-0.2312066665715114,	//2910
-0.2308142053120994,	//2911
-0.230422410235209,	//2912
-0.2300312802100301,	//2913
-0.229640814107672,	//2914
-0.2292510108011605,	//2915
-0.2288618691654341,	//2916
-0.2284733880773411,	//2917
-0.2280855664156365,	//2918
-0.2276984030609783,	//2919
-0.2273118968959246,	//2920
-0.2269260468049303,	//2921
-0.226540851674344,	//2922
-0.2261563103924044,	//2923
-0.2257724218492377,	//2924
-0.2253891849368538,	//2925
-0.2250065985491434,	//2926
-0.2246246615818749,	//2927
-0.2242433729326908,	//2928
-0.223862731501105,	//2929
-0.2234827361884995,	//2930
-0.2231033858981208,	//2931
-0.2227246795350776,	//2932
-0.2223466160063366,	//2933
-0.2219691942207202,	//2934
-0.2215924130889029,	//2935
-0.2212162715234082,	//2936
-0.2208407684386058,	//2937
-0.2204659027507078,	//2938
-0.2200916733777664,	//2939
-0.21971807923967,	//2940
-0.2193451192581406,	//2941
-0.2189727923567305,	//2942
-0.2186010974608193,	//2943
-0.2182300334976105,	//2944
-0.2178595993961289,	//2945
-0.2174897940872169,	//2946
-0.2171206165035319,	//2947
-0.2167520655795432,	//2948
-0.2163841402515286,	//2949
-0.2160168394575715,	//2950
-0.2156501621375579,	//2951
-0.2152841072331734,	//2952
-0.2149186736878998,	//2953
-0.2145538604470125,	//2954
-0.2141896664575771,	//2955
-0.2138260906684466,	//2956
-0.2134631320302582,	//2957
-0.2131007894954303,	//2958
-0.2127390620181597,	//2959
-0.2123779485544182,	//2960
-0.2120174480619499,	//2961
-0.2116575595002679,	//2962
-0.2112982818306517,	//2963
-0.2109396140161439,	//2964
-0.2105815550215472,	//2965
-0.2102241038134215,	//2966
-0.2098672593600811,	//2967
-0.2095110206315914,	//2968
-0.2091553865997658,	//2969
-0.2088003562381636,	//2970
-0.2084459285220858,	//2971
-0.2080921024285732,	//2972
-0.2077388769364027,	//2973
-0.2073862510260851,	//2974
-0.2070342236798613,	//2975
-0.2066827938816999,	//2976
-0.2063319606172944,	//2977
-0.2059817228740598,	//2978
-0.20563207964113,	//2979
-0.2052830299093546,	//2980
-0.2049345726712965,	//2981
-0.2045867069212285,	//2982
-0.2042394316551304,	//2983
-0.2038927458706868,	//2984
-0.203546648567283,	//2985
-0.2032011387460033,	//2986
-0.2028562154096273,	//2987
-0.2025118775626276,	//2988
-0.2021681242111665,	//2989
-0.2018249543630933,	//2990
-0.2014823670279413,	//2991
-0.2011403612169253,	//2992
-0.2007989359429384,	//2993
-0.2004580902205493,	//2994
-0.2001178230659993,	//2995
-0.1997781334971998,	//2996
-0.1994390205337289,	//2997
-0.1991004831968293,	//2998
-0.1987625205094048,	//2999
-0.198425131496018,	//3000
-0.1980883151828871,	//3001
-0.1977520705978831,	//3002
-0.1974163967705276,	//3003
-0.1970812927319892,	//3004
-0.1967467575150809,	//3005
-0.1964127901542578,	//3006
-0.1960793896856138,	//3007
-0.195746555146879,	//3008
-0.1954142855774168,	//3009
-0.1950825800182214,	//3010
-0.1947514375119148,	//3011
-0.194420857102744,	//3012
-0.1940908378365786,	//3013
-0.1937613787609074,	//3014
-0.1934324789248363,	//3015
-0.1931041373790853,	//3016
-0.1927763531759857,	//3017
-0.1924491253694774,	//3018
-0.1921224530151062,	//3019
-0.191796335170021,	//3020
-0.1914707708929713,	//3021
-0.1911457592443042,	//3022
-0.1908212992859618,	//3023
-0.1904973900814786,	//3024
-0.1901740306959786,	//3025
-0.1898512201961727,	//3026
-0.1895289576503562,	//3027
-0.1892072421284056,	//3028
-0.1888860727017766,	//3029
-0.1885654484435008,	//3030
-0.1882453684281833,	//3031
-0.1879258317320001,	//3032
-0.1876068374326952,	//3033
-0.1872883846095784,	//3034
-0.1869704723435219,	//3035
-0.1866530997169585,	//3036
-0.186336265813878,	//3037
-0.1860199697198257,	//3038
-0.1857042105218986,	//3039
-0.1853889873087435,	//3040
-0.1850742991705544,	//3041
-0.1847601451990694,	//3042
-0.1844465244875682,	//3043
-0.18413343613087,	//3044
-0.1838208792253301,	//3045
-0.1835088528688381,	//3046
-0.1831973561608144,	//3047
-0.1828863882022085,	//3048
-0.1825759480954958,	//3049
-0.1822660349446753,	//3050
-0.1819566478552667,	//3051
-0.1816477859343083,	//3052
-0.1813394482903541,	//3053
-0.1810316340334711,	//3054
-0.1807243422752371,	//3055
-0.1804175721287379,	//3056
-0.1801113227085647,	//3057
-0.1798055931308118,	//3058
-0.1795003825130738,	//3059
-0.1791956899744432,	//3060
-0.1788915146355075,	//3061
-0.1785878556183474,	//3062
-0.1782847120465336,	//3063
-0.1779820830451244,	//3064
-0.1776799677406634,	//3065
-0.1773783652611769,	//3066
-0.1770772747361712,	//3067
-0.1767766952966303,	//3068
-0.1764766260750131,	//3069
-0.1761770662052515,	//3070
-0.1758780148227473,	//3071
-0.1755794710643697,	//3072
-0.1752814340684533,	//3073
-0.1749839029747953,	//3074
-0.174686876924653,	//3075
-0.1743903550607413,	//3076
-0.1740943365272304,	//3077
-0.1737988204697432,	//3078
-0.1735038060353529,	//3079
-0.1732092923725803,	//3080
-0.1729152786313919,	//3081
-0.1726217639631967,	//3082
-0.1723287475208444,	//3083
-0.1720362284586227,	//3084
-0.1717442059322546,	//3085
-0.1714526790988965,	//3086
-0.1711616471171352,	//3087
-0.1708711091469862,	//3088
-0.1705810643498903,	//3089
-0.1702915118887121,	//3090
-0.170002450927737,	//3091
-0.169713880632669,	//3092
-0.1694258001706284,	//3093
-0.1691382087101491,	//3094
-0.1688511054211766,	//3095
-0.168564489475065,	//3096
-0.1682783600445753,	//3097
-0.1679927163038727,	//3098
-0.167707557428524,	//3099
-0.1674228825954955,	//3100
-0.1671386909831508,	//3101
-0.1668549817712478,	//3102
-0.1665717541409371,	//3103
-0.1662890072747588,	//3104
-0.1660067403566411,	//3105
-0.165724952571897,	//3106
-0.1654436431072227,	//3107
-0.1651628111506948,	//3108
-0.1648824558917682,	//3109
-0.1646025765212735,	//3110
-0.1643231722314148,	//3111
-0.1640442422157677,	//3112
-0.1637657856692764,	//3113
-0.1634878017882515,	//3114
-0.1632102897703683,	//3115
-0.1629332488146636,	//3116
-0.1626566781215339,	//3117
-0.1623805768927331,	//3118
-0.1621049443313698,	//3119
-0.1618297796419056,	//3120
-0.1615550820301524,	//3121
-0.16128085070327,	//3122
-0.1610070848697643,	//3123
-0.1607337837394844,	//3124
-0.1604609465236209,	//3125
-0.1601885724347032,	//3126
-0.1599166606865977,	//3127
-0.1596452104945046,	//3128
-0.159374221074957,	//3129
-0.1591036916458173,	//3130
-0.1588336214262759,	//3131
-0.1585640096368484,	//3132
-0.1582948554993735,	//3133
-0.158026158237011,	//3134
-0.1577579170742392,	//3135
-0.1574901312368528,	//3136
-0.1572227999519608,	//3137
-0.1569559224479839,	//3138
-0.1566894979546527,	//3139
-0.1564235257030053,	//3140
-0.156158004925385,	//3141
-0.1558929348554383,	//3142
-0.1556283147281121,	//3143
-0.1553641437796527,	//3144
-0.155100421247602,	//3145
-0.1548371463707968,	//3146
-0.1545743183893656,	//3147
-0.1543119365447267,	//3148
-0.1540500000795862,	//3149
-0.1537885082379358,	//3150
-0.1535274602650501,	//3151
-0.1532668554074851,	//3152
-0.1530066929130757,	//3153
-0.1527469720309334,	//3154
-0.1524876920114445,	//3155
-0.1522288521062676,	//3156
-0.1519704515683316,	//3157
-0.1517124896518336,	//3158
-0.1514549656122365,	//3159
-0.151197878706267,	//3160
-0.1509412281919138,	//3161
-0.1506850133284247,	//3162
-0.1504292333763051,	//3163
-0.1501738875973157,	//3164
-0.1499189752544703,	//3165
-0.1496644956120335,	//3166
-0.149410447935519,	//3167
-0.1491568314916871,	//3168
-0.148903645548543,	//3169
-0.148650889375334,	//3170
-0.1483985622425482,	//3171
-0.1481466634219118,	//3172
-0.1478951921863873,	//3173
-0.1476441478101712,	//3174
-0.1473935295686921,	//3175
-0.1471433367386086,	//3176
-0.1468935685978069,	//3177
-0.1466442244253993,	//3178
-0.1463953035017213,	//3179
-0.1461468051083304,	//3180
-0.1458987285280035,	//3181
-0.1456510730447348,	//3182
-0.1454038379437341,	//3183
-0.1451570225114244,	//3184
-0.14491062603544,	//3185
-0.1446646478046243,	//3186
-0.1444190871090281,	//3187
-0.144173943239907,	//3188
-0.1439292154897198,	//3189
-0.1436849031521263,	//3190
-0.1434410055219854,	//3191
-0.1431975218953528,	//3192
-0.142954451569479,	//3193
-0.1427117938428077,	//3194
-0.1424695480149731,	//3195
-0.1422277133867985,	//3196
-0.1419862892602939,	//3197
-0.1417452749386541,	//3198
-0.1415046697262567,	//3199
-0.1412644729286602,	//3200
-0.1410246838526018,	//3201
-0.1407853018059952,	//3202
-0.1405463260979293,	//3203
-0.1403077560386657,	//3204
-0.1400695909396365,	//3205
-0.139831830113443,	//3206
-0.1395944728738531,	//3207
-0.1393575185357995,	//3208
-0.139120966415378,	//3209
-0.138884815829845,	//3210
-0.1386490660976161,	//3211
-0.1384137165382636,	//3212
-0.1381787664725149,	//3213
-0.1379442152222506,	//3214
-0.1377100621105021,	//3215
-0.13747630646145,	//3216
-0.1372429476004222,	//3217
-0.1370099848538917,	//3218
-0.1367774175494747,	//3219
-0.1365452450159289,	//3220
-0.1363134665831513,	//3221
-0.1360820815821765,	//3222
-0.1358510893451745,	//3223
-0.1356204892054488,	//3224
-0.1353902804974348,	//3225
-0.1351604625566977,	//3226
-0.1349310347199303,	//3227
-0.1347019963249514,	//3228
-0.1344733467107041,	//3229
-0.1342450852172531,	//3230
-0.1340172111857838,	//3231
-0.1337897239585996,	//3232
-0.1335626228791205,	//3233
-0.1333359072918807,	//3234
-0.1331095765425274,	//3235
-0.1328836299778183,	//3236
-0.13265806694562,	//3237
-0.1324328867949061,	//3238
-0.1322080888757552,	//3239
-0.1319836725393492,	//3240
-0.1317596371379712,	//3241
-0.131535982025004,	//3242
-0.1313127065549277,	//3243
-0.1310898100833184,	//3244
-0.1308672919668459,	//3245
-0.1306451515632721,	//3246
-0.1304233882314491,	//3247
-0.1302020013313172,	//3248
-0.1299809902239033,	//3249
-0.1297603542713189,	//3250
-0.129540092836758,	//3251
-0.1293202052844961,	//3252
-0.1291006909798872,	//3253
-0.1288815492893632,	//3254
-0.1286627795804308,	//3255
-0.1284443812216708,	//3256
-0.1282263535827357,	//3257
-0.1280086960343478,	//3258
-0.1277914079482978,	//3259
-0.1275744886974426,	//3260
-0.1273579376557037,	//3261
-0.1271417541980654,	//3262
-0.1269259377005727,	//3263
-0.12671048754033,	//3264
-0.1264954030954989,	//3265
-0.1262806837452966,	//3266
-0.1260663288699939,	//3267
-0.1258523378509138,	//3268
-0.1256387100704292,	//3269
-0.1254254449119616,	//3270
-0.125212541759979,	//3271
-0.1249999999999944,	//3272
-0.1247878190185635,	//3273
-0.1245759982032838,	//3274
-0.1243645369427918,	//3275
-0.1241534346267621,	//3276
-0.1239426906459051,	//3277
-0.1237323043919657,	//3278
-0.123522275257721,	//3279
-0.123312602636979,	//3280
-0.1231032859245765,	//3281
-0.1228943245163778,	//3282
-0.1226857178092725,	//3283
-0.122477465201174,	//3284
-0.1222695660910176,	//3285
-0.1220620198787591,	//3286
-0.1218548259653726,	//3287
-0.1216479837528493,	//3288
-0.1214414926441952,	//3289
-0.1212353520434298,	//3290
-0.1210295613555843,	//3291
-0.1208241199866997,	//3292
-0.1206190273438254,	//3293
-0.120414282835017,	//3294
-0.1202098858693352,	//3295
-0.1200058358568436,	//3296
-0.1198021322086074,	//3297
-0.1195987743366911,	//3298
-0.1193957616541577,	//3299
-0.119193093575066,	//3300
-0.1189907695144697,	//3301
-0.1187887888884154,	//3302
-0.1185871511139408,	//3303
-0.1183858556090732,	//3304
-0.1181849017928279,	//3305
-0.1179842890852062,	//3306
-0.1177840169071941,	//3307
-0.1175840846807602,	//3308
-0.1173844918288545,	//3309
-0.1171852377754065,	//3310
-0.1169863219453233,	//3311
-0.1167877437644886,	//3312
-0.1165895026597602,	//3313
-0.1163915980589692,	//3314
-0.1161940293909175,	//3315
-0.115996796085377,	//3316
-0.1157998975730872,	//3317
-0.115603333285754,	//3318
-0.115407102656048,	//3319
-0.1152112051176028,	//3320
-0.1150156401050133,	//3321
-0.1148204070538343,	//3322
-0.1146255054005785,	//3323
-0.1144309345827153,	//3324
-0.1142366940386689,	//3325
-0.1140427832078165,	//3326
-0.1138492015304874,	//3327
-0.1136559484479606,	//3328
-0.1134630234024634,	//3329
-0.1132704258371703,	//3330
-0.1130781551962005,	//3331
-0.1128862109246172,	//3332
-0.1126945924684252,	//3333
-0.11250329927457,	//3334
-0.1123123307909357,	//3335
-0.1121216864663437,	//3336
-0.1119313657505508,	//3337
-0.111741368094248,	//3338
-0.1115516929490587,	//3339
-0.1113623397675371,	//3340
-0.1111733080031666,	//3341
-0.1109845971103584,	//3342
-0.1107962065444498,	//3343
-0.1106081357617025,	//3344
-0.1104203842193012,	//3345
-0.1102329513753523,	//3346
-0.1100458366888815,	//3347
-0.1098590396198333,	//3348
-0.1096725596290686,	//3349
-0.1094863961783636,	//3350
-0.109300548730408,	//3351
-0.1091150167488036,	//3352
-0.1089297996980628,	//3353
-0.1087448970436068,	//3354
-0.1085603082517643,	//3355
-0.10837603278977,	//3356
-0.1081920701257627,	//3357
-0.1080084197287841,	//3358
-0.1078250810687773,	//3359
-0.1076420536165851,	//3360
-0.1074593368439483,	//3361
-0.1072769302235046,	//3362
-0.1070948332287869,	//3363
-0.1069130453342217,	//3364
-0.1067315660151275,	//3365
-0.1065503947477136,	//3366
-0.1063695310090783,	//3367
-0.1061889742772075,	//3368
-0.1060087240309733,	//3369
-0.1058287797501324,	//3370
-0.1056491409153243,	//3371
-0.1054698070080704,	//3372
-0.105290777510772,	//3373
-0.1051120519067092,	//3374
-0.104933629680039,	//3375
-0.1047555103157941,	//3376
-0.1045776932998814,	//3377
-0.1044001781190802,	//3378
-0.1042229642610413,	//3379
-0.104046051214285,	//3380
-0.1038694384681998,	//3381
-0.103693125513041,	//3382
-0.1035171118399291,	//3383
-0.1033413969408484,	//3384
-0.1031659803086457,	//3385
-0.1029908614370284,	//3386
-0.1028160398205634,	//3387
-0.1026415149546758,	//3388
-0.1024672863356467,	//3389
-0.1022933534606127,	//3390
-0.1021197158275637,	//3391
-0.1019463729353419,	//3392
-0.10177332428364,	//3393
-0.1016005693730001,	//3394
-0.1014281077048122,	//3395
-0.1012559387813123,	//3396
-0.1010840621055818,	//3397
-0.1009124771815451,	//3398
-0.1007411835139691,	//3399
-0.1005701806084612,	//3400
-0.1003994679714677,	//3401
-0.1002290451102732,	//3402
-0.1000589115329982,	//3403
-0.09988906674859838,	//3404
-0.09971951026686295,	//3405
-0.09955024159841315,	//3406
-0.09938126025470091,	//3407
-0.09921256574800751,	//3408
-0.09904415759144203,	//3409
-0.0988760352989401,	//3410
-0.09870819838526233,	//3411
-0.09854064636599309,	//3412
-0.09837337875753897,	//3413
-0.09820639507712743,	//3414
-0.09803969484280543,	//3415
-0.09787327757343801,	//3416
-0.09770714278870694,	//3417
-0.09754129000910924,	//3418
-0.09737571875595595,	//3419
-0.09721042855137056,	//3420
-0.09704541891828783,	//3421
-0.09688068938045223,	//3422
-0.09671623946241671,	//3423
-0.09655206868954122,	//3424
-0.09638817658799143,	//3425
-0.09622456268473727,	//3426
-0.09606122650755167,	//3427
-0.09589816758500908,	//3428
-0.09573538544648423,	//3429
-0.09557287962215066,	//3430
-0.09541064964297948,	//3431
-0.09524869504073787,	//3432
-0.09508701534798786,	//3433
-0.09492561009808494,	//3434
-0.09476447882517668,	//3435
-0.09460362106420141,	//3436
-0.0944430363508869,	//3437
-0.09428272422174898,	//3438
-0.09412268421409023,	//3439
-0.09396291586599863,	//3440
-0.09380341871634622,	//3441
-0.09364419230478779,	//3442
-0.09348523617175956,	//3443
-0.09332654985847783,	//3444
-0.09316813290693762,	//3445
-0.09300998485991144,	//3446
-0.09285210526094788,	//3447
-0.09269449365437038,	//3448
-0.09253714958527583,	//3449
-0.09238007259953331,	//3450
-0.09222326224378273,	//3451
-0.09206671806543361,	//3452
-0.09191043961266369,	//3453
-0.09175442643441765,	//3454
-0.09159867808040582,	//3455
-0.09144319410110288,	//3456
-0.09128797404774654,	//3457
-0.09113301747233626,	//3458
-0.09097832392763198,	//3459
-0.09082389296715281,	//3460
-0.09066972414517568,	//3461
-0.0905158170167342,	//3462
-0.09036217113761719,	//3463
-0.09020878606436758,	//3464
-0.090055661354281,	//3465
-0.08990279656540456,	//3466
-0.08975019125653556,	//3467
-0.08959784498722023,	//3468
-0.08944575731775242,	//3469
-0.08929392780917238,	//3470
-0.08914235602326545,	//3471
-0.08899104152256086,	//3472
-0.08883998387033039,	//3473
-0.08868918263058713,	//3474
-0.08853863736808427,	//3475
-0.0883883476483138,	//3476
-0.08823831303750525,	//3477
-0.08808853310262445,	//3478
-0.08793900741137231,	//3479
-0.08778973553218351,	//3480
-0.08764071703422534,	//3481
-0.08749195148739633,	//3482
-0.08734343846232517,	//3483
-0.08719517753036933,	//3484
-0.08704716826361389,	//3485
-0.0868994102348703,	//3486
-0.08675190301767513,	//3487
-0.08660464618628887,	//3488
-0.08645763931569464,	//3489
-0.08631088198159706,	//3490
-0.08616437376042092,	//3491
-0.08601811422931005,	//3492
-0.085872102966126,	//3493
-0.08572633954944694,	//3494
-0.08558082355856635,	//3495
-0.08543555457349182,	//3496
-0.08529053217494388,	//3497
-0.08514575594435478,	//3498
-0.08500122546386722,	//3499
-0.08485694031633324,	//3500
-0.08471290008531294,	//3501
-0.08456910435507331,	//3502
-0.08442555271058701,	//3503
-0.08428224473753122,	//3504
-0.08413918002228639,	//3505
-0.08399635815193508,	//3506
-0.08385377871426072,	//3507
-0.08371144129774652,	//3508
-0.08356934549157415,	//3509
-0.08342749088562267,	//3510
-0.08328587707046728,	//3511
-0.08314450363737816,	//3512
-0.08300337017831928,	//3513
-0.08286247628594726,	//3514
-0.08272182155361012,	//3515
-0.08258140557534618,	//3516
-0.08244122794588286,	//3517
-0.0823012882606355,	//3518
-0.08216158611570618,	//3519
-0.08202212110788262,	//3520
-0.08188289283463694,	//3521
-0.08174390089412455,	//3522
-0.08160514488518295,	//3523
-0.08146662440733059,	//3524
-0.08132833906076575,	//3525
-0.08119028844636532,	//3526
-0.0810524721656837,	//3527
-0.08091488982095162,	//3528
-0.08077754101507499,	//3529
-0.08064042535163381,	//3530
-0.08050354243488092,	//3531
-0.08036689186974098,	//3532
-0.08023047326180924,	//3533
-0.08009428621735043,	//3534
-0.07995833034329762,	//3535
-0.07982260524725113,	//3536
-0.0796871105374773,	//3537
-0.07955184582290746,	//3538
-0.07941681071313675,	//3539
-0.07928200481842299,	//3540
-0.07914742774968556,	//3541
-0.07901307911850432,	//3542
-0.07887895853711843,	//3543
-0.07874506561842524,	//3544
-0.07861139997597921,	//3545
-0.07847796122399077,	//3546
-0.07834474897732518,	//3547
-0.0782117628515015,	//3548
-0.07807900246269135,	//3549
-0.07794646742771795,	//3550
-0.07781415736405491,	//3551
-0.07768207188982516,	//3552
-0.07755021062379984,	//3553
-0.07741857318539723,	//3554
-0.07728715919468161,	//3555
-0.07715596827236218,	//3556
-0.07702500003979197,	//3557
-0.07689425411896673,	//3558
-0.0767637301325239,	//3559
-0.07663342770374142,	//3560
-0.0765033464565367,	//3561
-0.07637348601546556,	//3562
-0.07624384600572112,	//3563
-0.07611442605313266,	//3564
-0.07598522578416468,	//3565
-0.07585624482591566,	//3566
-0.07572748280611709,	//3567
-0.07559893935313237,	//3568
-0.07547061409595575,	//3569
-0.0753425066642112,	//3570
-0.07521461668815142,	//3571
-0.07508694379865674,	//3572
-0.07495948762723401,	//3573
-0.07483224780601561,	//3574
-0.07470522396775836,	//3575
-0.07457841574584244,	//3576
-0.07445182277427036,	//3577
-0.07432544468766589,	//3578
-0.07419928112127298,	//3579
-0.07407333171095479,	//3580
-0.07394759609319253,	//3581
-0.0738220739050845,	//3582
-0.07369676478434496,	//3583
-0.07357166836930321,	//3584
-0.07344678429890238,	//3585
-0.07332211221269853,	//3586
-0.07319765175085956,	//3587
-0.07307340255416411,	//3588
-0.07294936426400064,	//3589
-0.07282553652236631,	//3590
-0.07270191897186597,	//3591
-0.07257851125571112,	//3592
-0.0724553130177189,	//3593
-0.07233232390231108,	//3594
-0.07220954355451295,	//3595
-0.07208697161995239,	//3596
-0.07196460774485881,	//3597
-0.07184245157606209,	//3598
-0.07172050276099164,	//3599
-0.07159876094767532,	//3600
-0.07147722578473843,	//3601
-0.07135589692140276,	//3602
-0.07123477400748547,	//3603
-0.07111385669339818,	//3604
-0.07099314463014587,	//3605
-0.07087263746932598,	//3606
-0.07075233486312732,	//3607
-0.07063223646432906,	//3608
-0.07051234192629981,	//3609
-0.07039265090299654,	//3610
-0.07027316304896361,	//3611
-0.07015387801933178,	//3612
-0.07003479546981721,	//3613
-0.06991591505672046,	//3614
-0.06979723643692549,	//3615
-0.06967875926789871,	//3616
-0.06956048320768794,	//3617
-0.06944240791492146,	//3618
-0.06932453304880699,	//3619
-0.06920685826913074,	//3620
-0.06908938323625644,	//3621
-0.06897210761112427,	//3622
-0.06885503105525001,	//3623
-0.06873815323072398,	//3624
-0.06862147380021008,	//3625
-0.0685049924269448,	//3626
-0.06838870877473631,	//3627
-0.06827262250796341,	//3628
-0.06815673329157464,	//3629
-0.06804104079108723,	//3630
-0.0679255446725862,	//3631
-0.06781024460272338,	//3632
-0.0676951402487164,	//3633
-0.06758023127834784,	//3634
-0.06746551735996413,	//3635
-0.06735099816247472,	//3636
-0.06723667335535104,	//3637
-0.06712254260862556,	//3638
-0.06700860559289092,	//3639
-0.06689486197929882,	//3640
-0.06678131143955923,	//3641
-0.06666795364593936,	//3642
-0.06655478827126271,	//3643
-0.06644181498890817,	//3644
-0.06632903347280902,	//3645
-0.06621644339745206,	//3646
-0.06610404443787661,	//3647
-0.0659918362696736,	//3648
-0.06587981856898462,	//3649
-0.065767991012501,	//3650
-0.06565635327746286,	//3651
-0.06554490504165821,	//3652
-0.06543364598342197,	//3653
-0.06532257578163508,	//3654
-0.06521169411572357,	//3655
-0.06510100066565765,	//3656
-0.06499049511195069,	//3657
-0.06488017713565845,	//3658
-0.06477004641837804,	//3659
-0.06466010264224706,	//3660
-0.06455034548994265,	//3661
-0.06444077464468061,	//3662
-0.06433138979021444,	//3663
-0.06422219061083445,	//3664
-0.06411317679136688,	//3665
-0.06400434801717296,	//3666
-0.06389570397414795,	//3667
-0.06378724434872036,	//3668
-0.06367896882785093,	//3669
-0.06357087709903174,	//3670
-0.06346296885028541,	//3671
-0.06335524377016406,	//3672
-0.06324770154774852,	//3673
-0.06314034187264735,	//3674
-0.06303316443499601,	//3675
-0.06292616892545594,	//3676
-0.06281935503521364,	//3677
-0.06271272245597985,	//3678
-0.06260627087998857,	//3679
-0.06249999999999625,	//3680
-0.06239390950928084,	//3681
-0.06228799910164095,	//3682
-0.06218226847139495,	//3683
-0.0620767173133801,	//3684
-0.06197134532295163,	//3685
-0.06186615219598193,	//3686
-0.06176113762885958,	//3687
-0.06165630131848857,	//3688
-0.06155164296228735,	//3689
-0.061447162258188,	//3690
-0.06134285890463534,	//3691
-0.06123873260058606,	//3692
-0.06113478304550788,	//3693
-0.06103100993937862,	//3694
-0.0609274129826854,	//3695
-0.06082399187642373,	//3696
-0.06072074632209669,	//3697
-0.060617676021714,	//3698
-0.06051478067779125,	//3699
-0.06041205999334896,	//3700
-0.06030951367191179,	//3701
-0.0602071414175076,	//3702
-0.0601049429346667,	//3703
-0.06000291792842093,	//3704
-0.05990106610430279,	//3705
-0.05979938716834467,	//3706
-0.05969788082707794,	//3707
-0.05959654678753209,	//3708
-0.05949538475723395,	//3709
-0.05939439444420679,	//3710
-0.05929357555696949,	//3711
-0.05919292780453572,	//3712
-0.05909245089641307,	//3713
-0.05899214454260223,	//3714
-0.05889200845359616,	//3715
-0.05879204234037921,	//3716
-0.05869224591442637,	//3717
-0.05859261888770235,	//3718
-0.05849316097266078,	//3719
-0.05839387188224341,	//3720
-0.05829475132987924,	//3721
-0.05819579902948372,	//3722
-0.0580970146954579,	//3723
-0.05799839804268762,	//3724
-0.05789994878654271,	//3725
-0.05780166664287611,	//3726
-0.05770355132802313,	//3727
-0.05760560255880053,	//3728
-0.0575078200525058,	//3729
-0.05741020352691629,	//3730
-0.05731275270028841,	//3731
-0.05721546729135681,	//3732
-0.05711834701933357,	//3733
-0.05702139160390741,	//3734
-0.05692460076524286,	//3735
-0.05682797422397944,	//3736
-0.05673151170123087,	//3737
-0.05663521291858429,	//3738
-0.05653907759809942,	//3739
-0.05644310546230774,	//3740
-0.05634729623421177,	//3741
-0.05625164963728417,	//3742
-0.05615616539546703,	//3743
-0.05606084323317101,	//3744
-0.05596568287527457,	//3745
-0.05587068404712318,	//3746
-0.05577584647452854,	//3747
-0.05568116988376773,	//3748
-0.05558665400158248,	//3749
-0.05549229855517838,	//3750
-0.05539810327222406,	//3751
-0.0553040678808504,	//3752
-0.05521019210964979,	//3753
-0.0551164756876753,	//3754
-0.05502291834443994,	//3755
-0.05492951980991584,	//3756
-0.0548362798145335,	//3757
-0.05474319808918099,	//3758
-0.05465027436520319,	//3759
-0.054557508374401,	//3760
-0.05446489984903059,	//3761
-0.05437244852180258,	//3762
-0.05428015412588136,	//3763
-0.05418801639488418,	//3764
-0.05409603506288053,	//3765
-0.05400420986439125,	//3766
-0.05391254053438786,	//3767
-0.05382102680829173,	//3768
-0.05372966842197334,	//3769
-0.05363846511175151,	//3770
-0.05354741661439268,	//3771
-0.05345652266711005,	//3772
-0.05336578300756295,	//3773
-0.05327519737385599,	//3774
-0.05318476550453834,	//3775
-0.05309448713860297,	//3776
-0.05300436201548588,	//3777
-0.05291438987506539,	//3778
-0.05282457045766134,	//3779
-0.05273490350403439,	//3780
-0.05264538875538521,	//3781
-0.05255602595335381,	//3782
-0.05246681484001871,	//3783
-0.05237775515789627,	//3784
-0.05228884664993989,	//3785
-0.05220008905953932,	//3786
-0.05211148213051988,	//3787
-0.05202302560714173,	//3788
-0.05193471923409913,	//3789
-0.05184656275651971,	//3790
-0.05175855591996376,	//3791
-0.05167069847042344,	//3792
-0.05158299015432206,	//3793
-0.05149543071851342,	//3794
-0.05140801991028095,	//3795
-0.05132075747733712,	//3796
-0.05123364316782259,	//3797
-0.05114667673030558,	//3798
-0.05105985791378109,	//3799
-0.05097318646767016,	//3800
-0.05088666214181922,	//3801
-0.0508002846864993,	//3802
-0.05071405385240531,	//3803
-0.0506279693906554,	//3804
-0.05054203105279011,	//3805
-0.05045623859077181,	//3806
-0.05037059175698382,	//3807
-0.05028509030422983,	//3808
-0.0501997339857331,	//3809
-0.05011452255513583,	//3810
-0.05002945576649833,	//3811
-0.04994453337429844,	//3812
-0.04985975513343073,	//3813
-0.04977512079920583,	//3814
-0.04969063012734971,	//3815
-0.04960628287400301,	//3816
-0.04952207879572027,	//3817
-0.04943801764946931,	//3818
-0.04935409919263042,	//3819
-0.04927032318299581,	//3820
-0.04918668937876874,	//3821
-0.04910319753856298,	//3822
-0.04901984742140198,	//3823
-0.04893663878671828,	//3824
-0.04885357139435274,	//3825
-0.04877064500455389,	//3826
-0.04868785937797724,	//3827
-0.04860521427568455,	//3828
-0.04852270945914319,	//3829
-0.04844034469022539,	//3830
-0.04835811973120763,	//3831
-0.04827603434476989,	//3832
-0.04819408829399499,	//3833
-0.04811228134236791,	//3834
-0.04803061325377511,	//3835
-0.04794908379250382,	//3836
-0.04786769272324139,	//3837
-0.04778643981107462,	//3838
-0.04770532482148902,	//3839
-0.04762434752036822,	//3840
-0.04754350767399321,	//3841
-0.04746280504904175,	//3842
-0.04738223941258762,	//3843
-0.0473018105321,	//3844
-0.04722151817544274,	//3845
-0.04714136211087378,	//3846
-0.04706134210704441,	//3847
-0.04698145793299861,	//3848
-0.0469017093581724,	//3849
-0.0468220961523932,	//3850
-0.04674261808587908,	//3851
-0.04666327492923821,	//3852
-0.04658406645346811,	//3853
-0.04650499242995502,	//3854
-0.04642605263047325,	//3855
-0.0463472468271845,	//3856
-0.04626857479263722,	//3857
-0.04619003629976596,	//3858
-0.04611163112189067,	//3859
-0.04603335903271612,	//3860
-0.04595521980633116,	//3861
-0.04587721321720814,	//3862
-0.04579933904020222,	//3863
-0.04572159705055075,	//3864
-0.04564398702387258,	//3865
-0.04556650873616745,	//3866
-0.04548916196381531,	//3867
-0.04541194648357572,	//3868
-0.04533486207258716,	//3869
-0.04525790850836642,	//3870
-0.04518108556880792,	//3871
-0.04510439303218312,	//3872
-0.04502783067713983,	//3873
-0.04495139828270161,	//3874
-0.04487509562826711,	//3875
-0.04479892249360944,	//3876
-0.04472287865887554,	//3877
-0.04464696390458552,	//3878
-0.04457117801163206,	//3879
-0.04449552076127977,	//3880
-0.04441999193516453,	//3881
-0.0443445913152929,	//3882
-0.04426931868404147,	//3883
-0.04419417382415624,	//3884
-0.04411915651875196,	//3885
-0.04404426655131156,	//3886
-0.04396950370568549,	//3887
-0.0438948677660911,	//3888
-0.04382035851711201,	//3889
-0.04374597574369751,	//3890
-0.04367171923116193,	//3891
-0.04359758876518401,	//3892
-0.04352358413180629,	//3893
-0.0434497051174345,	//3894
-0.04337595150883691,	//3895
-0.04330232309314378,	//3896
-0.04322881965784667,	//3897
-0.04315544099079788,	//3898
-0.04308218688020982,	//3899
-0.04300905711465438,	//3900
-0.04293605148306236,	//3901
-0.04286316977472283,	//3902
-0.04279041177928253,	//3903
-0.04271777728674526,	//3904
-0.0426452660874713,	//3905
-0.04257287797217675,	//3906
-0.04250061273193297,	//3907
-0.04242847015816598,	//3908
-0.04235645004265583,	//3909
-0.04228455217753602,	//3910
-0.04221277635529287,	//3911
-0.04214112236876498,	//3912
-0.04206959001114256,	//3913
-0.04199817907596691,	//3914
-0.04192688935712973,	//3915
-0.04185572064887263,	//3916
-0.04178467274578645,	//3917
-0.04171374544281071,	//3918
-0.04164293853523302,	//3919
-0.04157225181868845,	//3920
-0.04150168508915902,	//3921
-0.041431238142973,	//3922
-0.04136091077680444,	//3923
-0.04129070278767247,	//3924
-0.04122061397294081,	//3925
-0.04115064413031713,	//3926
-0.04108079305785248,	//3927
-0.04101106055394069,	//3928
-0.04094144641731786,	//3929
-0.04087195044706166,	//3930
-0.04080257244259086,	//3931
-0.04073331220366468,	//3932
-0.04066416953038227,	//3933
-0.04059514422318205,	//3934
-0.04052623608284124,	//3935
-0.0404574449104752,	//3936
-0.04038877050753689,	//3937
-0.04032021267581629,	//3938
-0.04025177121743986,	//3939
-0.04018344593486989,	//3940
-0.04011523663090402,	//3941
-0.04004714310867461,	//3942
-0.03997916517164821,	//3943
-0.03991130262362497,	//3944
-0.03984355526873806,	//3945
-0.03977592291145313,	//3946
-0.03970840535656778,	//3947
-0.0396410024092109,	//3948
-0.03957371387484219,	//3949
-0.03950653955925157,	//3950
-0.03943947926855863,	//3951
-0.03937253280921203,	//3952
-0.03930569998798902,	//3953
-0.03923898061199479,	//3954
-0.03917237448866201,	//3955
-0.03910588142575016,	//3956
-0.03903950123134509,	//3957
-0.03897323371385839,	//3958
-0.03890707868202687,	//3959
-0.038841035944912,	//3960
-0.03877510531189934,	//3961
-0.03870928659269804,	//3962
-0.03864357959734022,	//3963
-0.03857798413618051,	//3964
-0.0385125000198954,	//3965
-0.03844712705948279,	//3966
-0.03838186506626137,	//3967
-0.03831671385187013,	//3968
-0.03825167322826777,	//3969
-0.03818674300773221,	//3970
-0.03812192300285999,	//3971
-0.03805721302656576,	//3972
-0.03799261289208177,	//3973
-0.03792812241295726,	//3974
-0.03786374140305798,	//3975
-0.03779946967656562,	//3976
-0.03773530704797731,	//3977
-0.03767125333210504,	//3978
-0.03760730834407515,	//3979
-0.03754347189932781,	//3980
-0.03747974381361644,	//3981
-0.03741612390300725,	//3982
-0.03735261198387862,	//3983
-0.03728920787292066,	//3984
-0.03722591138713462,	//3985
-0.03716272234383239,	//3986
-0.03709964056063594,	//3987
-0.03703666585547684,	//3988
-0.03697379804659571,	//3989
-0.03691103695254169,	//3990
-0.03684838239217193,	//3991
-0.03678583418465105,	//3992
-0.03672339214945064,	//3993
-0.03666105610634872,	//3994
-0.03659882587542923,	//3995
-0.03653670127708151,	//3996
-0.03647468213199977,	//3997
-0.03641276826118261,	//3998
-0.03635095948593244,	//3999
-0.03628925562785502,	//4000
-0.03622765650885891,	//4001
-0.036166161951155,	//4002
-0.03610477177725593,	//4003
-0.03604348580997566,	//4004
-0.03598230387242887,	//4005
-0.03592122578803051,	//4006
-0.03586025138049528,	//4007
-0.03579938047383712,	//4008
-0.03573861289236868,	//4009
-0.03567794846070085,	//4010
-0.0356173870037422,	//4011
-0.03555692834669855,	//4012
-0.0354965723150724,	//4013
-0.03543631873466246,	//4014
-0.03537616743156313,	//4015
-0.035316118232164,	//4016
-0.03525617096314938,	//4017
-0.03519632545149774,	//4018
-0.03513658152448128,	//4019
-0.03507693900966536,	//4020
-0.03501739773490808,	//4021
-0.0349579575283597,	//4022
-0.03489861821846223,	//4023
-0.03483937963394883,	//4024
-0.03478024160384345,	//4025
-0.03472120395746021,	//4026
-0.03466226652440298,	//4027
-0.03460342913456486,	//4028
-0.0345446916181277,	//4029
-0.03448605380556162,	//4030
-0.03442751552762449,	//4031
-0.03436907661536148,	//4032
-0.03431073690010452,	//4033
-0.03425249621347189,	//4034
-0.03419435438736764,	//4035
-0.0341363112539812,	//4036
-0.03407836664578681,	//4037
-0.0340205203955431,	//4038
-0.03396277233629259,	//4039
-0.03390512230136117,	//4040
-0.03384757012435769,	//4041
-0.03379011563917341,	//4042
-0.03373275867998156,	//4043
-0.03367549908123686,	//4044
-0.03361833667767501,	//4045
-0.03356127130431228,	//4046
-0.03350430279644495,	//4047
-0.03344743098964891,	//4048
-0.03339065571977912,	//4049
-0.03333397682296918,	//4050
-0.03327739413563086,	//4051
-0.03322090749445358,	//4052
-0.03316451673640401,	//4053
-0.03310822169872554,	//4054
-0.03305202221893781,	//4055
-0.03299591813483631,	//4056
-0.03293990928449182,	//4057
-0.03288399550625001,	//4058
-0.03282817663873094,	//4059
-0.03277245252082861,	//4060
-0.03271682299171049,	//4061
-0.03266128789081705,	//4062
-0.0326058470578613,	//4063
-0.03255050033282833,	//4064
-0.03249524755597485,	//4065
-0.03244008856782873,	//4066
-0.03238502320918853,	//4067
-0.03233005132112304,	//4068
-0.03227517274497085,	//4069
-0.03222038732233982,	//4070
-0.03216569489510673,	//4071
-0.03211109530541675,	//4072
-0.03205658839568296,	//4073
-0.032002174008586,	//4074
-0.0319478519870735,	//4075
-0.0318936221743597,	//4076
-0.03183948441392499,	//4077
-0.0317854385495154,	//4078
-0.03173148442514223,	//4079
-0.03167762188508156,	//4080
-0.03162385077387379,	//4081
-0.0315701709363232,	//4082
-0.03151658221749754,	//4083
-0.0314630844627275,	//4084
-0.03140967751760635,	//4085
-0.03135636122798946,	//4086
-0.03130313543999382,	//4087
-0.03124999999999765,	//4088
-0.03119695475463995,	//4089
-0.03114399955082001,	//4090
-0.03109113423569701,	//4091
-0.03103835865668958,	//4092
-0.03098567266147535,	//4093
-0.0309330760979905,	//4094
-0.03088056881442933	//4095
-};
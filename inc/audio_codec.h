@@ -7,3 +7,10 @@
 #include <stm32f4xx.h>
 
 void process_audio_block_codec(int16_t *src, int16_t *dst);
+void update_audio_mix_kernel(void);
+uint32_t get_audio_block_tmr(void);
+
+#ifdef BENCHMARK_AUDIO_KERNELS
+#define BENCHMARK_REPS 256
+void benchmark_audio_mix_kernels(void);
+#endif
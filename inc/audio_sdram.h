@@ -10,20 +10,31 @@
 #include <stm32f4xx.h>
 #include "sdram_driver.h"
 #include "circular_buffer.h"
+#include "globals.h"
 
-//Play buffer 1:  	0xD0000000 - 0xD011FFFF
-//Play buffer 2:  	0xD0120000 - 
-//Play buffer 3:  	0xD0240000 - 
-//Play buffer 4:  	0xD0360000 - 
-//..
-//Play buffer 11: 	0xD0B40000 - 
-//...
-//Play buffer 20: 	0xD1560000 - 0xD167FFFF
-//	unused 		   [0xD1680000 - 0xD17FFFFF] = 0xB0000 = 600kB unused
+//Play buffers:		0xD0000000 - 0xD167FFFF, split into NUM_PLAY_CHAN * NUM_SAMPLES_PER_BANK slots
+//					(20 slots of 0x120000)
+//Dir listing:		0xD1680000 - 0xD16BFFFF (256kB)
+//Index text:		0xD16C0000 - 0xD16FFFFF (256kB)
+//Sample catalog:	0xD1700000 - 0xD17FFFFF (1MB)
 //Record buffer: 	0xD1800000 - 0xD1FFFFF8
 
 #define PLAY_BUFF_START			(0x00000000 + SDRAM_BASE)
-#define PLAY_BUFF_SLOT_SIZE		 0x00120000
+#define PLAY_BUFF_AREA_SIZE		 0x01680000
+
+//Slots are rounded down to a multiple of 0x6000 so a slot always holds a whole number of
+//blocks of any supported blockAlign (1, 2, 3, 4, 6, 8 bytes)
+#define PLAY_BUFF_SLOT_ALIGN	 0x00006000
+#define PLAY_BUFF_SLOT_SIZE		((PLAY_BUFF_AREA_SIZE / (NUM_PLAY_CHAN * NUM_SAMPLES_PER_BANK)) / PLAY_BUFF_SLOT_ALIGN * PLAY_BUFF_SLOT_ALIGN)
+
+#define DIRLIST_POOL_START		(PLAY_BUFF_AREA_SIZE + SDRAM_BASE)
+#define DIRLIST_POOL_SIZE		 0x00040000
+
+#define INDEX_TEXT_START		(0x016C0000 + SDRAM_BASE)
+#define INDEX_TEXT_BANK_SIZE	 0x00001000
+
+#define CATALOG_START			(0x01700000 + SDRAM_BASE)
+#define CATALOG_SIZE			 0x00100000
 
 #define	REC_BUFF_START			(0x01800000 + SDRAM_BASE)
 #define REC_BUFF_SIZE			 0x007FFFF8
@@ -31,7 +42,16 @@
 
 #define REC_CHAN 2
 
-void memory_clear(void);
+//Bytes of SDRAM that clear_sdram_step() has the DMA clear each time it's called
+#define SDRAM_CLEAR_CHUNK		 0x00010000
+
+//Bytes at the start of the record buffer that are cleared after boot
+#define REC_BUFF_CLEAR_SIZE		 0x00010000
+
+void start_sdram_clear(void);
+uint8_t clear_sdram_step(void);
+void claim_play_buff_slot(uint8_t chan, uint8_t samplenum);
+void claim_rec_buff(void);
 
 uint32_t memory_read16_cb(CircularBuffer* b, int16_t *rd_buff, uint32_t num_samples, uint8_t decrement);
 uint32_t memory_read24_cb(CircularBuffer* b, uint8_t *rd_buff, uint32_t num_samples, uint8_t decrement);
@@ -18,6 +18,9 @@
 //uint32_t diff_circular(uint32_t leader, uint32_t follower, uint32_t wrap_size);
 //uint32_t diff_wrap(uint32_t leader, uint32_t follower, uint8_t wrapping, uint32_t wrap_size);
 uint32_t align_addr(uint32_t addr, uint32_t blockAlign);
+void apply_gain_ramp(int32_t *outL, int32_t *outR, uint32_t len, int32_t gain_start, int32_t gain_end);
+
+#define GAIN_Q16(x) ((int32_t)((x) * 65536.0f))
 
 
 
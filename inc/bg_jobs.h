@@ -0,0 +1,25 @@
+/*
+ * bg_jobs.h
+ *
+ * Background jobs that write or read the SD Card in small steps from the main loop
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+
+// In order of priority: a pending job with a lower number is started first
+enum BgJobs {
+	BGJOB_LOAD_INDEX,
+	BGJOB_WRITE_INDEX,
+	BGJOB_BACKUP_INDEX,
+	BGJOB_SAVE_SETTINGS,
+	BGJOB_WRITE_SAMPLELIST,
+	BGJOB_WRITE_PROFILE,
+
+	NUM_BGJOBS
+};
+
+void 	start_bg_job(enum BgJobs job, uint8_t arg);
+uint8_t is_bg_job_running(enum BgJobs job);
+void 	run_bg_jobs(void);
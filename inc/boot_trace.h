@@ -0,0 +1,34 @@
+/*
+ * boot_trace.h
+ *
+ * Boot-time trace: the time main() spends in each phase of starting up, measured with the DWT cycle counter.
+ * Sent on ITM port BOOT_TRACE_ITM_PORT when boot is done, and written to the CPU profile file (see profiler.c)
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+
+// In the order they run in main()
+enum BootPhases {
+	BOOT_CODEC_DEINIT,		//stop codec and I2S, wait for them to settle
+	BOOT_PINS,				//digital pins, PCB version
+	BOOT_SDRAM,				//SDRAM controller (and RAM test if the buttons are held)
+	BOOT_SDCARD,			//mount the SD Card, measure its speed
+	BOOT_LEDS,				//LED driver chips and button LEDs
+	BOOT_ADCS,				//CV and pot ADCs
+	BOOT_CODEC,				//codec registers and audio DMA
+	BOOT_SETTINGS,			//params, user settings file, calibrations in FLASH
+	BOOT_AUDIO_START,		//play and record buffers, start of the audio interrupt
+	BOOT_BANKS,				//index file and banks
+
+	NUM_BOOT_PHASES
+};
+
+#define BOOT_TRACE_ITM_PORT		4
+
+void 		boot_trace_start(void);
+void 		boot_trace_mark(enum BootPhases phase);
+void 		boot_trace_end(void);
+uint32_t 	boot_phase_us(enum BootPhases phase);
+const char 	*boot_phase_name(enum BootPhases phase);
@@ -0,0 +1,58 @@
+/*
+ * event_queue.h
+ *
+ * Events posted by the interrupts (and the main loop itself) for the main loop to handle.
+ *
+ * Each producer (one interrupt handler, or the main loop) has its own single-producer/single-consumer ring queue,
+ * so events from the same source are never merged or lost between two passes of the main loop,
+ * and no queue is ever written from two priority levels.
+ * post_event() picks the queue for the context it's called from.
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+
+enum EventTypes {
+	EV_PLAY_BUT,			//start or stop playing chan
+	EV_PLAY_TRIG,			//start playing chan (re-starts if playing)
+	EV_REV_TRIG,			//toggle reverse on chan
+	EV_REC_TRIG,			//start or stop recording
+	EV_TOGGLE_MONITOR,
+	EV_TOGGLE_LOOPING,		//toggle looping on chan
+	EV_FORCE_RELOAD,		//re-open chan's sample file the next time it starts playing
+
+	NUM_EVENT_TYPES
+};
+
+enum EventQueues {
+	EVQ_MAIN,				//main loop
+	EVQ_AUDIO,				//AUDIO_I2S2_EXT_DMA_IRQHandler()
+	EVQ_TRIG_JACKS,			//Trigger_Jack_Debounce_IRQHandler()
+	EVQ_BUTTONS,			//Button_Debounce_IRQHandler()
+	EVQ_PARAMS,				//adc_param_update_IRQHandler()
+
+	NUM_EVENT_QUEUES
+};
+
+//Events per queue. Must be a power of 2, and no more than 128
+#define EVENT_QUEUE_SIZE	16
+
+typedef struct Event {
+	uint32_t	timestamp;	//sys_tmr when posted
+	uint8_t		type;
+	uint8_t		chan;
+} Event;
+
+typedef struct EventQueue {
+	Event				ev[EVENT_QUEUE_SIZE];
+	volatile uint8_t	head;		//written only by the producer
+	volatile uint8_t	tail;		//written only by the main loop
+	uint8_t				overflows;	//events lost because the queue was full
+} EventQueue;
+
+void 		post_event(enum EventTypes type, uint8_t chan);
+uint8_t 	get_next_event(Event *e);
+
+uint32_t 	event_max_latency(void);
+uint32_t 	events_lost(void);
@@ -56,7 +56,8 @@
    */
  #define SDIO_INIT_CLK_DIV                ((uint8_t)0x76)
  /**
-   * @brief  SDIO Data Transfer Frequency (25MHz max)
+   * @brief  SDIO Data Transfer Frequency in default speed mode (25MHz max): 24MHz
+   *         In high speed mode (50MHz max), the divider is bypassed: 48MHz
    */
  #define SDIO_TRANSFER_CLK_DIV            ((uint8_t)0x0)
 
@@ -170,6 +171,15 @@ typedef enum
   SD_OK = 0
 } SD_Error;
 
+/**
+  * @brief  SDIO bus clock (data transfer)
+  */
+typedef enum
+{
+  SD_BUS_SPEED_DEFAULT = 0, /*!< SDIO_CK = 24MHz */
+  SD_BUS_SPEED_HIGH    = 1  /*!< SDIO_CK = 48MHz, card must be switched to high speed mode */
+} SD_BusSpeed;
+
 /**
   * @brief  SDIO Transfer state
   */
@@ -440,6 +450,12 @@ SD_Error SD_StopTransfer(void);
 SD_Error SD_Erase(uint32_t startaddr, uint32_t endaddr);
 SD_Error SD_SendStatus(uint32_t *pcardstatus);
 SD_Error SD_SendSDStatus(uint32_t *psdstatus);
+SD_Error SD_HighSpeed(void);
+void SD_SetBusSpeed(SD_BusSpeed speed);
+void SD_LimitBusSpeed(SD_BusSpeed max_speed);
+SD_BusSpeed SD_GetBusSpeed(void);
+uint8_t SD_IsHighSpeedCard(void);
+uint32_t SD_GetCRCErrorCount(void);
 SD_Error SD_ProcessIRQSrc(void);
 void SD_ProcessDMAIRQ(void);
 SD_Error SD_WaitReadOperation(void);
@@ -0,0 +1,32 @@
+/*
+ * flash_log.h
+ *
+ * Log-structured key/value store in two internal FLASH sectors.
+ *
+ * Saving a value appends a small record to the active sector, without erasing anything.
+ * When the active sector fills up, the latest record of each key is copied into the other sector (compaction).
+ * Erasing a sector stalls every instruction fetch from FLASH (all the interrupts included) for 1-2 seconds,
+ * so flash_log_compact() is only called at boot, before the audio starts (see flash_user.c).
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+
+// The last two 128kB sectors. The linker script keeps the firmware out of them
+#define FLASH_LOG_SECTOR_A			0x080C0000
+#define FLASH_LOG_SECTOR_B			0x080E0000
+#define FLASH_LOG_SECTOR_SIZE		0x20000
+
+// Keys are 0 to FLASH_LOG_MAX_KEYS-1, and a record holds up to FLASH_LOG_MAX_DATA bytes
+#define FLASH_LOG_MAX_KEYS			16
+#define FLASH_LOG_MAX_DATA			256
+
+// flash_log_needs_compaction() returns 1 once less than this many bytes are free in the active sector
+#define FLASH_LOG_COMPACT_RESERVE	(FLASH_LOG_SECTOR_SIZE/4)
+
+void 			flash_log_init(void);
+uint8_t 		flash_log_read(uint8_t key, void *data, uint16_t size);
+FLASH_Status 	flash_log_append(uint8_t key, const void *data, uint16_t size);
+uint8_t 		flash_log_needs_compaction(void);
+FLASH_Status 	flash_log_compact(void);
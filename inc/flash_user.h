@@ -16,6 +16,7 @@ void save_flash_params(uint8_t num_led_blinks);
 void copy_system_calibrations_into_staging(void);
 void write_all_system_calibrations_to_FLASH(void);
 void read_all_system_calibrations_from_FLASH(void);
+void update_flash_params(void);
 void apply_firmware_specific_adjustments(void);
 
 
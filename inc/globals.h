@@ -8,13 +8,35 @@
 
 //#define DEBUG_ENABLED
 
-
- // 128 bytes per DMA transfer
- // 64 bytes/half-transfer @ 16 bits/sample = 32 samples per half-transfer
+//Measure cycles per block of the audio kernels at boot (results on ITM port 0),
+//and the audio CPU load while running (ITM ports 1 and 2)
+//#define BENCHMARK_AUDIO_KERNELS
+
+//Count the cycles spent in each interrupt and main loop task (see profiler.h).
+//Stats are sent on ITM port 3 once a second, and written to the SD Card with Rec Bank in System Mode
+//#define CPU_PROFILER
+
+
+ // AUDIO_BLOCK_SIZE is the number of frames per channel processed in each audio interrupt (DMA half-transfer)
+ // It can be set at build time with make AUDIO_BLOCK_SIZE=n (16, 32, 64 or 128)
+ // Larger blocks have less interrupt overhead, but more latency:
+ // 16 frames/interrupt @ 44100Hz = interrupt runs every 0.36ms
+ // 128 frames/interrupt @ 44100Hz = interrupt runs every 2.9ms
+ //
+ // With the default of 16:
+ // 128 int16_t per DMA transfer (each frame is L + pad + R + pad)
+ // 64 int16_t/half-transfer = 32 samples per half-transfer
  // 32 samples/half-transfer = 16 samples per channel per half-transfer
- // 16/interrupt @ 44100Hz = interrupt runs every 0.36ms
- 
-#define codec_BUFF_LEN 		128 
+
+#ifndef AUDIO_BLOCK_SIZE
+#define AUDIO_BLOCK_SIZE	16
+#endif
+
+#if (AUDIO_BLOCK_SIZE != 16) && (AUDIO_BLOCK_SIZE != 32) && (AUDIO_BLOCK_SIZE != 64) && (AUDIO_BLOCK_SIZE != 128)
+#error "AUDIO_BLOCK_SIZE must be 16, 32, 64 or 128"
+#endif
+
+#define codec_BUFF_LEN 		(AUDIO_BLOCK_SIZE<<3)	/*128*/
 #define HT16_BUFF_LEN 		(codec_BUFF_LEN>>2)		/*32*/
 #define HT16_CHAN_BUFF_LEN 	(HT16_BUFF_LEN>>1) 		/*16*/
 
@@ -40,71 +62,65 @@
 
 // Flags are used for sections of code with different interrupt priorities
 // to communicate that an event occured and/or to schedule an action to occur
+// Events that must be handled once each, in order (triggers, buttons, file reloads) are posted with post_event() instead (see event_queue.h)
 enum Flags {
-	PlaySample1Changed, 	//0
+	PlaySample1Changed,		//0
 	PlaySample2Changed,
 	PlayBank1Changed,
 	PlayBank2Changed,
 	RecSampleChanged,
-	RecBankChanged, 		//5
-	Play1But,
-	Play2But,
-	RecTrig,
-	Rev1Trig,
-	Rev2Trig, 				//10
+	RecBankChanged,			//5
 	PlayBuff1_Discontinuity,
 	PlayBuff2_Discontinuity,
-	ToggleMonitor,
-	ToggleLooping1,
-	ToggleLooping2, 		//15
 	PlaySample1Changed_valid,
 	PlaySample2Changed_valid,
-	PlaySample1Changed_empty,
+	PlaySample1Changed_empty,	//10
 	PlaySample2Changed_empty,
-	RecSampleChanged_light, //20
-	ForceFileReload1,
-	ForceFileReload2,
+	RecSampleChanged_light,
 	AssignModeRefused,
 	AssigningEmptySample,
-	TimeToReadStorage, 		//25
-	Play1Trig,
-	Play2Trig,
+	TimeToReadStorage,		//15
 	StereoModeTurningOn,
 	StereoModeTurningOff,
-	SkipProcessButtons, 	//30
+	SkipProcessButtons,
 	ViewBlinkBank1,
-	ViewBlinkBank2,
+	ViewBlinkBank2,			//20
 	PlayBankHover1Changed,
 	PlayBankHover2Changed,
-	RecBankHoverChanged, 	//35
+	RecBankHoverChanged,
 	RevertSample,
-	RevertBank1,
+	RevertBank1,			//25
 	RevertBank2,
 	RevertAll,
-	RewriteIndex, 			//40
+	RewriteIndex,
 	RewriteIndexFail,
-	RewriteIndexSucess,
+	RewriteIndexSucess,		//30
 	AssignedNextSample,
 	AssignedPrevBank,
-	FindNextSampleToAssign, //45
+	FindNextSampleToAssign,
 	SaveUserSettings,
-	UndoSampleExists,
+	UndoSampleExists,		//35
 	UndoSampleDiffers,
 	LoadBackupIndex,
-	LoadIndex,				//50
+	LoadIndex,
 	LatchVoltOctCV1,
-	LatchVoltOctCV2, 
+	LatchVoltOctCV2,		//40
 	Play1TrigDelaying,
 	Play2TrigDelaying,
-	BootBak,				// 55
+	BootBak,
 	SystemModeButtonsDown,
-	ShutdownAndBootload,
+	ShutdownAndBootload,	//45
 	ChangedTrigDelay,
 	SaveUserSettingsLater,
-	ChangePlaytoPerc1,		//60
+	ChangePlaytoPerc1,
 	ChangePlaytoPerc2,
-	PercEnvModeChanged,
+	PercEnvModeChanged,		//50
 	FadeEnvModeChanged,
+	RewriteSampleList,
+	WriteCPUProfile,
+	SaveFlashParams,
+	BlinkSavedFlashParams,	//55
+	WritingIndex,
 	
 	NUM_FLAGS
 };
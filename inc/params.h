@@ -95,6 +95,8 @@ enum GlobalModes
 	STARTUPBANK_CH1,
 	STARTUPBANK_CH2,
 	TRIG_DELAY,
+	TIME_STRETCH,
+	LOOP_CROSSFADE,
 	
 	NUM_GLOBAL_MODES
 };
@@ -141,6 +143,7 @@ uint32_t apply_tracking_compensation(int32_t cv_adcval, float cal_amt);
 
 void update_params(void);
 void process_cv_adc(void);
+void update_pitch_cv(void);
 void process_pot_adc(void);
 
 void process_mode_flags(void);
@@ -34,6 +34,10 @@
  * Verify the I2C speed is OK
  * Assign the LEDs you are using to the driver chips they are connected to in driverBaseAddress[]
  * Assign the RGB LED's red element's led number of the driver chip in driverBaseElementAddress[]
+ *
+ * The LEDDriver_set...() functions only update a copy of the chips' LED registers.
+ * LEDDriver_update() sends the changed registers: one auto-increment burst per chip, using I2C DMA.
+ * The burst runs in the background on the I2C event/error and DMA interrupts, so it can be called from an IRQ
  */
 
 /* I2C peripheral configuration defines (control interface of the audio codec) */
@@ -54,6 +58,26 @@
 
 #define I2C1_SPEED                        400000
 
+/* DMA for I2C1 TX: DMA1 Stream 6 Channel 1 */
+#define LEDDRIVER_DMA_CLK                  RCC_AHB1Periph_DMA1
+#define LEDDRIVER_DMA_STREAM               DMA1_Stream6
+#define LEDDRIVER_DMA_CHANNEL              DMA_Channel_1
+#define LEDDRIVER_DMA_FLAG_TC              DMA_FLAG_TCIF6
+#define LEDDRIVER_DMA_FLAGS_ALL            (DMA_FLAG_FEIF6 | DMA_FLAG_DMEIF6 | DMA_FLAG_TEIF6 | DMA_FLAG_HTIF6 | DMA_FLAG_TCIF6)
+#define LEDDRIVER_DMA_IRQ                  DMA1_Stream6_IRQn
+#define LEDDRIVER_DMA_IRQHandler           DMA1_Stream6_IRQHandler
+
+#define LEDDRIVER_I2C_EV_IRQ               I2C1_EV_IRQn
+#define LEDDRIVER_I2C_EV_IRQHandler        I2C1_EV_IRQHandler
+#define LEDDRIVER_I2C_ER_IRQ               I2C1_ER_IRQn
+#define LEDDRIVER_I2C_ER_IRQHandler        I2C1_ER_IRQHandler
+
+#define LEDDRIVER_MAX_DRIVERS              2
+#define LEDDRIVER_ELEMENTS                 16
+
+/* If a burst hasn't finished after this long (in sys_tmr ticks, 100ms), LEDDriver_update() resets the I2C bus */
+#define LEDDRIVER_STALL_TIME               4410
+
 #define PCA9685_MODE1 0x00 // location for Mode1 register address
 #define PCA9685_MODE2 0x01 // location for Mode2 reigster address
 #define PCA9685_LED0 0x06 // location for start of LED0 registers
@@ -74,5 +98,11 @@ void LEDDriver_setRGBLED(uint8_t led_number, uint32_t rgb);
 void LEDDriver_setRGBLED_12bit(uint8_t rgbled_number, uint32_t rgb);
 void LEDDriver_setRGBLED_RGB(uint8_t rgbled_number, int16_t c_red, int16_t c_green, int16_t c_blue);
 
+void LEDDriver_update(void);
+
 void LEDDriver_Init(uint8_t numdrivers);
 uint32_t LEDDriver_writeregister(uint8_t driverAddr, uint8_t RegisterAddr, uint8_t RegisterValue);
+
+void LEDDRIVER_I2C_EV_IRQHandler(void);
+void LEDDRIVER_I2C_ER_IRQHandler(void);
+void LEDDRIVER_DMA_IRQHandler(void);
@@ -0,0 +1,65 @@
+/*
+ * profiler.h
+ *
+ * CPU load profiler: counts the cycles (DWT->CYCCNT) spent in each interrupt handler and main loop task.
+ * Build with CPU_PROFILER defined (see globals.h). Otherwise the hooks compile to nothing.
+ *
+ * The counts include the time spent in any higher-priority interrupts that pre-empted the one being measured
+ * (so the main loop tasks include all interrupts that ran while they were running)
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+#include "globals.h"
+
+enum ProfilePoints {
+	PROF_AUDIO_BLOCK,			//process_audio_block_codec()
+	PROF_PARAM_UPDATE,			//adc_param_update_IRQHandler()
+	PROF_TRIG_DEBOUNCE,			//Trigger_Jack_Debounce_IRQHandler()
+	PROF_BUTTON_LEDS,			//ButtonLED_IRQHandler()
+	PROF_LED_PWM,				//LED_PWM_IRQHandler()
+	PROF_READ_STORAGE,			//read_storage_to_buffer()
+	PROF_WRITE_STORAGE,			//write_buffer_to_storage()
+	PROF_INDEX_WRITE,			//one step of writing the index file
+
+	NUM_PROFILE_POINTS
+};
+
+//Histogram of cycles per call: bin n counts calls that took 2^(n+PROFILE_HIST_MIN_BITS) to 2^(n+PROFILE_HIST_MIN_BITS+1)-1 cycles.
+//The first and last bins also count everything below and above
+#define PROFILE_HIST_BINS		16
+#define PROFILE_HIST_MIN_BITS	8
+
+typedef struct ProfileStats {
+	uint32_t	count;
+	uint32_t	min;
+	uint32_t	max;
+	uint64_t	total;
+	uint32_t	hist[PROFILE_HIST_BINS];
+} ProfileStats;
+
+//ITM (SWO/TRACE) stimulus port that profile_poll() uses
+#define PROFILE_ITM_PORT		3
+
+#define PROFILE_FILE			"cpu_profile.txt"
+
+#ifdef CPU_PROFILER
+
+#define PROFILE_START(p)		uint32_t prof_start_##p = DWT->CYCCNT
+#define PROFILE_END(p)			profile_record((p), DWT->CYCCNT - prof_start_##p)
+
+#else
+
+#define PROFILE_START(p)
+#define PROFILE_END(p)
+
+#endif
+
+void 	profile_init(void);
+void 	profile_record(enum ProfilePoints p, uint32_t cycles);
+void 	profile_reset(void);
+void 	profile_poll(void);
+
+void 	write_profile_begin(void);
+uint8_t write_profile_step(void);
@@ -1,4098 +0,0 @@
-const float pitch_pot_lut[4096] = {
-0.062500000,
-0.062591784,
-0.062683704,
-0.062775758,
-0.062867947,
-0.062960272,
-0.063052732,
-0.063145329,
-0.063238061,
-0.063330929,
-0.063423934,
-0.063517075,
-0.063610353,
-0.063703768,
-0.063797320,
-0.063891010,
-0.063984837,
-0.064078802,
-0.064172905,
-0.064267146,
-0.064361526,
-0.064456044,
-0.064550701,
-0.064645497,
-0.064740432,
-0.064835507,
-0.064930721,
-0.065026075,
-0.065121569,
-0.065217204,
-0.065312979,
-0.065408894,
-0.065504950,
-0.065601148,
-0.065697486,
-0.065793966,
-0.065890588,
-0.065987352,
-0.066084258,
-0.066181306,
-0.066278496,
-0.066375830,
-0.066473306,
-0.066570926,
-0.066668688,
-0.066766595,
-0.066864645,
-0.066962839,
-0.067061177,
-0.067159660,
-0.067258287,
-0.067357060,
-0.067455977,
-0.067555040,
-0.067654248,
-0.067753601,
-0.067853101,
-0.067952747,
-0.068052539,
-0.068152477,
-0.068252563,
-0.068352795,
-0.068453175,
-0.068553702,
-0.068654376,
-0.068755199,
-0.068856169,
-0.068957288,
-0.069058555,
-0.069159971,
-0.069261536,
-0.069363250,
-0.069465114,
-0.069567127,
-0.069669290,
-0.069771603,
-0.069874066,
-0.069976679,
-0.070079444,
-0.070182359,
-0.070285425,
-0.070388643,
-0.070492012,
-0.070595534,
-0.070699207,
-0.070803032,
-0.070907010,
-0.071011141,
-0.071115424,
-0.071219861,
-0.071324451,
-0.071429194,
-0.071534092,
-0.071639143,
-0.071744349,
-0.071849709,
-0.071955224,
-0.072060894,
-0.072166719,
-0.072272700,
-0.072378836,
-0.072485128,
-0.072591576,
-0.072698180,
-0.072804941,
-0.072911859,
-0.073018934,
-0.073126166,
-0.073233555,
-0.073341103,
-0.073448808,
-0.073556671,
-0.073664693,
-0.073772873,
-0.073881212,
-0.073989711,
-0.074098368,
-0.074207186,
-0.074316163,
-0.074425300,
-0.074534597,
-0.074644055,
-0.074753674,
-0.074863453,
-0.074973394,
-0.075083496,
-0.075193760,
-0.075304186,
-0.075414774,
-0.075525524,
-0.075636438,
-0.075747514,
-0.075858753,
-0.075970155,
-0.076081721,
-0.076193451,
-0.076305345,
-0.076417403,
-0.076529626,
-0.076642014,
-0.076754567,
-0.076867285,
-0.076980168,
-0.077093217,
-0.077206433,
-0.077319814,
-0.077433362,
-0.077547077,
-0.077660959,
-0.077775008,
-0.077889225,
-0.078003609,
-0.078118161,
-0.078232882,
-0.078347771,
-0.078462828,
-0.078578055,
-0.078693451,
-0.078809016,
-0.078924751,
-0.079040656,
-0.079156732,
-0.079272977,
-0.079389394,
-0.079505981,
-0.079622740,
-0.079739670,
-0.079856772,
-0.079974045,
-0.080091491,
-0.080209110,
-0.080326901,
-0.080444865,
-0.080563002,
-0.080681313,
-0.080799798,
-0.080918457,
-0.081037289,
-0.081156297,
-0.081275479,
-0.081394836,
-0.081514369,
-0.081634077,
-0.081753960,
-0.081874020,
-0.081994257,
-0.082114669,
-0.082235259,
-0.082356026,
-0.082476970,
-0.082598091,
-0.082719391,
-0.082840868,
-0.082962524,
-0.083084359,
-0.083206373,
-0.083328566,
-0.083450938,
-0.083573490,
-0.083696222,
-0.083819134,
-0.083942227,
-0.084065500,
-0.084188954,
-0.084312590,
-0.084436408,
-0.084560407,
-0.084684588,
-0.084808952,
-0.084933498,
-0.085058227,
-0.085183139,
-0.085308235,
-0.085433515,
-0.085558978,
-0.085684626,
-0.085810458,
-0.085936475,
-0.086062677,
-0.086189065,
-0.086315638,
-0.086442397,
-0.086569342,
-0.086696473,
-0.086823791,
-0.086951297,
-0.087078989,
-0.087206869,
-0.087334937,
-0.087463193,
-0.087591637,
-0.087720269,
-0.087849091,
-0.087978102,
-0.088107302,
-0.088236692,
-0.088366273,
-0.088496043,
-0.088626004,
-0.088756156,
-0.088886499,
-0.089017033,
-0.089147759,
-0.089278677,
-0.089409787,
-0.089541090,
-0.089672586,
-0.089804275,
-0.089936157,
-0.090068233,
-0.090200502,
-0.090332966,
-0.090465625,
-0.090598478,
-0.090731527,
-0.090864771,
-0.090998210,
-0.091131846,
-0.091265678,
-0.091399706,
-0.091533931,
-0.091668353,
-0.091802973,
-0.091937790,
-0.092072806,
-0.092208019,
-0.092343431,
-0.092479042,
-0.092614853,
-0.092750862,
-0.092887072,
-0.093023481,
-0.093160091,
-0.093296901,
-0.093433912,
-0.093571125,
-0.093708539,
-0.093846155,
-0.093983972,
-0.094121993,
-0.094260216,
-0.094398642,
-0.094537271,
-0.094676104,
-0.094815140,
-0.094954381,
-0.095093827,
-0.095233477,
-0.095373332,
-0.095513393,
-0.095653659,
-0.095794131,
-0.095934810,
-0.096075695,
-0.096216787,
-0.096358086,
-0.096499593,
-0.096641307,
-0.096783230,
-0.096925361,
-0.097067701,
-0.097210250,
-0.097353008,
-0.097495976,
-0.097639154,
-0.097782542,
-0.097926141,
-0.098069950,
-0.098213971,
-0.098358203,
-0.098502647,
-0.098647303,
-0.098792172,
-0.098937253,
-0.099082548,
-0.099228055,
-0.099373777,
-0.099519712,
-0.099665862,
-0.099812227,
-0.099958806,
-0.100105601,
-0.100252611,
-0.100399837,
-0.100547279,
-0.100694938,
-0.100842814,
-0.100990906,
-0.101139217,
-0.101287745,
-0.101436491,
-0.101585456,
-0.101734639,
-0.101884042,
-0.102033663,
-0.102183505,
-0.102333567,
-0.102483849,
-0.102634352,
-0.102785075,
-0.102936021,
-0.103087187,
-0.103238576,
-0.103390187,
-0.103542021,
-0.103694078,
-0.103846358,
-0.103998861,
-0.104151589,
-0.104304541,
-0.104457718,
-0.104611119,
-0.104764746,
-0.104918598,
-0.105072677,
-0.105226981,
-0.105381512,
-0.105536270,
-0.105691256,
-0.105846469,
-0.106001910,
-0.106157579,
-0.106313477,
-0.106469604,
-0.106625960,
-0.106782545,
-0.106939361,
-0.107096407,
-0.107253683,
-0.107411191,
-0.107568930,
-0.107726900,
-0.107885103,
-0.108043537,
-0.108202205,
-0.108361105,
-0.108520239,
-0.108679607,
-0.108839208,
-0.108999044,
-0.109159115,
-0.109319420,
-0.109479962,
-0.109640738,
-0.109801752,
-0.109963001,
-0.110124487,
-0.110286211,
-0.110448172,
-0.110610370,
-0.110772807,
-0.110935483,
-0.111098397,
-0.111261551,
-0.111424944,
-0.111588577,
-0.111752451,
-0.111916565,
-0.112080920,
-0.112245517,
-0.112410355,
-0.112575436,
-0.112740758,
-0.112906324,
-0.113072133,
-0.113238185,
-0.113404481,
-0.113571021,
-0.113737806,
-0.113904836,
-0.114072111,
-0.114239631,
-0.114407398,
-0.114575411,
-0.114743671,
-0.114912178,
-0.115080932,
-0.115249935,
-0.115419185,
-0.115588684,
-0.115758432,
-0.115928429,
-0.116098676,
-0.116269173,
-0.116439920,
-0.116610918,
-0.116782167,
-0.116953668,
-0.117125420,
-0.117297425,
-0.117469682,
-0.117642192,
-0.117814956,
-0.117987973,
-0.118161244,
-0.118334770,
-0.118508551,
-0.118682587,
-0.118856878,
-0.119031425,
-0.119206229,
-0.119381290,
-0.119556607,
-0.119732182,
-0.119908015,
-0.120084106,
-0.120260456,
-0.120437064,
-0.120613932,
-0.120791060,
-0.120968448,
-0.121146096,
-0.121324005,
-0.121502176,
-0.121680608,
-0.121859302,
-0.122038259,
-0.122217478,
-0.122396961,
-0.122576707,
-0.122756717,
-0.122936992,
-0.123117531,
-0.123298335,
-0.123479405,
-0.123660741,
-0.123842343,
-0.124024212,
-0.124206348,
-0.124388751,
-0.124571422,
-0.124754362,
-0.124937570,
-0.125121047,
-0.125304794,
-0.125488810,
-0.125673097,
-0.125857654,
-0.126042483,
-0.126227583,
-0.126412954,
-0.126598598,
-0.126784515,
-0.126970704,
-0.127157167,
-0.127343904,
-0.127530915,
-0.127718200,
-0.127905761,
-0.128093597,
-0.128281709,
-0.128470098,
-0.128658762,
-0.128847704,
-0.129036924,
-0.129226421,
-0.129416197,
-0.129606251,
-0.129796584,
-0.129987197,
-0.130178090,
-0.130369263,
-0.130560717,
-0.130752452,
-0.130944469,
-0.131136768,
-0.131329349,
-0.131522212,
-0.131715360,
-0.131908790,
-0.132102505,
-0.132296504,
-0.132490788,
-0.132685358,
-0.132880213,
-0.133075355,
-0.133270783,
-0.133466497,
-0.133662500,
-0.133858790,
-0.134055368,
-0.134252236,
-0.134449392,
-0.134646838,
-0.134844573,
-0.135042600,
-0.135240917,
-0.135439525,
-0.135638425,
-0.135837617,
-0.136037101,
-0.136236878,
-0.136436949,
-0.136637314,
-0.136837973,
-0.137038926,
-0.137240175,
-0.137441719,
-0.137643559,
-0.137845696,
-0.138048129,
-0.138250860,
-0.138453888,
-0.138657215,
-0.138860840,
-0.139064765,
-0.139268988,
-0.139473512,
-0.139678336,
-0.139883461,
-0.140088887,
-0.140294614,
-0.140500644,
-0.140706976,
-0.140913612,
-0.141120551,
-0.141327793,
-0.141535340,
-0.141743192,
-0.141951349,
-0.142159812,
-0.142368581,
-0.142577657,
-0.142787039,
-0.142996729,
-0.143206727,
-0.143417034,
-0.143627649,
-0.143838573,
-0.144049808,
-0.144261352,
-0.144473207,
-0.144685374,
-0.144897851,
-0.145110641,
-0.145323744,
-0.145537159,
-0.145750888,
-0.145964930,
-0.146179287,
-0.146393959,
-0.146608946,
-0.146824249,
-0.147039868,
-0.147255803,
-0.147472056,
-0.147688626,
-0.147905514,
-0.148122721,
-0.148340247,
-0.148558092,
-0.148776257,
-0.148994743,
-0.149213549,
-0.149432677,
-0.149652127,
-0.149871898,
-0.150091993,
-0.150312411,
-0.150533152,
-0.150754218,
-0.150975608,
-0.151197323,
-0.151419364,
-0.151641731,
-0.151864425,
-0.152087446,
-0.152310794,
-0.152534470,
-0.152758475,
-0.152982808,
-0.153207471,
-0.153432464,
-0.153657788,
-0.153883442,
-0.154109428,
-0.154335745,
-0.154562395,
-0.154789378,
-0.155016694,
-0.155244344,
-0.155472328,
-0.155700647,
-0.155929302,
-0.156158292,
-0.156387618,
-0.156617281,
-0.156847282,
-0.157077620,
-0.157308297,
-0.157539312,
-0.157770666,
-0.158002361,
-0.158234395,
-0.158466770,
-0.158699487,
-0.158932545,
-0.159165946,
-0.159399689,
-0.159633776,
-0.159868206,
-0.160102981,
-0.160338100,
-0.160573565,
-0.160809375,
-0.161045532,
-0.161282036,
-0.161518886,
-0.161756085,
-0.161993632,
-0.162231528,
-0.162469773,
-0.162708369,
-0.162947314,
-0.163186611,
-0.163426258,
-0.163666258,
-0.163906611,
-0.164147316,
-0.164388374,
-0.164629787,
-0.164871554,
-0.165113677,
-0.165356155,
-0.165598988,
-0.165842179,
-0.166085727,
-0.166329632,
-0.166573896,
-0.166818518,
-0.167063499,
-0.167308841,
-0.167554542,
-0.167800605,
-0.168047028,
-0.168293814,
-0.168540962,
-0.168788473,
-0.169036348,
-0.169284586,
-0.169533189,
-0.169782157,
-0.170031491,
-0.170281191,
-0.170531258,
-0.170781691,
-0.171032493,
-0.171283663,
-0.171535202,
-0.171787110,
-0.172039388,
-0.172292037,
-0.172545056,
-0.172798448,
-0.173052211,
-0.173306347,
-0.173560856,
-0.173815739,
-0.174070996,
-0.174326629,
-0.174582636,
-0.174839020,
-0.175095780,
-0.175352917,
-0.175610431,
-0.175868324,
-0.176126596,
-0.176385247,
-0.176644278,
-0.176903689,
-0.177163481,
-0.177423654,
-0.177684210,
-0.177945148,
-0.178206470,
-0.178468175,
-0.178730265,
-0.178992739,
-0.179255599,
-0.179518845,
-0.179782478,
-0.180046498,
-0.180310905,
-0.180575701,
-0.180840886,
-0.181106460,
-0.181372424,
-0.181638778,
-0.181905524,
-0.182172662,
-0.182440192,
-0.182708114,
-0.182976431,
-0.183245141,
-0.183514246,
-0.183783746,
-0.184053641,
-0.184323934,
-0.184594623,
-0.184865709,
-0.185137194,
-0.185409077,
-0.185681360,
-0.185954043,
-0.186227126,
-0.186500610,
-0.186774495,
-0.187048783,
-0.187323474,
-0.187598568,
-0.187874066,
-0.188149969,
-0.188426277,
-0.188702990,
-0.188980110,
-0.189257637,
-0.189535572,
-0.189813914,
-0.190092666,
-0.190371826,
-0.190651397,
-0.190931378,
-0.191211771,
-0.191492575,
-0.191773792,
-0.192055421,
-0.192337465,
-0.192619922,
-0.192902794,
-0.193186082,
-0.193469785,
-0.193753906,
-0.194038443,
-0.194323398,
-0.194608772,
-0.194894565,
-0.195180778,
-0.195467411,
-0.195754465,
-0.196041940,
-0.196329838,
-0.196618158,
-0.196906902,
-0.197196070,
-0.197485662,
-0.197775680,
-0.198066124,
-0.198356994,
-0.198648291,
-0.198940016,
-0.199232170,
-0.199524753,
-0.199817765,
-0.200111207,
-0.200405081,
-0.200699386,
-0.200994123,
-0.201289293,
-0.201584897,
-0.201880935,
-0.202177407,
-0.202474315,
-0.202771659,
-0.203069439,
-0.203367657,
-0.203666313,
-0.203965407,
-0.204264941,
-0.204564914,
-0.204865328,
-0.205166184,
-0.205467481,
-0.205769220,
-0.206071403,
-0.206374029,
-0.206677100,
-0.206980616,
-0.207284577,
-0.207588985,
-0.207893840,
-0.208199143,
-0.208504894,
-0.208811094,
-0.209117744,
-0.209424844,
-0.209732395,
-0.210040398,
-0.210348853,
-0.210657761,
-0.210967123,
-0.211276939,
-0.211587210,
-0.211897936,
-0.212209119,
-0.212520759,
-0.212832857,
-0.213145413,
-0.213458427,
-0.213771902,
-0.214085837,
-0.214400233,
-0.214715091,
-0.215030411,
-0.215346194,
-0.215662441,
-0.215979152,
-0.216296328,
-0.216613971,
-0.216932079,
-0.217250655,
-0.217569699,
-0.217889211,
-0.218209192,
-0.218529644,
-0.218850566,
-0.219171959,
-0.219493824,
-0.219816162,
-0.220138973,
-0.220462259,
-0.220786019,
-0.221110254,
-0.221434966,
-0.221760154,
-0.222085820,
-0.222411965,
-0.222738588,
-0.223065691,
-0.223393274,
-0.223721339,
-0.224049885,
-0.224378914,
-0.224708426,
-0.225038421,
-0.225368902,
-0.225699868,
-0.226031319,
-0.226363258,
-0.226695684,
-0.227028598,
-0.227362001,
-0.227695894,
-0.228030277,
-0.228365151,
-0.228700517,
-0.229036375,
-0.229372727,
-0.229709572,
-0.230046913,
-0.230384748,
-0.230723080,
-0.231061909,
-0.231401235,
-0.231741059,
-0.232081383,
-0.232422206,
-0.232763530,
-0.233105355,
-0.233447682,
-0.233790512,
-0.234133846,
-0.234477683,
-0.234822025,
-0.235166874,
-0.235512228,
-0.235858090,
-0.236204460,
-0.236551338,
-0.236898726,
-0.237246623,
-0.237595032,
-0.237943953,
-0.238293385,
-0.238643331,
-0.238993791,
-0.239344766,
-0.239696256,
-0.240048262,
-0.240400785,
-0.240753826,
-0.241107385,
-0.241461464,
-0.241816062,
-0.242171182,
-0.242526822,
-0.242882985,
-0.243239671,
-0.243596881,
-0.243954616,
-0.244312875,
-0.244671661,
-0.245030974,
-0.245390815,
-0.245751184,
-0.246112082,
-0.246473510,
-0.246835469,
-0.247197959,
-0.247560982,
-0.247924538,
-0.248288628,
-0.248653252,
-0.249018412,
-0.249384109,
-0.249750342,
-0.250117113,
-0.250484423,
-0.250852272,
-0.251220661,
-0.251589592,
-0.251959064,
-0.252329079,
-0.252699637,
-0.253070739,
-0.253442386,
-0.253814579,
-0.254187319,
-0.254560606,
-0.254934441,
-0.255308826,
-0.255683760,
-0.256059244,
-0.256435280,
-0.256811869,
-0.257189010,
-0.257566705,
-0.257944955,
-0.258323760,
-0.258703122,
-0.259083041,
-0.259463517,
-0.259844553,
-0.260226148,
-0.260608303,
-0.260991020,
-0.261374298,
-0.261758140,
-0.262142545,
-0.262527515,
-0.262913050,
-0.263299151,
-0.263685819,
-0.264073055,
-0.264460860,
-0.264849234,
-0.265238179,
-0.265627695,
-0.266017783,
-0.266408443,
-0.266799678,
-0.267191487,
-0.267583871,
-0.267976832,
-0.268370369,
-0.268764485,
-0.269159179,
-0.269554453,
-0.269950308,
-0.270346743,
-0.270743761,
-0.271141362,
-0.271539547,
-0.271938317,
-0.272337672,
-0.272737614,
-0.273138143,
-0.273539260,
-0.273940967,
-0.274343263,
-0.274746150,
-0.275149629,
-0.275553700,
-0.275958365,
-0.276363624,
-0.276769478,
-0.277175928,
-0.277582975,
-0.277990620,
-0.278398863,
-0.278807706,
-0.279217149,
-0.279627194,
-0.280037841,
-0.280449091,
-0.280860945,
-0.281273403,
-0.281686468,
-0.282100138,
-0.282514417,
-0.282929304,
-0.283344800,
-0.283760906,
-0.284177624,
-0.284594953,
-0.285012895,
-0.285431451,
-0.285850622,
-0.286270408,
-0.286690811,
-0.287111831,
-0.287533469,
-0.287955727,
-0.288378604,
-0.288802103,
-0.289226224,
-0.289650967,
-0.290076334,
-0.290502326,
-0.290928944,
-0.291356188,
-0.291784059,
-0.292212559,
-0.292641688,
-0.293071447,
-0.293501838,
-0.293932860,
-0.294364515,
-0.294796805,
-0.295229729,
-0.295663289,
-0.296097486,
-0.296532320,
-0.296967793,
-0.297403905,
-0.297840658,
-0.298278052,
-0.298716089,
-0.299154768,
-0.299594092,
-0.300034062,
-0.300474677,
-0.300915939,
-0.301357850,
-0.301800409,
-0.302243618,
-0.302687479,
-0.303131991,
-0.303577155,
-0.304022974,
-0.304469447,
-0.304916576,
-0.305364362,
-0.305812805,
-0.306261907,
-0.306711668,
-0.307162089,
-0.307613173,
-0.308064918,
-0.308517327,
-0.308970401,
-0.309424140,
-0.309878545,
-0.310333617,
-0.310789358,
-0.311245768,
-0.311702848,
-0.312160600,
-0.312619024,
-0.313078121,
-0.313537892,
-0.313998338,
-0.314459461,
-0.314921261,
-0.315383738,
-0.315846896,
-0.316310733,
-0.316775251,
-0.317240452,
-0.317706336,
-0.318172904,
-0.318640157,
-0.319108096,
-0.319576723,
-0.320046037,
-0.320516041,
-0.320986736,
-0.321458121,
-0.321930199,
-0.322402969,
-0.322876435,
-0.323350595,
-0.323825452,
-0.324301006,
-0.324777259,
-0.325254211,
-0.325731863,
-0.326210217,
-0.326689273,
-0.327169033,
-0.327649498,
-0.328130668,
-0.328612544,
-0.329095129,
-0.329578422,
-0.330062424,
-0.330547138,
-0.331032563,
-0.331518701,
-0.332005554,
-0.332493121,
-0.332981404,
-0.333470404,
-0.333960122,
-0.334450560,
-0.334941717,
-0.335433596,
-0.335926198,
-0.336419523,
-0.336913572,
-0.337408347,
-0.337903848,
-0.338400077,
-0.338897035,
-0.339394722,
-0.339893141,
-0.340392291,
-0.340892175,
-0.341392792,
-0.341894145,
-0.342396234,
-0.342899060,
-0.343402625,
-0.343906929,
-0.344411974,
-0.344917761,
-0.345424290,
-0.345931563,
-0.346439581,
-0.346948346,
-0.347457857,
-0.347968117,
-0.348479126,
-0.348990885,
-0.349503396,
-0.350016659,
-0.350530677,
-0.351045449,
-0.351560977,
-0.352077262,
-0.352594306,
-0.353112108,
-0.353630672,
-0.354149996,
-0.354670084,
-0.355190935,
-0.355712551,
-0.356234933,
-0.356758082,
-0.357281999,
-0.357806686,
-0.358332144,
-0.358858373,
-0.359385375,
-0.359913150,
-0.360441701,
-0.360971028,
-0.361501133,
-0.362032015,
-0.362563678,
-0.363096121,
-0.363629346,
-0.364163355,
-0.364698147,
-0.365233725,
-0.365770089,
-0.366307241,
-0.366845182,
-0.367383913,
-0.367923435,
-0.368463749,
-0.369004857,
-0.369546760,
-0.370089458,
-0.370632953,
-0.371177247,
-0.371722339,
-0.372268233,
-0.372814927,
-0.373362425,
-0.373910727,
-0.374459834,
-0.375009747,
-0.375560468,
-0.376111998,
-0.376664338,
-0.377217488,
-0.377771452,
-0.378326228,
-0.378881820,
-0.379438227,
-0.379995451,
-0.380553494,
-0.381112356,
-0.381672039,
-0.382232544,
-0.382793872,
-0.383356024,
-0.383919002,
-0.384482807,
-0.385047440,
-0.385612901,
-0.386179194,
-0.386746317,
-0.387314274,
-0.387883065,
-0.388452691,
-0.389023154,
-0.389594454,
-0.390166593,
-0.390739573,
-0.391313394,
-0.391888057,
-0.392463565,
-0.393039918,
-0.393617117,
-0.394195164,
-0.394774060,
-0.395353805,
-0.395934403,
-0.396515853,
-0.397098156,
-0.397681315,
-0.398265330,
-0.398850203,
-0.399435935,
-0.400022527,
-0.400609981,
-0.401198297,
-0.401787477,
-0.402377523,
-0.402968435,
-0.403560214,
-0.404152863,
-0.404746382,
-0.405340773,
-0.405936036,
-0.406532174,
-0.407129188,
-0.407727077,
-0.408325846,
-0.408925493,
-0.409526021,
-0.410127431,
-0.410729724,
-0.411332901,
-0.411936965,
-0.412541915,
-0.413147754,
-0.413754482,
-0.414362102,
-0.414970614,
-0.415580019,
-0.416190320,
-0.416801517,
-0.417413611,
-0.418026604,
-0.418640498,
-0.419255292,
-0.419870990,
-0.420487592,
-0.421105100,
-0.421723514,
-0.422342837,
-0.422963069,
-0.423584211,
-0.424206266,
-0.424829235,
-0.425453118,
-0.426077918,
-0.426703635,
-0.427330271,
-0.427957828,
-0.428586305,
-0.429215706,
-0.429846031,
-0.430477282,
-0.431109460,
-0.431742566,
-0.432376602,
-0.433011569,
-0.433647469,
-0.434284303,
-0.434922071,
-0.435560776,
-0.436200420,
-0.436841002,
-0.437482526,
-0.438124991,
-0.438768400,
-0.439412754,
-0.440058054,
-0.440704301,
-0.441351498,
-0.441999645,
-0.442648744,
-0.443298797,
-0.443949804,
-0.444601766,
-0.445254687,
-0.445908566,
-0.446563406,
-0.447219207,
-0.447875971,
-0.448533700,
-0.449192394,
-0.449852056,
-0.450512687,
-0.451174288,
-0.451836860,
-0.452500406,
-0.453164926,
-0.453830422,
-0.454496895,
-0.455164347,
-0.455832779,
-0.456502192,
-0.457172589,
-0.457843970,
-0.458516338,
-0.459189692,
-0.459864036,
-0.460539369,
-0.461215695,
-0.461893014,
-0.462571327,
-0.463250637,
-0.463930944,
-0.464612250,
-0.465294557,
-0.465977866,
-0.466662178,
-0.467347495,
-0.468033819,
-0.468721151,
-0.469409492,
-0.470098843,
-0.470789208,
-0.471480585,
-0.472172979,
-0.472866389,
-0.473560817,
-0.474256266,
-0.474952735,
-0.475650227,
-0.476348744,
-0.477048286,
-0.477748856,
-0.478450455,
-0.479153084,
-0.479856744,
-0.480561439,
-0.481267168,
-0.481973933,
-0.482681736,
-0.483390579,
-0.484100463,
-0.484811389,
-0.485523359,
-0.486236375,
-0.486950438,
-0.487665550,
-0.488381711,
-0.489098925,
-0.489817192,
-0.490536513,
-0.491256891,
-0.491978327,
-0.492700822,
-0.493424378,
-0.494148997,
-0.494874680,
-0.495601429,
-0.496329245,
-0.497058130,
-0.497788085,
-0.498519112,
-0.499251213,
-0.499984389,
-0.500718641,
-0.501453972,
-0.502190383,
-0.502927875,
-0.503666450,
-0.504406110,
-0.505146856,
-0.505888690,
-0.506631614,
-0.507375628,
-0.508120735,
-0.508866936,
-0.509614233,
-0.510362628,
-0.511112121,
-0.511862716,
-0.512614412,
-0.513367213,
-0.514121119,
-0.514876132,
-0.515632254,
-0.516389486,
-0.517147830,
-0.517907288,
-0.518667861,
-0.519429552,
-0.520192360,
-0.520956289,
-0.521721340,
-0.522487515,
-0.523254814,
-0.524023241,
-0.524792796,
-0.525563481,
-0.526335297,
-0.527108248,
-0.527882333,
-0.528657555,
-0.529433916,
-0.530211416,
-0.530990059,
-0.531769845,
-0.532550776,
-0.533332854,
-0.534116081,
-0.534900457,
-0.535685986,
-0.536472668,
-0.537260506,
-0.538049500,
-0.538839653,
-0.539630967,
-0.540423442,
-0.541217082,
-0.542011887,
-0.542807859,
-0.543605000,
-0.544403312,
-0.545202796,
-0.546003454,
-0.546805288,
-0.547608299,
-0.548412490,
-0.549217862,
-0.550024416,
-0.550832155,
-0.551641080,
-0.552451193,
-0.553262496,
-0.554074990,
-0.554888678,
-0.555703560,
-0.556519639,
-0.557336916,
-0.558155394,
-0.558975074,
-0.559795957,
-0.560618046,
-0.561441342,
-0.562265848,
-0.563091564,
-0.563918492,
-0.564746635,
-0.565575995,
-0.566406572,
-0.567238369,
-0.568071387,
-0.568905629,
-0.569741096,
-0.570577790,
-0.571415713,
-0.572254866,
-0.573095251,
-0.573936871,
-0.574779726,
-0.575623820,
-0.576469153,
-0.577315727,
-0.578163545,
-0.579012607,
-0.579862917,
-0.580714475,
-0.581567284,
-0.582421345,
-0.583276661,
-0.584133232,
-0.584991062,
-0.585850151,
-0.586710502,
-0.587572116,
-0.588434996,
-0.589299143,
-0.590164558,
-0.591031245,
-0.591899205,
-0.592768439,
-0.593638950,
-0.594510739,
-0.595383808,
-0.596258160,
-0.597133795,
-0.598010717,
-0.598888926,
-0.599768425,
-0.600649215,
-0.601531299,
-0.602414679,
-0.603299355,
-0.604185331,
-0.605072608,
-0.605961188,
-0.606851073,
-0.607742265,
-0.608634765,
-0.609528577,
-0.610423700,
-0.611320139,
-0.612217894,
-0.613116967,
-0.614017360,
-0.614919076,
-0.615822116,
-0.616726482,
-0.617632177,
-0.618539201,
-0.619447558,
-0.620357248,
-0.621268274,
-0.622180638,
-0.623094342,
-0.624009388,
-0.624925778,
-0.625843513,
-0.626762596,
-0.627683029,
-0.628604814,
-0.629527952,
-0.630452446,
-0.631378298,
-0.632305509,
-0.633234082,
-0.634164018,
-0.635095320,
-0.636027990,
-0.636962030,
-0.637897441,
-0.638834226,
-0.639772387,
-0.640711925,
-0.641652843,
-0.642595143,
-0.643538827,
-0.644483897,
-0.645430354,
-0.646378201,
-0.647327441,
-0.648278074,
-0.649230104,
-0.650183531,
-0.651138359,
-0.652094589,
-0.653052223,
-0.654011263,
-0.654971712,
-0.655933572,
-0.656896844,
-0.657861530,
-0.658827633,
-0.659795155,
-0.660764098,
-0.661734464,
-0.662706255,
-0.663679473,
-0.664654120,
-0.665630199,
-0.666607710,
-0.667586658,
-0.668567043,
-0.669548868,
-0.670532134,
-0.671516845,
-0.672503002,
-0.673490607,
-0.674479662,
-0.675470170,
-0.676462132,
-0.677455552,
-0.678450430,
-0.679446769,
-0.680444571,
-0.681443838,
-0.682444574,
-0.683446778,
-0.684450455,
-0.685455605,
-0.686462232,
-0.687470336,
-0.688479922,
-0.689490990,
-0.690503542,
-0.691517582,
-0.692533111,
-0.693550131,
-0.694568645,
-0.695588654,
-0.696610162,
-0.697633169,
-0.698657679,
-0.699683694,
-0.700711215,
-0.701740245,
-0.702770786,
-0.703802841,
-0.704836412,
-0.705871500,
-0.706908108,
-0.707946239,
-0.708985894,
-0.710027076,
-0.711069787,
-0.712114029,
-0.713159805,
-0.714207117,
-0.715255966,
-0.716306356,
-0.717358288,
-0.718411766,
-0.719466790,
-0.720523364,
-0.721581489,
-0.722641168,
-0.723702404,
-0.724765198,
-0.725829552,
-0.726895470,
-0.727962953,
-0.729032004,
-0.730102625,
-0.731174817,
-0.732248585,
-0.733323929,
-0.734400853,
-0.735479358,
-0.736559447,
-0.737641122,
-0.738724386,
-0.739809240,
-0.740895688,
-0.741983731,
-0.743073372,
-0.744164613,
-0.745257457,
-0.746351906,
-0.747447961,
-0.748545627,
-0.749644904,
-0.750745796,
-0.751848305,
-0.752952432,
-0.754058181,
-0.755165554,
-0.756274553,
-0.757385181,
-0.758497440,
-0.759611332,
-0.760726860,
-0.761844026,
-0.762962833,
-0.764083283,
-0.765205378,
-0.766329121,
-0.767454515,
-0.768581561,
-0.769710262,
-0.770840621,
-0.771972640,
-0.773106321,
-0.774241667,
-0.775378680,
-0.776517364,
-0.777657719,
-0.778799749,
-0.779943456,
-0.781088843,
-0.782235912,
-0.783384665,
-0.784535106,
-0.785687235,
-0.786841057,
-0.787996573,
-0.789153787,
-0.790312699,
-0.791473314,
-0.792635633,
-0.793799659,
-0.794965394,
-0.796132841,
-0.797302003,
-0.798472881,
-0.799645480,
-0.800819800,
-0.801995845,
-0.803173616,
-0.804353118,
-0.805534351,
-0.806717320,
-0.807902025,
-0.809088471,
-0.810276658,
-0.811466591,
-0.812658271,
-0.813851701,
-0.815046884,
-0.816243822,
-0.817442518,
-0.818642974,
-0.819845193,
-0.821049177,
-0.822254930,
-0.823462453,
-0.824671750,
-0.825882822,
-0.827095673,
-0.828310305,
-0.829526721,
-0.830744924,
-0.831964915,
-0.833186698,
-0.834410275,
-0.835635649,
-0.836862823,
-0.838091799,
-0.839322579,
-0.840555167,
-0.841789565,
-0.843025776,
-0.844263803,
-0.845503647,
-0.846745312,
-0.847988801,
-0.849234116,
-0.850481260,
-0.851730235,
-0.852981044,
-0.854233690,
-0.855488176,
-0.856744504,
-0.858002677,
-0.859262698,
-0.860524569,
-0.861788293,
-0.863053873,
-0.864321312,
-0.865590612,
-0.866861776,
-0.868134806,
-0.869409707,
-0.870686479,
-0.871965127,
-0.873245652,
-0.874528058,
-0.875812347,
-0.877098522,
-0.878386586,
-0.879676541,
-0.880968391,
-0.882262138,
-0.883557785,
-0.884855335,
-0.886154790,
-0.887456154,
-0.888759428,
-0.890064617,
-0.891371722,
-0.892680747,
-0.893991694,
-0.895304567,
-0.896619367,
-0.897936099,
-0.899254764,
-0.900575365,
-0.901897906,
-0.903222389,
-0.904548817,
-0.905877193,
-0.907207520,
-0.908539801,
-0.909874038,
-0.911210234,
-0.912548393,
-0.913888517,
-0.915230609,
-0.916574672,
-0.917920708,
-0.919268722,
-0.920618715,
-0.921970690,
-0.923324651,
-0.924680601,
-0.926038541,
-0.927398476,
-0.928760408,
-0.930124340,
-0.931490275,
-0.932858216,
-0.934228166,
-0.935600128,
-0.936974104,
-0.938350099,
-0.939728114,
-0.941108152,
-0.942490218,
-0.943874313,
-0.944653496,
-0.945433322,
-0.946213792,
-0.946994907,
-0.947776666,
-0.948559070,
-0.949342121,
-0.950125818,
-0.950910162,
-0.951695153,
-0.952480792,
-0.953267080,
-0.954054017,
-0.954841604,
-0.955629841,
-0.956418728,
-0.957208267,
-0.957998457,
-0.958789300,
-0.959580796,
-0.960372945,
-0.961165748,
-0.961959206,
-0.962753318,
-0.963548086,
-0.964343510,
-0.965139591,
-0.965936329,
-0.966733725,
-0.967531779,
-0.968330491,
-0.969129863,
-0.969929895,
-0.970730588,
-0.971531941,
-0.972333956,
-0.973136633,
-0.973939973,
-0.974743976,
-0.975548642,
-0.976353973,
-0.977159968,
-0.977966629,
-0.978773956,
-0.979581950,
-0.980390610,
-0.981199938,
-0.982009934,
-0.982820599,
-0.983631932,
-0.984443936,
-0.985256610,
-0.986069955,
-0.986883971,
-0.987698660,
-0.988514020,
-0.989330054,
-0.990146762,
-0.990964144,
-0.991782200,
-0.992600932,
-0.993420340,
-0.994240424,
-0.995061185,
-0.995882624,
-0.996704740,
-0.997527536,
-0.998351011,
-0.999175165,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000000000,
-1.000577790,
-1.001155913,
-1.001734370,
-1.002313162,
-1.002892288,
-1.003471749,
-1.004051544,
-1.004631674,
-1.005212140,
-1.005792941,
-1.006374078,
-1.006955550,
-1.007537358,
-1.008119503,
-1.008701984,
-1.009284801,
-1.009867955,
-1.010451446,
-1.011035275,
-1.011619440,
-1.012203943,
-1.012788784,
-1.013373963,
-1.013959480,
-1.014545335,
-1.015131529,
-1.015718061,
-1.016304932,
-1.016892142,
-1.017479692,
-1.018067581,
-1.018655810,
-1.019244379,
-1.019833287,
-1.020422536,
-1.021012126,
-1.021602056,
-1.022192327,
-1.022782939,
-1.023373892,
-1.023965187,
-1.024556823,
-1.025148801,
-1.025741121,
-1.026333784,
-1.026926789,
-1.027520136,
-1.028113827,
-1.028707860,
-1.029302237,
-1.029896957,
-1.030492020,
-1.031087428,
-1.031683179,
-1.032279275,
-1.032875715,
-1.033472500,
-1.034069629,
-1.034667104,
-1.035264924,
-1.035863089,
-1.036461600,
-1.037060457,
-1.037659659,
-1.038259208,
-1.038859103,
-1.039459345,
-1.040059934,
-1.040660870,
-1.041262153,
-1.041863783,
-1.042465761,
-1.043068087,
-1.043670760,
-1.044273782,
-1.044877153,
-1.045480872,
-1.046084940,
-1.046689357,
-1.047294123,
-1.047899238,
-1.048504704,
-1.049110519,
-1.049716684,
-1.050323199,
-1.050930065,
-1.051537281,
-1.052144848,
-1.052752766,
-1.053361036,
-1.053969657,
-1.054578630,
-1.055187954,
-1.055797631,
-1.056407659,
-1.057018041,
-1.057628774,
-1.058239861,
-1.058851301,
-1.059463094,
-1.060236745,
-1.061010961,
-1.061785742,
-1.062561089,
-1.063337002,
-1.064113482,
-1.064890529,
-1.065668143,
-1.066446325,
-1.067225075,
-1.068004394,
-1.068784282,
-1.069564739,
-1.070345767,
-1.071127364,
-1.071909533,
-1.072692272,
-1.073475584,
-1.074259467,
-1.075043922,
-1.075828951,
-1.076614553,
-1.077400728,
-1.078187477,
-1.078974801,
-1.079762700,
-1.080551174,
-1.081340224,
-1.082129851,
-1.082920053,
-1.083710833,
-1.084502191,
-1.085294126,
-1.086086639,
-1.086879731,
-1.087673403,
-1.088467653,
-1.089262484,
-1.090057895,
-1.090853888,
-1.091650461,
-1.092447616,
-1.093245353,
-1.094043673,
-1.094842575,
-1.095642061,
-1.096442131,
-1.097242785,
-1.098044024,
-1.098845848,
-1.099648257,
-1.100451252,
-1.101254834,
-1.102059002,
-1.102863758,
-1.103669101,
-1.104475033,
-1.105281552,
-1.106088661,
-1.106896359,
-1.107704647,
-1.108513526,
-1.109322995,
-1.110133055,
-1.110943706,
-1.111754950,
-1.112566786,
-1.113379214,
-1.114192236,
-1.115005852,
-1.115820062,
-1.116634866,
-1.117450266,
-1.118266260,
-1.119082851,
-1.119900038,
-1.120717822,
-1.121536202,
-1.122355181,
-1.123174757,
-1.123994932,
-1.124815706,
-1.125637080,
-1.126459053,
-1.127281626,
-1.128104800,
-1.128928575,
-1.129752951,
-1.130577930,
-1.131403511,
-1.132229695,
-1.133056482,
-1.133883873,
-1.134711868,
-1.135540468,
-1.136369673,
-1.137199483,
-1.138029899,
-1.138860922,
-1.139692551,
-1.140524788,
-1.141357632,
-1.142191085,
-1.143025146,
-1.143859817,
-1.144695096,
-1.145530986,
-1.146367486,
-1.147204597,
-1.148042320,
-1.148880654,
-1.149719600,
-1.150559159,
-1.151399330,
-1.152240116,
-1.153081515,
-1.153923529,
-1.154766158,
-1.155609401,
-1.156453261,
-1.157297737,
-1.158142830,
-1.158988539,
-1.159834867,
-1.160681812,
-1.161529376,
-1.162377558,
-1.163226360,
-1.164075782,
-1.164925824,
-1.165776487,
-1.166627771,
-1.167479677,
-1.168332204,
-1.169185355,
-1.170039128,
-1.170893525,
-1.171748545,
-1.172604190,
-1.173460460,
-1.174317355,
-1.175174876,
-1.176033023,
-1.176891796,
-1.177751197,
-1.178611225,
-1.179471882,
-1.180333167,
-1.181195080,
-1.182057623,
-1.182920796,
-1.183784600,
-1.184649034,
-1.185514099,
-1.186379796,
-1.187246125,
-1.188113087,
-1.188980682,
-1.189848910,
-1.190717773,
-1.191587269,
-1.192457401,
-1.193328168,
-1.194199571,
-1.195071611,
-1.195944287,
-1.196817600,
-1.197691551,
-1.198566141,
-1.199441369,
-1.200317236,
-1.201193743,
-1.202070889,
-1.202948676,
-1.203827105,
-1.204706174,
-1.205585886,
-1.206466240,
-1.207347237,
-1.208228877,
-1.209111161,
-1.209994089,
-1.210877662,
-1.211761880,
-1.212646744,
-1.213532254,
-1.214418411,
-1.215305215,
-1.216192666,
-1.217080765,
-1.217969513,
-1.218858910,
-1.219748957,
-1.220639653,
-1.221531000,
-1.222422997,
-1.223315646,
-1.224208947,
-1.225102900,
-1.225997506,
-1.226892765,
-1.227788678,
-1.228685245,
-1.229582467,
-1.230480344,
-1.231378876,
-1.232278065,
-1.233177911,
-1.234078413,
-1.234979573,
-1.235881391,
-1.236783868,
-1.237687004,
-1.238590799,
-1.239495254,
-1.240400369,
-1.241306146,
-1.242212584,
-1.243119684,
-1.244027446,
-1.244935871,
-1.245844960,
-1.246754712,
-1.247665129,
-1.248576210,
-1.249487957,
-1.250400370,
-1.251313448,
-1.252227194,
-1.253141607,
-1.254056687,
-1.254972436,
-1.255888854,
-1.256805940,
-1.257723697,
-1.258642123,
-1.259561220,
-1.260480989,
-1.261401429,
-1.262322541,
-1.263244326,
-1.264166784,
-1.265089915,
-1.266013721,
-1.266938201,
-1.267863356,
-1.268789187,
-1.269715694,
-1.270642877,
-1.271570738,
-1.272499276,
-1.273428492,
-1.274358386,
-1.275288960,
-1.276220213,
-1.277152147,
-1.278084760,
-1.279018055,
-1.279952031,
-1.280886690,
-1.281822031,
-1.282758054,
-1.283694762,
-1.284632153,
-1.285570229,
-1.286508990,
-1.287448436,
-1.288388569,
-1.289329388,
-1.290270894,
-1.291213087,
-1.292155969,
-1.293099539,
-1.294043798,
-1.294988746,
-1.295934385,
-1.296880714,
-1.297827734,
-1.298775446,
-1.299723849,
-1.300672946,
-1.301622735,
-1.302573218,
-1.303524395,
-1.304476266,
-1.305428833,
-1.306382095,
-1.307336054,
-1.308290708,
-1.309246060,
-1.310202110,
-1.311158858,
-1.312116304,
-1.313074450,
-1.314033295,
-1.314992841,
-1.315953087,
-1.316914034,
-1.317875683,
-1.318838035,
-1.319801089,
-1.320764846,
-1.321729307,
-1.322694472,
-1.323660342,
-1.324626918,
-1.325594199,
-1.326562186,
-1.327530881,
-1.328500283,
-1.329470392,
-1.330441210,
-1.331412737,
-1.332384974,
-1.333357920,
-1.334331577,
-1.335305945,
-1.336281024,
-1.337256816,
-1.338233320,
-1.339210537,
-1.340188467,
-1.341167112,
-1.342146471,
-1.343126546,
-1.344107336,
-1.345088842,
-1.346071066,
-1.347054006,
-1.348037664,
-1.349022040,
-1.350007136,
-1.350992950,
-1.351979485,
-1.352966740,
-1.353954715,
-1.354943413,
-1.355932832,
-1.356922974,
-1.357913838,
-1.358905427,
-1.359897739,
-1.360890776,
-1.361884538,
-1.362879026,
-1.363874240,
-1.364870181,
-1.365866849,
-1.366864245,
-1.367862369,
-1.368861222,
-1.369860804,
-1.370861117,
-1.371862159,
-1.372863933,
-1.373866438,
-1.374869676,
-1.375873646,
-1.376878349,
-1.377883786,
-1.378889957,
-1.379896862,
-1.380904503,
-1.381912880,
-1.382921993,
-1.383931843,
-1.384942430,
-1.385953756,
-1.386965820,
-1.387978623,
-1.388992165,
-1.390006448,
-1.391021471,
-1.392037235,
-1.393053742,
-1.394070990,
-1.395088981,
-1.396107716,
-1.397127195,
-1.398147418,
-1.399168386,
-1.400190099,
-1.401212559,
-1.402235765,
-1.403259719,
-1.404284420,
-1.405309869,
-1.406336068,
-1.407363015,
-1.408390713,
-1.409419161,
-1.410448360,
-1.411478310,
-1.412509013,
-1.413540468,
-1.414572677,
-1.415605639,
-1.416639356,
-1.417673827,
-1.418709054,
-1.419745037,
-1.420781776,
-1.421819272,
-1.422857526,
-1.423896538,
-1.424936309,
-1.425976839,
-1.427018129,
-1.428060179,
-1.429102990,
-1.430146563,
-1.431190898,
-1.432235995,
-1.433281856,
-1.434328480,
-1.435375868,
-1.436424022,
-1.437472941,
-1.438522625,
-1.439573076,
-1.440624295,
-1.441676281,
-1.442729035,
-1.443782557,
-1.444836850,
-1.445891912,
-1.446947744,
-1.448004348,
-1.449061723,
-1.450119870,
-1.451178790,
-1.452238483,
-1.453298950,
-1.454360191,
-1.455422207,
-1.456484999,
-1.457548567,
-1.458612911,
-1.459678033,
-1.460743932,
-1.461810610,
-1.462878067,
-1.463946303,
-1.465015320,
-1.466085117,
-1.467155695,
-1.468227055,
-1.469299197,
-1.470372122,
-1.471445831,
-1.472520323,
-1.473595601,
-1.474671663,
-1.475748511,
-1.476826146,
-1.477904567,
-1.478983777,
-1.480063774,
-1.481144559,
-1.482226134,
-1.483308499,
-1.484391654,
-1.485475600,
-1.486560338,
-1.487645868,
-1.488732190,
-1.489819306,
-1.490907215,
-1.491995919,
-1.493085418,
-1.494175713,
-1.495266803,
-1.496358691,
-1.497451376,
-1.498544858,
-1.499639140,
-1.500734220,
-1.501830100,
-1.502926780,
-1.504024261,
-1.505122543,
-1.506221628,
-1.507321515,
-1.508422205,
-1.509523699,
-1.510625997,
-1.511729100,
-1.512833009,
-1.513937724,
-1.515043245,
-1.516149574,
-1.517256711,
-1.518364656,
-1.519473410,
-1.520582974,
-1.521693348,
-1.522804533,
-1.523916529,
-1.525029337,
-1.526142958,
-1.527257392,
-1.528372640,
-1.529488703,
-1.530605580,
-1.531723273,
-1.532841782,
-1.533961107,
-1.535081251,
-1.536202212,
-1.537323991,
-1.538446590,
-1.539570009,
-1.540694248,
-1.541819308,
-1.542945189,
-1.544071893,
-1.545199419,
-1.546327769,
-1.547456942,
-1.548586941,
-1.549717764,
-1.550849413,
-1.551981889,
-1.553115191,
-1.554249321,
-1.555384279,
-1.556520066,
-1.557656683,
-1.558794129,
-1.559932406,
-1.561071514,
-1.562211454,
-1.563352226,
-1.564493832,
-1.565636271,
-1.566779544,
-1.567923652,
-1.569068596,
-1.570214376,
-1.571360992,
-1.572508446,
-1.573656737,
-1.574805867,
-1.575955836,
-1.577106645,
-1.578258295,
-1.579410785,
-1.580564117,
-1.581718291,
-1.582873308,
-1.584029168,
-1.585185872,
-1.586343421,
-1.587501815,
-1.588661056,
-1.589821142,
-1.590982076,
-1.592143858,
-1.593306487,
-1.594469966,
-1.595634295,
-1.596799474,
-1.597965503,
-1.599132384,
-1.600300117,
-1.601468703,
-1.602638142,
-1.603808435,
-1.604979583,
-1.606151586,
-1.607324445,
-1.608498160,
-1.609672732,
-1.610848162,
-1.612024451,
-1.613201598,
-1.614379605,
-1.615558472,
-1.616738200,
-1.617918789,
-1.619100241,
-1.620282555,
-1.621465733,
-1.622649774,
-1.623834680,
-1.625020452,
-1.626207089,
-1.627394593,
-1.628582964,
-1.629772203,
-1.630962310,
-1.632153286,
-1.633345132,
-1.634537849,
-1.635731436,
-1.636925895,
-1.638121226,
-1.639317430,
-1.640514507,
-1.641712459,
-1.642911285,
-1.644110987,
-1.645311565,
-1.646513019,
-1.647715351,
-1.648918561,
-1.650122649,
-1.651327617,
-1.652533464,
-1.653740193,
-1.654947802,
-1.656156293,
-1.657365667,
-1.658575924,
-1.659787064,
-1.660999089,
-1.662211999,
-1.663425795,
-1.664640477,
-1.665856046,
-1.667072503,
-1.668289847,
-1.669508081,
-1.670727205,
-1.671947219,
-1.673168123,
-1.674389920,
-1.675612608,
-1.676836189,
-1.678060664,
-1.679286033,
-1.680512296,
-1.681739455,
-1.682967511,
-1.684196463,
-1.685426312,
-1.686657060,
-1.687888706,
-1.689121251,
-1.690354697,
-1.691589043,
-1.692824291,
-1.694060441,
-1.695297493,
-1.696535449,
-1.697774308,
-1.699014073,
-1.700254742,
-1.701496318,
-1.702738800,
-1.703982190,
-1.705226487,
-1.706471693,
-1.707717809,
-1.708964834,
-1.710212770,
-1.711461617,
-1.712711377,
-1.713962048,
-1.715213634,
-1.716466133,
-1.717719546,
-1.718973875,
-1.720229120,
-1.721485282,
-1.722742360,
-1.724000357,
-1.725259272,
-1.726519107,
-1.727779862,
-1.729041537,
-1.730304134,
-1.731567652,
-1.732832093,
-1.734097458,
-1.735363747,
-1.736630960,
-1.737899098,
-1.739168163,
-1.740438154,
-1.741709073,
-1.742980920,
-1.744253695,
-1.745527400,
-1.746802035,
-1.748077601,
-1.749354098,
-1.750631528,
-1.751909890,
-1.753189186,
-1.754469416,
-1.755750580,
-1.757032681,
-1.758315717,
-1.759599691,
-1.760884602,
-1.762170451,
-1.763457239,
-1.764744967,
-1.766033636,
-1.767323245,
-1.768613796,
-1.769905289,
-1.771197726,
-1.772491106,
-1.773785431,
-1.775080701,
-1.776376916,
-1.777674079,
-1.778972188,
-1.780271245,
-1.781571251,
-1.782872207,
-1.784174112,
-1.785476968,
-1.786780775,
-1.788085535,
-1.789391247,
-1.790697913,
-1.792005533,
-1.793314107,
-1.794623638,
-1.795934124,
-1.797245568,
-1.798557969,
-1.799871328,
-1.801185647,
-1.802500925,
-1.803817164,
-1.805134364,
-1.806452526,
-1.807771650,
-1.809091738,
-1.810412789,
-1.811734805,
-1.813057787,
-1.814381735,
-1.815706649,
-1.817032531,
-1.818359381,
-1.819687200,
-1.821015989,
-1.822345748,
-1.823676478,
-1.825008180,
-1.826340854,
-1.827674502,
-1.829009123,
-1.830344719,
-1.831681290,
-1.833018837,
-1.834357361,
-1.835696862,
-1.837037341,
-1.838378800,
-1.839721238,
-1.841064656,
-1.842409055,
-1.843754436,
-1.845100799,
-1.846448145,
-1.847796476,
-1.849145791,
-1.850496091,
-1.851847377,
-1.853199650,
-1.854552910,
-1.855907159,
-1.857262397,
-1.858618624,
-1.859975841,
-1.861334050,
-1.862693250,
-1.864053443,
-1.865414630,
-1.866776810,
-1.868139985,
-1.869504155,
-1.870869322,
-1.872235485,
-1.873602646,
-1.874970805,
-1.876339964,
-1.877710122,
-1.879081281,
-1.880453440,
-1.881826602,
-1.883200767,
-1.884575935,
-1.885952108,
-1.887329285,
-1.888707468,
-1.890086657,
-1.891466854,
-1.892848058,
-1.894230271,
-1.895613493,
-1.896997725,
-1.898382968,
-1.899769223,
-1.901156490,
-1.902544770,
-1.903934063,
-1.905324372,
-1.906715695,
-1.908108035,
-1.909501391,
-1.910895764,
-1.912291156,
-1.913687567,
-1.915084997,
-1.916483448,
-1.917882921,
-1.919283415,
-1.920684931,
-1.922087472,
-1.923491036,
-1.924895625,
-1.926301240,
-1.927707882,
-1.929115550,
-1.930524247,
-1.931933972,
-1.933344726,
-1.934756511,
-1.936169327,
-1.937583174,
-1.938998054,
-1.940413967,
-1.941830914,
-1.943248895,
-1.944667912,
-1.946087965,
-1.947509056,
-1.948931184,
-1.950354350,
-1.951778556,
-1.953203801,
-1.954630088,
-1.956057416,
-1.957485786,
-1.958915199,
-1.960345656,
-1.961777158,
-1.963209705,
-1.964643298,
-1.966077937,
-1.967513625,
-1.968950361,
-1.970388146,
-1.971826981,
-1.973266866,
-1.974707803,
-1.976149793,
-1.977592835,
-1.979036931,
-1.980482081,
-1.981928287,
-1.983375549,
-1.984823868,
-1.986273244,
-1.987723679,
-1.989175173,
-1.990627726,
-1.992081341,
-1.993536017,
-1.994991755,
-1.996448556,
-1.997906421,
-1.999365351,
-2.000825345,
-2.002286407,
-2.003748534,
-2.005211730,
-2.006675994,
-2.008141328,
-2.009607731,
-2.011075205,
-2.012543751,
-2.014013369,
-2.015484060,
-2.016955826,
-2.018428666,
-2.019902581,
-2.021377573,
-2.022853642,
-2.024330789,
-2.025809014,
-2.027288319,
-2.028768704,
-2.030250170,
-2.031732718,
-2.033216349,
-2.034701062,
-2.036186861,
-2.037673744,
-2.039161712,
-2.040650768,
-2.042140911,
-2.043632141,
-2.045124461,
-2.046617871,
-2.048112371,
-2.049607962,
-2.051104646,
-2.052602422,
-2.054101292,
-2.055601257,
-2.057102317,
-2.058604473,
-2.060107726,
-2.061612077,
-2.063117526,
-2.064624075,
-2.066131724,
-2.067640473,
-2.069150325,
-2.070661279,
-2.072173336,
-2.073686497,
-2.075200764,
-2.076716136,
-2.078232615,
-2.079750201,
-2.081268895,
-2.082788698,
-2.084309611,
-2.085831635,
-2.087354770,
-2.088879018,
-2.090404378,
-2.091930852,
-2.093458441,
-2.094987146,
-2.096516966,
-2.098047904,
-2.099579960,
-2.101113135,
-2.102647429,
-2.104182843,
-2.105719379,
-2.107257037,
-2.108795817,
-2.110335722,
-2.111876750,
-2.113418904,
-2.114962184,
-2.116506591,
-2.118052126,
-2.119598790,
-2.121146583,
-2.122695506,
-2.124245560,
-2.125796746,
-2.127349065,
-2.128902517,
-2.130457104,
-2.132012826,
-2.133569684,
-2.135127679,
-2.136686811,
-2.138247082,
-2.139808493,
-2.141371043,
-2.142934735,
-2.144499568,
-2.146065545,
-2.147632664,
-2.149200928,
-2.150770338,
-2.152340893,
-2.153912595,
-2.155485445,
-2.157059443,
-2.158634591,
-2.160210889,
-2.161788338,
-2.163366939,
-2.164946692,
-2.166527600,
-2.168109661,
-2.169692878,
-2.171277251,
-2.172862781,
-2.174449469,
-2.176037316,
-2.177626321,
-2.179216488,
-2.180807815,
-2.182400305,
-2.183993957,
-2.185588773,
-2.187184754,
-2.188781900,
-2.190380212,
-2.191979692,
-2.193580340,
-2.195182156,
-2.196785142,
-2.198389299,
-2.199994627,
-2.201601127,
-2.203208800,
-2.204817648,
-2.206427670,
-2.208038868,
-2.209651242,
-2.211264794,
-2.212879524,
-2.214495433,
-2.216112522,
-2.217730792,
-2.219350244,
-2.220970878,
-2.222592696,
-2.224215698,
-2.225839885,
-2.227465259,
-2.229091819,
-2.230719567,
-2.232348503,
-2.233978629,
-2.235609945,
-2.237242453,
-2.238876153,
-2.240511045,
-2.242147132,
-2.243784413,
-2.245422890,
-2.247062563,
-2.248703434,
-2.250345503,
-2.251988771,
-2.253633239,
-2.255278908,
-2.256925778,
-2.258573851,
-2.260223128,
-2.261873608,
-2.263525295,
-2.265178187,
-2.266832286,
-2.268487593,
-2.270144109,
-2.271801834,
-2.273460770,
-2.275120918,
-2.276782277,
-2.278444850,
-2.280108637,
-2.281773639,
-2.283439857,
-2.285107291,
-2.286775943,
-2.288445814,
-2.290116904,
-2.291789214,
-2.293462745,
-2.295137498,
-2.296813475,
-2.298490675,
-2.300169100,
-2.301848751,
-2.303529628,
-2.305211732,
-2.306895065,
-2.308579627,
-2.310265419,
-2.311952443,
-2.313640698,
-2.315330186,
-2.317020907,
-2.318712864,
-2.320406055,
-2.322100484,
-2.323796149,
-2.325493053,
-2.327191196,
-2.328890579,
-2.330591203,
-2.332293068,
-2.333996177,
-2.335700529,
-2.337406126,
-2.339112968,
-2.340821056,
-2.342530392,
-2.344240976,
-2.345952809,
-2.347665892,
-2.349380227,
-2.351095813,
-2.352812651,
-2.354530744,
-2.356250091,
-2.357970693,
-2.359692552,
-2.361415669,
-2.363140043,
-2.364865677,
-2.366592571,
-2.368320726,
-2.370050143,
-2.371780823,
-2.373512766,
-2.375245975,
-2.376980448,
-2.378716189,
-2.380453197,
-2.382191473,
-2.383931019,
-2.385671835,
-2.387413922,
-2.389157281,
-2.390901914,
-2.392647820,
-2.394395001,
-2.396143459,
-2.397893192,
-2.399644204,
-2.401396494,
-2.403150064,
-2.404904914,
-2.406661046,
-2.408418460,
-2.410177158,
-2.411937139,
-2.413698406,
-2.415460959,
-2.417224799,
-2.418989927,
-2.420756344,
-2.422524051,
-2.424293049,
-2.426063338,
-2.427834921,
-2.429607797,
-2.431381967,
-2.433157433,
-2.434934196,
-2.436712256,
-2.438491614,
-2.440272272,
-2.442054230,
-2.443837489,
-2.445622051,
-2.447407915,
-2.449195084,
-2.450983557,
-2.452773337,
-2.454564424,
-2.456356818,
-2.458150522,
-2.459945535,
-2.461741859,
-2.463539495,
-2.465338443,
-2.467138705,
-2.468940282,
-2.470743174,
-2.472547383,
-2.474352909,
-2.476159754,
-2.477967918,
-2.479777402,
-2.481588208,
-2.483400336,
-2.485213788,
-2.487028563,
-2.488844664,
-2.490662091,
-2.492480845,
-2.494300928,
-2.496122339,
-2.497945080,
-2.499769153,
-2.501594557,
-2.503421294,
-2.505249366,
-2.507078772,
-2.508909514,
-2.510741593,
-2.512575010,
-2.514409765,
-2.516245861,
-2.518083297,
-2.519922075,
-2.521762195,
-2.523603660,
-2.525446469,
-2.527290623,
-2.529136125,
-2.530982974,
-2.532831171,
-2.534680718,
-2.536531616,
-2.538383866,
-2.540237468,
-2.542092423,
-2.543948733,
-2.545806399,
-2.547665421,
-2.549525801,
-2.551387539,
-2.553250636,
-2.555115094,
-2.556980914,
-2.558848096,
-2.560716642,
-2.562586552,
-2.564457827,
-2.566330469,
-2.568204478,
-2.570079856,
-2.571956604,
-2.573834721,
-2.575714211,
-2.577595072,
-2.579477307,
-2.581360917,
-2.583245902,
-2.585132263,
-2.587020002,
-2.588909120,
-2.590799617,
-2.592691494,
-2.594584753,
-2.596479395,
-2.598375420,
-2.600272829,
-2.602171625,
-2.604071806,
-2.605973375,
-2.607876333,
-2.609780681,
-2.611686419,
-2.613593548,
-2.615502070,
-2.617411986,
-2.619323297,
-2.621236003,
-2.623150106,
-2.625065607,
-2.626982507,
-2.628900806,
-2.630820506,
-2.632741608,
-2.634664113,
-2.636588021,
-2.638513335,
-2.640440054,
-2.642368180,
-2.644297715,
-2.646228658,
-2.648161012,
-2.650094776,
-2.652029952,
-2.653966542,
-2.655904546,
-2.657843965,
-2.659784800,
-2.661727053,
-2.663670723,
-2.665615813,
-2.667562324,
-2.669510256,
-2.671459610,
-2.673410388,
-2.675362590,
-2.677316218,
-2.679271272,
-2.681227754,
-2.683185665,
-2.685145006,
-2.687105777,
-2.689067980,
-2.691031616,
-2.692996686,
-2.694963190,
-2.696931131,
-2.698900509,
-2.700871325,
-2.702843580,
-2.704817275,
-2.706792412,
-2.708768990,
-2.710747012,
-2.712726479,
-2.714707391,
-2.716689750,
-2.718673556,
-2.720658810,
-2.722645515,
-2.724633670,
-2.726623277,
-2.728614337,
-2.730606851,
-2.732600820,
-2.734596244,
-2.736593126,
-2.738591467,
-2.740591266,
-2.742592526,
-2.744595247,
-2.746599430,
-2.748605077,
-2.750612189,
-2.752620766,
-2.754630810,
-2.756642322,
-2.758655303,
-2.760669753,
-2.762685675,
-2.764703069,
-2.766721935,
-2.768742277,
-2.770764093,
-2.772787386,
-2.774812156,
-2.776838405,
-2.778866133,
-2.780895342,
-2.782926033,
-2.784958207,
-2.786991865,
-2.789027008,
-2.791063636,
-2.793101753,
-2.795141357,
-2.797182451,
-2.799225035,
-2.801269111,
-2.803314679,
-2.805361741,
-2.807410298,
-2.809460351,
-2.811511901,
-2.813564949,
-2.815619496,
-2.817675544,
-2.819733093,
-2.821792144,
-2.823852699,
-2.825914759,
-2.827978324,
-2.830043396,
-2.832109977,
-2.834178066,
-2.836247666,
-2.838318776,
-2.840391400,
-2.842465536,
-2.844541188,
-2.846618355,
-2.848697038,
-2.850777240,
-2.852858961,
-2.854942202,
-2.857026964,
-2.859113248,
-2.861201056,
-2.863290389,
-2.865381247,
-2.867473632,
-2.869567545,
-2.871662987,
-2.873759959,
-2.875858462,
-2.877958498,
-2.880060067,
-2.882163171,
-2.884267811,
-2.886373987,
-2.888481702,
-2.890590955,
-2.892701749,
-2.894814084,
-2.896927962,
-2.899043383,
-2.901160349,
-2.903278861,
-2.905398920,
-2.907520527,
-2.909643684,
-2.911768390,
-2.913894649,
-2.916022460,
-2.918151824,
-2.920282744,
-2.922415219,
-2.924549252,
-2.926684844,
-2.928821994,
-2.930960705,
-2.933100979,
-2.935242814,
-2.937386214,
-2.939531179,
-2.941677711,
-2.943825810,
-2.945975477,
-2.948126715,
-2.950279523,
-2.952433903,
-2.954589856,
-2.956747384,
-2.958906487,
-2.961067167,
-2.963229425,
-2.965393261,
-2.967558678,
-2.969725676,
-2.971894256,
-2.974064420,
-2.976236169,
-2.978409503,
-2.980584425,
-2.982760935,
-2.984939034,
-2.987118723,
-2.989300004,
-2.991482878,
-2.993667347,
-2.995853410,
-2.998041069,
-3.000230326,
-3.002421182,
-3.004613638,
-3.006807694,
-3.009003353,
-3.011200615,
-3.013399482,
-3.015599954,
-3.017802033,
-3.020005720,
-3.022211016,
-3.024417923,
-3.026626441,
-3.028836572,
-3.031048317,
-3.033261677,
-3.035476653,
-3.037693247,
-3.039911459,
-3.042131291,
-3.044352744,
-3.046575819,
-3.048800518,
-3.051026841,
-3.053254790,
-3.055484365,
-3.057715569,
-3.059948402,
-3.062182866,
-3.064418961,
-3.066656689,
-3.068896052,
-3.071137049,
-3.073379683,
-3.075623954,
-3.077869865,
-3.080117415,
-3.082366607,
-3.084617441,
-3.086869918,
-3.089124041,
-3.091379809,
-3.093637225,
-3.095896289,
-3.098157003,
-3.100419368,
-3.102683384,
-3.104949054,
-3.107216379,
-3.109485359,
-3.111755996,
-3.114028291,
-3.116302245,
-3.118577860,
-3.120855136,
-3.123134076,
-3.125414680,
-3.127696949,
-3.129980884,
-3.132266488,
-3.134553760,
-3.136842703,
-3.139133317,
-3.141425603,
-3.143719564,
-3.146015200,
-3.148312512,
-3.150611501,
-3.152912170,
-3.155214518,
-3.157518548,
-3.159824260,
-3.162131656,
-3.164440737,
-3.166751504,
-3.169063958,
-3.171378101,
-3.173693934,
-3.176011458,
-3.178330674,
-3.180651584,
-3.182974189,
-3.185298489,
-3.187624487,
-3.189952183,
-3.192281580,
-3.194612677,
-3.196945476,
-3.199279979,
-3.201616187,
-3.203954100,
-3.206293721,
-3.208635050,
-3.210978089,
-3.213322839,
-3.215669301,
-3.218017477,
-3.220367367,
-3.222718973,
-3.225072297,
-3.227427338,
-3.229784100,
-3.232142583,
-3.234502787,
-3.236864716,
-3.239228369,
-3.241593748,
-3.243960854,
-3.246329689,
-3.248700254,
-3.251072549,
-3.253446577,
-3.255822339,
-3.258199836,
-3.260579068,
-3.262960038,
-3.265342747,
-3.267727195,
-3.270113385,
-3.272501317,
-3.274890993,
-3.277282414,
-3.279675581,
-3.282070496,
-3.284467160,
-3.286865574,
-3.289265739,
-3.291667657,
-3.294071328,
-3.296476755,
-3.298883939,
-3.301292880,
-3.303703581,
-3.306116041,
-3.308530264,
-3.310946249,
-3.313363999,
-3.315783514,
-3.318204796,
-3.320627845,
-3.323052665,
-3.325479255,
-3.327907617,
-3.330337752,
-3.332769662,
-3.335203348,
-3.337638810,
-3.340076052,
-3.342515073,
-3.344955875,
-3.347398459,
-3.349842827,
-3.352288980,
-3.354736919,
-3.357186646,
-3.359638162,
-3.362091467,
-3.364546565,
-3.367003455,
-3.369462139,
-3.371922618,
-3.374384895,
-3.376848969,
-3.379314843,
-3.381782517,
-3.384251993,
-3.386723273,
-3.389196357,
-3.391671247,
-3.394147944,
-3.396626450,
-3.399106766,
-3.401588893,
-3.404072832,
-3.406558586,
-3.409046154,
-3.411535539,
-3.414026742,
-3.416519764,
-3.419014606,
-3.421511270,
-3.424009758,
-3.426510070,
-3.429012207,
-3.431516172,
-3.434021965,
-3.436529588,
-3.439039043,
-3.441550329,
-3.444063450,
-3.446578405,
-3.449095197,
-3.451613827,
-3.454134296,
-3.456656606,
-3.459180758,
-3.461706752,
-3.464234592,
-3.466764277,
-3.469295809,
-3.471829190,
-3.474364421,
-3.476901503,
-3.479440438,
-3.481981227,
-3.484523872,
-3.487068373,
-3.489614732,
-3.492162950,
-3.494713029,
-3.497264971,
-3.499818776,
-3.502374446,
-3.504931982,
-3.507491385,
-3.510052658,
-3.512615801,
-3.515180815,
-3.517747703,
-3.520316465,
-3.522887103,
-3.525459618,
-3.528034011,
-3.530610284,
-3.533188439,
-3.535768476,
-3.538350398,
-3.540934204,
-3.543519898,
-3.546107479,
-3.548696951,
-3.551288313,
-3.553881567,
-3.556476715,
-3.559073758,
-3.561672698,
-3.564273535,
-3.566876271,
-3.569480909,
-3.572087448,
-3.574695890,
-3.577306237,
-3.579918491,
-3.582532652,
-3.585148722,
-3.587766702,
-3.590386594,
-3.593008399,
-3.595632118,
-3.598257754,
-3.600885307,
-3.603514778,
-3.606146170,
-3.608779483,
-3.611414719,
-3.614051879,
-3.616690966,
-3.619331979,
-3.621974921,
-3.624619792,
-3.627266596,
-3.629915331,
-3.632566002,
-3.635218607,
-3.637873150,
-3.640529631,
-3.643188052,
-3.645848414,
-3.648510719,
-3.651174968,
-3.653841163,
-3.656509304,
-3.659179394,
-3.661851433,
-3.664525424,
-3.667201367,
-3.669879265,
-3.672559118,
-3.675240928,
-3.677924696,
-3.680610424,
-3.683298113,
-3.685987765,
-3.688679380,
-3.691372962,
-3.694068510,
-3.696766027,
-3.699465513,
-3.702166971,
-3.704870401,
-3.707575805,
-3.710283186,
-3.712992543,
-3.715703878,
-3.718417193,
-3.721132490,
-3.723849770,
-3.726569033,
-3.729290283,
-3.732013519,
-3.734738745,
-3.737465960,
-3.740195167,
-3.742926366,
-3.745659560,
-3.748394750,
-3.751131937,
-3.753871123,
-3.756612310,
-3.759355497,
-3.762100689,
-3.764847884,
-3.767597086,
-3.770348295,
-3.773101514,
-3.775856742,
-3.778613983,
-3.781373237,
-3.784134506,
-3.786897792,
-3.789663095,
-3.792430418,
-3.795199761,
-3.797971127,
-3.800744516,
-3.803519931,
-3.806297372,
-3.809076841,
-3.811858340,
-3.814641870,
-3.817427433,
-3.820215030,
-3.823004663,
-3.825796332,
-3.828590040,
-3.831385788,
-3.834183578,
-3.836983411,
-3.839785288,
-3.842589211,
-3.845395182,
-3.848203202,
-3.851013272,
-3.853825394,
-3.856639570,
-3.859455801,
-3.862274088,
-3.865094433,
-3.867916838,
-3.870741304,
-3.873567832,
-3.876396424,
-3.879227082,
-3.882059807,
-3.884894600,
-3.887731464,
-3.890570399,
-3.893411407,
-3.896254489,
-3.899099648,
-3.901946884,
-3.904796200,
-3.907647596,
-3.910501074,
-3.913356636,
-3.916214283,
-3.919074017,
-3.921935839,
-3.924799751,
-3.927665755,
-3.930533851,
-3.933404041,
-3.936276328,
-3.939150712,
-3.942027194,
-3.944905778,
-3.947786463,
-3.950669252,
-3.953554146,
-3.956441146,
-3.959330255,
-3.962221474,
-3.965114803,
-3.968010246,
-3.970907803,
-3.973807475,
-3.976709266,
-3.979613175,
-3.982519204,
-3.985427356,
-3.988337631,
-3.991250032,
-3.994164559,
-3.997081215,
-4.000000000
-};
@@ -0,0 +1,516 @@
+// Fade-in half of the time-stretch grain window: sin^2, Q15, 512 entries (TS_HOP_FRAMES)
+// The fade-out half is 32768 minus this
+const int16_t ts_fade_lut[512]={
+0,
+0,
+1,
+2,
+4,
+7,
+11,
+15,
+19,
+24,
+30,
+37,
+44,
+52,
+60,
+69,
+78,
+89,
+99,
+111,
+123,
+135,
+149,
+162,
+177,
+192,
+208,
+224,
+241,
+258,
+276,
+295,
+314,
+334,
+355,
+376,
+398,
+420,
+443,
+466,
+490,
+515,
+541,
+566,
+593,
+620,
+648,
+676,
+705,
+734,
+765,
+795,
+826,
+858,
+891,
+924,
+957,
+991,
+1026,
+1061,
+1097,
+1134,
+1171,
+1208,
+1247,
+1285,
+1325,
+1365,
+1405,
+1446,
+1488,
+1530,
+1572,
+1616,
+1660,
+1704,
+1749,
+1794,
+1840,
+1887,
+1934,
+1982,
+2030,
+2079,
+2128,
+2178,
+2228,
+2279,
+2330,
+2382,
+2435,
+2488,
+2541,
+2595,
+2650,
+2705,
+2761,
+2817,
+2873,
+2930,
+2988,
+3046,
+3105,
+3164,
+3224,
+3284,
+3344,
+3406,
+3467,
+3529,
+3592,
+3655,
+3718,
+3782,
+3847,
+3912,
+3977,
+4043,
+4110,
+4176,
+4244,
+4311,
+4380,
+4448,
+4517,
+4587,
+4657,
+4727,
+4798,
+4869,
+4941,
+5013,
+5086,
+5159,
+5232,
+5306,
+5381,
+5455,
+5530,
+5606,
+5682,
+5758,
+5835,
+5912,
+5989,
+6067,
+6146,
+6224,
+6303,
+6383,
+6463,
+6543,
+6623,
+6704,
+6786,
+6867,
+6949,
+7032,
+7114,
+7197,
+7281,
+7365,
+7449,
+7533,
+7618,
+7703,
+7788,
+7874,
+7960,
+8047,
+8133,
+8220,
+8308,
+8395,
+8483,
+8571,
+8660,
+8749,
+8838,
+8927,
+9017,
+9107,
+9197,
+9287,
+9378,
+9469,
+9560,
+9652,
+9744,
+9836,
+9928,
+10021,
+10113,
+10206,
+10300,
+10393,
+10487,
+10581,
+10675,
+10769,
+10864,
+10958,
+11053,
+11148,
+11244,
+11339,
+11435,
+11531,
+11627,
+11723,
+11820,
+11917,
+12013,
+12110,
+12207,
+12305,
+12402,
+12500,
+12597,
+12695,
+12793,
+12892,
+12990,
+13088,
+13187,
+13285,
+13384,
+13483,
+13582,
+13681,
+13780,
+13880,
+13979,
+14079,
+14178,
+14278,
+14377,
+14477,
+14577,
+14677,
+14777,
+14877,
+14977,
+15078,
+15178,
+15278,
+15378,
+15479,
+15579,
+15680,
+15780,
+15880,
+15981,
+16081,
+16182,
+16282,
+16383,
+16484,
+16584,
+16685,
+16785,
+16886,
+16986,
+17086,
+17187,
+17287,
+17388,
+17488,
+17588,
+17688,
+17789,
+17889,
+17989,
+18089,
+18189,
+18289,
+18389,
+18488,
+18588,
+18687,
+18787,
+18886,
+18986,
+19085,
+19184,
+19283,
+19382,
+19481,
+19579,
+19678,
+19776,
+19874,
+19973,
+20071,
+20169,
+20266,
+20364,
+20461,
+20559,
+20656,
+20753,
+20849,
+20946,
+21043,
+21139,
+21235,
+21331,
+21427,
+21522,
+21618,
+21713,
+21808,
+21902,
+21997,
+22091,
+22185,
+22279,
+22373,
+22466,
+22560,
+22653,
+22745,
+22838,
+22930,
+23022,
+23114,
+23206,
+23297,
+23388,
+23479,
+23569,
+23659,
+23749,
+23839,
+23928,
+24017,
+24106,
+24195,
+24283,
+24371,
+24458,
+24546,
+24633,
+24719,
+24806,
+24892,
+24978,
+25063,
+25148,
+25233,
+25317,
+25401,
+25485,
+25569,
+25652,
+25734,
+25817,
+25899,
+25980,
+26062,
+26143,
+26223,
+26303,
+26383,
+26463,
+26542,
+26620,
+26699,
+26777,
+26854,
+26931,
+27008,
+27084,
+27160,
+27236,
+27311,
+27385,
+27460,
+27534,
+27607,
+27680,
+27753,
+27825,
+27897,
+27968,
+28039,
+28109,
+28179,
+28249,
+28318,
+28386,
+28455,
+28522,
+28590,
+28656,
+28723,
+28789,
+28854,
+28919,
+28984,
+29048,
+29111,
+29174,
+29237,
+29299,
+29360,
+29422,
+29482,
+29542,
+29602,
+29661,
+29720,
+29778,
+29836,
+29893,
+29949,
+30005,
+30061,
+30116,
+30171,
+30225,
+30278,
+30331,
+30384,
+30436,
+30487,
+30538,
+30588,
+30638,
+30687,
+30736,
+30784,
+30832,
+30879,
+30926,
+30972,
+31017,
+31062,
+31106,
+31150,
+31194,
+31236,
+31278,
+31320,
+31361,
+31401,
+31441,
+31481,
+31519,
+31558,
+31595,
+31632,
+31669,
+31705,
+31740,
+31775,
+31809,
+31842,
+31875,
+31908,
+31940,
+31971,
+32001,
+32032,
+32061,
+32090,
+32118,
+32146,
+32173,
+32200,
+32225,
+32251,
+32276,
+32300,
+32323,
+32346,
+32368,
+32390,
+32411,
+32432,
+32452,
+32471,
+32490,
+32508,
+32525,
+32542,
+32558,
+32574,
+32589,
+32604,
+32617,
+32631,
+32643,
+32655,
+32667,
+32677,
+32688,
+32697,
+32706,
+32714,
+32722,
+32729,
+32736,
+32742,
+32747,
+32751,
+32755,
+32759,
+32762,
+32764,
+32765,
+32766
+};
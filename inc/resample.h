@@ -9,9 +9,11 @@
 
 #include <stm32f4xx.h>
 
-void resample_read16_left(float rs, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out);
-void resample_read16_right(float rs, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out);
-void resample_read16_avg(float rs, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out);
+// rs is the resampling rate for the first output frame, and it changes by rs_step for each frame after that
+
+void resample_read16_left(float rs, float rs_step, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out);
+void resample_read16_right(float rs, float rs_step, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out);
+void resample_read16_avg(float rs, float rs_step, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out);
 
 
 
@@ -26,8 +26,33 @@ typedef struct Sample {
 
 	uint16_t	PCM;
 	uint8_t		file_found;
+
+	uint32_t	file_size;			// directory entry size, used to validate the header cache
+	uint32_t	file_datetime;		// directory entry fdate<<16 | ftime, or 0 if not known yet
+	uint8_t		hdr_verified;		// 1 = header was parsed from the file, 0 = header was taken from the header cache
 } Sample;
 
+//
+// Header cache: one entry per bank/slot, stored in the system dir next to the index
+// An entry is only used if the path hash, file size and timestamp all match the directory entry
+//
+#define HDRCACHE_MAGIC		0x48535453		// "STSH"
+#define HDRCACHE_VERSION	1
+
+typedef struct SampleHeaderCache {
+	uint32_t	path_hash;
+	uint32_t	file_size;
+	uint32_t	file_datetime;
+	uint32_t	sampleSize;
+	uint32_t	startOfData;
+	uint32_t	sampleRate;
+	uint16_t	PCM;
+	uint8_t		sampleByteSize;
+	uint8_t		numChannels;
+	uint8_t		blockAlign;
+	uint8_t		reserved[3];
+} SampleHeaderCache;
+
 
 
 uint8_t load_sample_header(Sample *s_sample, FIL *sample_file);
@@ -35,5 +60,13 @@ void clear_sample_header(Sample *s_sample);
 FRESULT reload_sample_file(FIL *fil, Sample *s_sample);
 FRESULT create_linkmap(FIL *fil, uint8_t chan, uint8_t samplenum);
 
+FRESULT write_sample_header_cache(void);
+void write_sample_header_cache_begin(void);
+uint8_t write_sample_header_cache_step(void);
+uint8_t open_sample_header_cache(FIL *hdrcache);
+uint8_t load_sample_header_cached(Sample *s_sample, FILINFO *fno, FIL *hdrcache, uint8_t bank, uint8_t samplenum);
+uint8_t verify_sample_header(Sample *s_sample);
+void verify_sample_headers_idle(void);
+
 
 
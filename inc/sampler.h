@@ -8,6 +8,8 @@
 #include "sample_file.h"
 #include "ff.h"
 #include "circular_buffer.h"
+#include "globals.h"
+#include "time_stretch.h"
 
 
 /* Playback states */
@@ -29,6 +31,47 @@ enum PlayLoadTriage{
 	NO_PRIORITY,
 	PRIORITIZE_PLAYING
 };
+
+//Interpolation history for one side (L or R) of a voice's resampler
+typedef struct ResampleState {
+	float		fractional_pos;
+	float		xm1, x0, x1, x2;
+} ResampleState;
+
+//The cache tells us what section of a sample's file has been cached into its play_buff
+//low, high and size are all in file's native units (varies by the file's bit rate and stereo/mono)
+//map_pt is in units of play_buff, and tells us what address low maps to
+typedef struct SampleCache {
+	uint32_t	low;						//file position address that corresponds to lowest position in file that's cached
+	uint32_t	high;						//file position address that corresponds to highest position in file that's cached
+	uint32_t	size;						//size in bytes of the cache (should always equal play_buff[]->size / 2 * sampleByteSize
+	uint32_t	map_pt;						//address in play_buff[] that corresponds to low
+	uint32_t	file_curpos;				//current file position being read. Must match the actual open file's position. This is always inc/decrementing from startpos towards endpos
+	uint32_t	bufferedamt;
+	uint8_t		is_buffered_to_file_end;	//1 = file is totally cached (from inst_start to inst_end), otherwise 0
+	uint8_t		rev_state;
+} SampleCache;
+
+//Per-channel playback state, kept in CCM.
+//The fields the audio IRQ uses every block come first
+typedef struct Voice {
+	ResampleState	resample[2];			//[0]: left or mono/averaged, [1]: right
+	TimeStretchState ts;
+	uint32_t		file_startpos;			//file position where we began playback.
+	uint32_t		file_endpos;			//file position where we will end playback. endpos > startpos when REV==0, endpos < startpos when REV==1
+	uint32_t		start_tmr;				//sys_tmr value when the first frame should be output, if start_sync is set
+	uint8_t			start_sync;
+	uint8_t			loop_wrap_pending;		//the next pass of a streamed loop is in the play_buff, and play_buff->out has not reached it yet
+	uint8_t			loop_stream_off;		//this loop can't be streamed: it restarts at the end instead (cleared by start_playing)
+	uint32_t		loop_wrap_addr;			//play_buff address where the next pass of a streamed loop begins
+	uint8_t			loop_point_pending;		//play_buff->out has not reached loop_point_addr yet
+	uint32_t		loop_point_addr;		//play_buff address of the next pass's start point: END OUT pulses there
+	uint32_t		loop_xfade_addr;		//next play_buff address mix_loop_wrap() crossfades
+	uint16_t		loop_xfade_pos;			//frames of the loop crossfade mixed so far
+	uint16_t		loop_xfade_frames;		//frames in the loop crossfade
+	SampleCache		cache[NUM_SAMPLES_PER_BANK];
+} Voice;
+
 #define SDIO_read_IRQHandler TIM7_IRQHandler
 #define SDIO_read_TIM TIM7
 
@@ -44,7 +87,7 @@ enum PlayLoadTriage{
 //1536/8192: 7ms
 
 //#define BASE_BUFFER_THRESHOLD (6144)
-#define BASE_BUFFER_THRESHOLD (3072)
+#define BASE_BUFFER_THRESHOLD (3072) /* default and minimum of sdcard_speed.buffer_threshold, which is set at boot */
 //#define BASE_BUFFER_THRESHOLD (1536)
 
 //READ_BLOCK_SIZE must be a multiple of all possible sample file block sizes
@@ -56,7 +99,23 @@ enum PlayLoadTriage{
 
 #define PERC_ENV_FACTOR 40000.0f
 
-#define MAX_RS 20 /* over 4 octaves at 44.1k */
+//Length of the fade up/down envelopes, in frames. Must be even and <= HT16_CHAN_BUFF_LEN
+#define FADE_FRAMES 16
+#define FADE_AT_START 0
+#define FADE_AT_END 1
+
+//Play triggers start output this many frames after the trigger delay, at the exact frame.
+//This covers the param update and SD read IRQ periods (1.8ms) and one audio block computed ahead, so a sample whose start is
+//cached always starts on time, and the start doesn't jitter with the block or control rate
+#define TRIG_SYNC_LATENCY 		(80 + 2 * HT16_CHAN_BUFF_LEN)
+
+//A sync start further away than this is stale: start right away
+#define TRIG_SYNC_MAX_WAIT 		4096
+
+//Streamed loops are crossfaded where they wrap around by global_mode[LOOP_CROSSFADE] ms, up to this many frames
+#define LOOP_XFADE_MAX_FRAMES	1024
+
+#define MAX_RS 20 /* over 4 octaves at 44.1k. Default and maximum of sdcard_speed.max_rs, which is set at boot */
 //#define MAX_RS_READ_BUFF_LEN ((codec_BUFF_LEN >> 2) * MAX_RS)
 
 void audio_buffer_init(void);
@@ -67,6 +126,8 @@ void set_buff_window(uint8_t chan, uint8_t samplenum);
 
 void toggle_playing(uint8_t chan);
 void start_playing(uint8_t chan);
+void start_playing_at(uint8_t chan, uint32_t start_tmr);
+void retrigger_playing_at(uint8_t chan, uint32_t start_tmr);
 
 void toggle_reverse(uint8_t chan);
 void reverse_file_positions(uint8_t chan, uint8_t samplenum, uint8_t banknum, uint8_t new_dir);
@@ -81,9 +142,12 @@ void init_changed_bank(uint8_t chan);
 
 uint32_t calc_start_point(float start_param, Sample *sample);
 uint32_t calc_stop_point(float length_param, float resample_param, Sample *sample, uint32_t startpos);
+void update_play_bounds(uint8_t chan);
 
 
 void clear_is_buffered_to_file_end(uint8_t chan);
 //void check_trim_bounds(void);
 
+uint8_t is_storage_idle(void);
+
 void SDIO_read_IRQHandler(void);
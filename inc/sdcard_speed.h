@@ -0,0 +1,36 @@
+/*
+ * sdcard_speed.h
+ *
+ * Speed of the SD Card, measured at boot right after it's mounted,
+ * and the streaming limits that are set from it (see sdcard_speed.c)
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+
+// Blocks of READ_BLOCK_SIZE read in a row for the sequential test: 147kB
+#define SD_SPEED_SEQ_BLOCKS			16
+
+// Number of READ_BLOCK_SIZE reads from random positions
+#define SD_SPEED_RAND_READS			8
+
+// The resample rate is never clamped lower than this, even for a very slow card
+#define SD_SPEED_MIN_MAX_RS			4
+
+#define SD_SPEED_ITM_PORT			5
+
+typedef struct SdCardSpeed {
+	uint8_t 	measured;
+	uint8_t 	bus_speed;			//SD_BUS_SPEED_HIGH (48MHz) or SD_BUS_SPEED_DEFAULT (24MHz) when measured
+	uint32_t 	seq_read_kBps;
+	uint32_t 	rand_read_us;		//average time to read READ_BLOCK_SIZE from a random position
+	uint32_t 	max_rand_read_us;	//longest of those reads
+
+	//Set from the measurements, used by sampler.c.
+	//They stay at MAX_RS and BASE_BUFFER_THRESHOLD if the card wasn't measured, or if it's fast enough
+	float 		max_rs;				//highest resample rate (times the number of channels in stereo mode)
+	uint32_t 	buffer_threshold;	//pre-buffer size before playing starts, in frames at 1x speed
+} SdCardSpeed;
+
+void measure_sdcard_speed(void);
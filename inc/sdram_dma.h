@@ -0,0 +1,38 @@
+/*
+ * sdram_dma.h
+ *
+ * Fills and pattern tests of the SDRAM with DMA2 (memory-to-memory), in the background.
+ * One job runs at a time. When it's done, the callback is called from the DMA interrupt with the number of errors
+ * (always 0 for a fill). sdram_dma_wait() blocks until the job is done.
+ *
+ * Addresses and sizes must be multiples of 16 bytes (one 4-word burst)
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+
+/* DMA2 Stream 7 Channel 0. Only DMA2 can do memory-to-memory transfers */
+#define SDRAM_DMA_CLK                  RCC_AHB1Periph_DMA2
+#define SDRAM_DMA_STREAM               DMA2_Stream7
+#define SDRAM_DMA_CHANNEL              DMA_Channel_0
+#define SDRAM_DMA_FLAG_TC              DMA_FLAG_TCIF7
+#define SDRAM_DMA_FLAG_TE              DMA_FLAG_TEIF7
+#define SDRAM_DMA_FLAGS_ALL            (DMA_FLAG_FEIF7 | DMA_FLAG_DMEIF7 | DMA_FLAG_TEIF7 | DMA_FLAG_HTIF7 | DMA_FLAG_TCIF7)
+#define SDRAM_DMA_IRQ                  DMA2_Stream7_IRQn
+#define SDRAM_DMA_IRQHandler           DMA2_Stream7_IRQHandler
+
+// Largest transfer for a fill (bytes): the DMA counter is 16 bits (words)
+#define SDRAM_DMA_FILL_BLOCK           0x00010000
+
+// Block size of a pattern test (bytes): each block's pattern is made in a buffer in SRAM, and read back into it to verify
+#define SDRAM_DMA_TEST_BLOCK           0x00001000
+
+typedef void (*SdramDmaCallback)(uint32_t errors);
+
+void 		init_sdram_dma(void);
+uint8_t 	sdram_dma_fill(uint32_t addr, uint32_t size, uint32_t value, SdramDmaCallback done);
+uint8_t 	sdram_dma_test(uint32_t addr, uint32_t size, SdramDmaCallback done);
+uint8_t 	sdram_dma_busy(void);
+void 		sdram_dma_wait(void);
+uint32_t 	sdram_dma_errors(void);
@@ -22,16 +22,17 @@
 #define SAMPLE_INDEX_FILE	"sample_index.dat"
 #define SAMPLE_BAK_FILE		"sample_index-bak.dat"
 #define SAMPLE_BOOTBAK_FILE	"sample_index_boot-bak.dat"
+#define SAMPLE_HDRCACHE_FILE	"sample_header_cache.dat"
 #define RENAME_LOG_FILE		"renamed_folders.txt"
 
 #define RENAME_TMP_FILE		"sts-renaming-queue.tmp"
 #define ERROR_LOG_FILE		"error-log.txt"
 #define SETTINGS_FILE		"settings.txt"
+#define SDCARD_SPEED_FILE	"sdcard_speed_test.dat"	//no longer written: deleted at boot (see sdcard_speed.c)
 
 #define EOF_TAG				"End of file"
 #define EOF_PAD				10 				// number of characters that can be left after EOF_TAG
 
-#define MAX_FILES_IN_FOLDER 500
 #define	NO_MORE_AVAILABLE_FILES		0xFF
 
 FRESULT reload_sdcard(void);
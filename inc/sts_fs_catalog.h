@@ -0,0 +1,43 @@
+/*
+ * sts_fs_catalog.h
+ *
+ * Catalog of all .wav files on the SD Card (root and folders in root), kept in SDRAM
+ * Used by assignment mode to browse unassigned samples without crawling the filesystem
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+#include "ff.h"
+#include "sample_file.h"
+
+typedef struct CatalogEntry {
+	char		filename[_MAX_LFN];		// full path, in the same form assignment mode uses ("folder/file.wav" or "/file.wav" for root)
+	uint8_t		folder_len;				// length of the folder part of filename (0 = root)
+	uint8_t		sampleByteSize;
+	uint8_t		numChannels;
+	uint8_t		blockAlign;
+	uint16_t	PCM;
+	uint32_t	sampleSize;
+	uint32_t	startOfData;
+	uint32_t	sampleRate;
+	uint32_t	file_size;
+	uint32_t	file_datetime;
+} CatalogEntry;
+
+enum CatalogStates {
+	CATALOG_INVALID,
+	CATALOG_SCAN_ROOT,
+	CATALOG_NEXT_FOLDER,
+	CATALOG_SCAN_FOLDER,
+	CATALOG_READY
+};
+
+void 			invalidate_sample_catalog(void);
+void 			build_sample_catalog_idle(void);
+uint8_t 		is_sample_catalog_ready(void);
+uint32_t 		sample_catalog_size(void);
+CatalogEntry* 	sample_catalog_entry(uint32_t i);
+uint8_t 		sample_catalog_has_folder(char *folder);
+uint8_t 		is_catalog_entry_in_folder(CatalogEntry *entry, char *folder);
+void 			catalog_entry_to_sample(CatalogEntry *entry, Sample *s_sample);
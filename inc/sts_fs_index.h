@@ -25,10 +25,23 @@
 #define	PLAYDATTAG_GAIN 	"- play gain"
 
 FRESULT write_sampleindex_file(void);
+void write_sampleindex_begin(void);
+uint8_t write_sampleindex_step(void);
+FRESULT write_sampleindex_result(void);
+
 uint8_t write_samplelist(void);
-uint8_t index_write_wrapper(void);
+void write_samplelist_begin(void);
+uint8_t write_samplelist_step(void);
+
 FRESULT backup_sampleindex_file(void);
+FRESULT backup_sampleindex_begin(void);
+uint8_t backup_sampleindex_step(void);
+FRESULT backup_sampleindex_result(void);
+
 uint8_t load_sampleindex_file(uint8_t use_backup, uint8_t banks);
+uint8_t load_sampleindex_begin(uint8_t use_backup, uint8_t banks);
+uint8_t load_sampleindex_step(void);
+uint8_t load_sampleindex_end(void);
 
 uint8_t check_sampleindex_valid(char *indexfilename);
 
@@ -0,0 +1,41 @@
+/*
+ * time_stretch.h
+ *
+ * Time-stretch playback: the PITCH param changes the playback speed, and the sample keeps its original pitch.
+ * Overlapping grains are read from the play_buff and crossfaded (WSOLA).
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+#include "circular_buffer.h"
+
+// Grains are 2 * TS_HOP_FRAMES long and overlap by half: a new grain starts every TS_HOP_FRAMES output frames (11.6ms)
+#define TS_HOP_FRAMES			512
+
+// Each new grain may start up to TS_SEEK_FRAMES before or after the speed pointer (play_buff->out),
+// at the position that best lines up with the grain that's fading out.
+// Candidates are tried every TS_SEEK_STEP frames, then refined around the best one
+#define TS_SEEK_FRAMES			128
+#define TS_SEEK_STEP			8
+
+// Number of frames compared at each candidate position, using every TS_CORR_DECIMATE-th frame
+#define TS_CORR_FRAMES			128
+#define TS_CORR_DECIMATE		4
+
+typedef struct TimeStretchState {
+	uint32_t	old_addr;			// play_buff address of the grain fading out
+	uint32_t	new_addr;			// play_buff address of the grain fading in
+	uint32_t	pos_frac;			// fractional position of both grains, between their address and the next frame (Q16)
+	float		out_frac;			// fractional frames that the speed pointer (play_buff->out) has not moved yet
+	uint16_t	hop_ctr;			// frames played since the new grain started
+	uint16_t	seek_back_limit;	// how far behind play_buff->out a grain may start, so it never reads from before the start of playback
+} TimeStretchState;
+
+void 		reset_time_stretch(TimeStretchState *ts, CircularBuffer *buf);
+void 		time_stretch_read(TimeStretchState *ts, CircularBuffer *buf, float speed, float rate, uint8_t block_align, uint8_t rev, uint8_t stereo_out, int32_t *outL, int32_t *outR, uint32_t len);
+uint32_t 	time_stretch_lookahead(float rate, uint8_t block_align);
+
+#ifdef BENCHMARK_AUDIO_KERNELS
+void 		benchmark_time_stretch(void);
+#endif
@@ -23,6 +23,8 @@ enum Settings
 	FadeEnvelope,
 	StartUpBank_ch1,
 	StartUpBank_ch2,
+	TimeStretch,
+	LoopCrossfade,
 	TrigDelay,
 
 	NUM_SETTINGS_ENUM
@@ -31,6 +33,9 @@ enum Settings
 
 void set_default_user_settings(void);
 FRESULT save_user_settings(void);
+void begin_save_user_settings(void);
+uint8_t save_user_settings_step(void);
+FRESULT save_user_settings_result(void);
 FRESULT read_user_settings(void);
 
 
@@ -0,0 +1,41 @@
+/*
+ * voices.h
+ *
+ * Tail voices: when a channel is re-triggered, the sound that was playing is handed off to a tail voice,
+ * which fades it out while the channel starts the new sound right away.
+ */
+
+#pragma once
+
+#include <stm32f4xx.h>
+#include "circular_buffer.h"
+
+// Size of the tail voice pool (shared by both channels)
+#define NUM_TAIL_VOICES 		2
+
+// Tail fade-out time, in frames (10ms)
+#define TAIL_FADE_FRAMES 		441
+#define TAIL_FADE_BLOCKS 		((TAIL_FADE_FRAMES + HT16_CHAN_BUFF_LEN - 1) / HT16_CHAN_BUFF_LEN)
+
+// A voice costs about (resample rate x bytes per frame) of SDRAM reads per output frame.
+// The total cost of all tail voices is kept under this budget by stealing the most expensive voices.
+// Tune with BENCHMARK_AUDIO_KERNELS: at the default budget two tails at 2x pitch on stereo files fit.
+#define TAIL_COST_BUDGET 		16.0f
+
+typedef struct TailVoice {
+	CircularBuffer	buf;			// copy of the channel's play_buff with its own out pointer. The SDRAM data (cache) is shared
+	uint32_t		pos_frac;		// fractional position between buf.out and the next frame (Q16)
+	uint32_t		rs_q16;			// resample rate (Q16)
+	int32_t			gain;			// current gain (Q16)
+	int32_t			gain_dec;		// gain decrease per frame (Q16)
+	float			cost;
+	uint16_t		blocks_left;
+	uint8_t			chan;
+	uint8_t			block_align;	// 2 = mono file, 4 = stereo file
+	uint8_t			rev;
+	uint8_t			active;
+} TailVoice;
+
+uint8_t start_tail_voice(uint8_t chan, float gain);
+uint32_t tail_safe_buff_start(uint8_t chan, uint8_t samplenum, uint8_t rev);
+void 	mix_tail_voices(uint8_t chan, int32_t *outL, int32_t *outR);
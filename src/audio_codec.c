@@ -4,11 +4,13 @@
 #include "params.h"
 #include "calibration.h"
 #include "adc.h"
+#include "audio_codec.h"
+#include "ITM.h"
+#include "codec.h"
+#include "profiler.h"
 
 extern SystemCalibrations *system_calibrations;
 
-extern uint8_t SAMPLINGBYTES;
-
 extern uint8_t global_mode[NUM_GLOBAL_MODES];
 
 
@@ -19,13 +21,161 @@ extern uint8_t global_mode[NUM_GLOBAL_MODES];
 //extern int16_t bracketed_cvadc[8];
 //extern int16_t i_smoothed_potadc[NUM_POT_ADCS];
 
-void process_audio_block_codec(int16_t *src, int16_t *dst)
+//
+// Output mix kernels
+//
+// The codec frame is [L sample, L pad, R sample, R pad] (int16_t each), so one uint32_t per channel.
+// Each kernel builds a packed (R<<16 | L) pair for each frame, from the play channels and/or the input,
+// then adds the DAC DC offset with a single saturating __QADD16.
+// When an input channel is monitored, its pad word is passed through from src.
+//
+// One kernel is generated for each combination of MONITOR_RECORDING and STEREO_MODE,
+// and update_audio_mix_kernel() picks the one to use whenever the mode changes
+//
+
+typedef void (*MixKernel)(uint32_t *src, uint32_t *dst, uint32_t dcoffset);
+
+CCMDATA static int32_t outL[NUM_PLAY_CHAN][HT16_CHAN_BUFF_LEN];
+CCMDATA static int32_t outR[NUM_PLAY_CHAN][HT16_CHAN_BUFF_LEN];
+
+//Left Out = Sum of both L channels, Right Out = Sum of both R channels
+#define VOICES_STEREO(i) 	__QADD16(__PKHBT(outL[0][i], outR[0][i], 16), __PKHBT(outL[1][i], outR[1][i], 16))
+
+//in mono mode, outL is the average of L+R: Left Out = Chan 1, Right Out = Chan 2
+#define VOICES_MONO(i) 		__PKHBT(outL[0][i], outL[1][i], 16)
+
+#define MIX_KERNEL(name, VOICES, LEFT_IN, RIGHT_IN)											\
+static void name(uint32_t *src, uint32_t *dst, uint32_t dcoffset)							\
+{																							\
+	uint16_t i;																				\
+	uint32_t in, mix;																		\
+																							\
+	for (i=0;i<HT16_CHAN_BUFF_LEN;i++)														\
+	{																						\
+		in = __PKHBT(src[0], src[1], 16);													\
+																							\
+		if (LEFT_IN && RIGHT_IN)	mix = in;												\
+		else if (LEFT_IN)			mix = __PKHBT(in, VOICES(i), 0);						\
+		else if (RIGHT_IN)			mix = __PKHTB(in, VOICES(i), 0);						\
+		else						mix = VOICES(i);										\
+																							\
+		mix = __QADD16(mix, dcoffset);														\
+																							\
+		dst[0] = (mix & 0x0000FFFF) | (LEFT_IN ? (src[0] & 0xFFFF0000) : 0);				\
+		dst[1] = (mix >> 16) 		| (RIGHT_IN ? (src[1] & 0xFFFF0000) : 0);				\
+		src += 2;																			\
+		dst += 2;																			\
+	}																						\
+}
+
+MIX_KERNEL(mix_off_stereo, 		VOICES_STEREO, 	0, 0)
+MIX_KERNEL(mix_off_mono, 		VOICES_MONO, 	0, 0)
+MIX_KERNEL(mix_left_stereo, 	VOICES_STEREO, 	1, 0)
+MIX_KERNEL(mix_left_mono, 		VOICES_MONO, 	1, 0)
+MIX_KERNEL(mix_right_stereo, 	VOICES_STEREO, 	0, 1)
+MIX_KERNEL(mix_right_mono, 		VOICES_MONO, 	0, 1)
+MIX_KERNEL(mix_both, 			VOICES_MONO, 	1, 1)
+
+//Outputs the DC offset only
+static void mix_calibrate(uint32_t *src, uint32_t *dst, uint32_t dcoffset)
 {
-	CCMDATA static int32_t outL[2][HT16_CHAN_BUFF_LEN];
-	CCMDATA static int32_t outR[2][HT16_CHAN_BUFF_LEN];
 	uint16_t i;
-	int16_t dummy;
-	int32_t t_i32;
+
+	for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
+	{
+		*dst++ = dcoffset & 0x0000FFFF;
+		*dst++ = dcoffset >> 16;
+	}
+}
+
+//[MONITOR_RECORDING][STEREO_MODE]
+static const MixKernel mix_kernels[4][2] = {
+	[MONITOR_OFF] 	= {mix_off_mono, 	mix_off_stereo},
+	[MONITOR_LEFT] 	= {mix_left_mono, 	mix_left_stereo},
+	[MONITOR_RIGHT] = {mix_right_mono, 	mix_right_stereo},
+	[MONITOR_BOTH] 	= {mix_both, 		mix_both}
+};
+
+static MixKernel 	mix_kernel = mix_off_mono;
+static uint8_t 		mix_kernel_mode = 0xFF;
+
+//
+// Selects the output mix kernel for the current modes
+// Called from the param update IRQ, so process_audio_block_codec() doesn't test the modes for every block
+//
+void update_audio_mix_kernel(void)
+{
+	uint8_t mode;
+
+	mode = (global_mode[CALIBRATE] ? 0x80 : 0) | ((global_mode[MONITOR_RECORDING] & 0b11) << 1) | (global_mode[STEREO_MODE] ? 1 : 0);
+	if (mode == mix_kernel_mode) return;
+
+	mix_kernel_mode = mode;
+
+	if (global_mode[CALIBRATE])	mix_kernel = mix_calibrate;
+	else						mix_kernel = mix_kernels[global_mode[MONITOR_RECORDING] & 0b11][global_mode[STEREO_MODE] ? 1 : 0];
+}
+
+#ifdef BENCHMARK_AUDIO_KERNELS
+uint32_t audio_load_permille;
+uint32_t audio_load_max_permille;
+
+//Cycles available per block = core clock / block rate
+#define CYCLES_PER_BLOCK 	(SystemCoreClock / (BASE_SAMPLE_RATE / HT16_CHAN_BUFF_LEN))
+#define BLOCKS_PER_SEC 		(BASE_SAMPLE_RATE / HT16_CHAN_BUFF_LEN)
+
+//
+// Accumulates the cycles spent processing each block. Once a second, sends the average and peak audio CPU load
+// (in 1/1000ths of the time between blocks) on ITM ports 1 and 2. Comparing builds with different AUDIO_BLOCK_SIZE
+// shows how much of the load is per-block overhead
+//
+static void measure_audio_load(uint32_t cycles)
+{
+	static uint32_t total_cycles = 0;
+	static uint32_t max_cycles = 0;
+	static uint32_t num_blocks = 0;
+
+	total_cycles += cycles;
+	if (cycles > max_cycles) max_cycles = cycles;
+
+	if (++num_blocks >= BLOCKS_PER_SEC)
+	{
+		audio_load_permille 	= ((uint64_t)total_cycles * 1000) / ((uint64_t)CYCLES_PER_BLOCK * num_blocks);
+		audio_load_max_permille = ((uint64_t)max_cycles * 1000) / CYCLES_PER_BLOCK;
+
+		ITM_SendValue(1, audio_load_permille);
+		ITM_SendValue(2, audio_load_max_permille);
+
+		total_cycles = 0;
+		max_cycles = 0;
+		num_blocks = 0;
+	}
+}
+#endif
+
+extern volatile uint32_t sys_tmr;
+
+//sys_tmr value when the first frame of the block being computed will be output.
+//sys_tmr counts I2S frames (LRCLK), so this places each output frame on the same timeline as trigger timestamps
+static volatile uint32_t audio_block_tmr;
+
+uint32_t get_audio_block_tmr(void)
+{
+	return audio_block_tmr;
+}
+
+void process_audio_block_codec(int16_t *src, int16_t *dst)
+{
+	uint32_t dcoffset;
+	uint8_t chan;
+#ifdef BENCHMARK_AUDIO_KERNELS
+	uint32_t start_cycles = DWT->CYCCNT;
+#endif
+	PROFILE_START(PROF_AUDIO_BLOCK);
+
+	//The block being computed is output when the TX DMA finishes the half it's sending now.
+	//The DMA counter is in halfwords, and a frame is 4 halfwords
+	audio_block_tmr = sys_tmr + ((DMA_GetCurrDataCounter(AUDIO_I2S2_DMA_STREAM) >> 2) & (HT16_CHAN_BUFF_LEN - 1));
 
 	//
 	// Incoming audio
@@ -36,218 +186,27 @@ void process_audio_block_codec(int16_t *src, int16_t *dst)
 	// Outgoing audio
 	//
 
-	play_audio_from_buffer(outL[0], outR[0], 0);
-	play_audio_from_buffer(outL[1], outR[1], 1);
+	update_pitch_cv();
 
+	for (chan=0; chan<NUM_PLAY_CHAN; chan++)
+		play_audio_from_buffer(outL[chan], outR[chan], chan);
 
-#ifndef DEBUG_ADC_TO_CODEC
 
-	if (global_mode[CALIBRATE])
-	{
-		for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-		{
-			*dst++ = system_calibrations->codec_dac_calibration_dcoffset[0];
-			*dst++ = 0;
-			*dst++ = system_calibrations->codec_dac_calibration_dcoffset[1];
-			*dst++ = 0;
-		}
-	}
-	else if (global_mode[MONITOR_RECORDING] == MONITOR_BOTH)
-	{
-		for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-		{
-			t_i32 = (*src++) + system_calibrations->codec_dac_calibration_dcoffset[0];
-			asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-			*dst++ = t_i32;
-			*dst++ = *src++;
-
-			t_i32 = (*src++) + system_calibrations->codec_dac_calibration_dcoffset[1];
-			asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-			*dst++ = t_i32;
-			*dst++ = *src++;
-
-		}
-	}
-	else if (global_mode[MONITOR_RECORDING] == MONITOR_OFF)
-	{
-		if (SAMPLINGBYTES==2)
-		{
-			if (global_mode[STEREO_MODE])
-			{
-				//Left Out = Sum of both L channels
-				//Right Out = Sum of both R channels
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-					//Chan 1 L + Chan 2 L clipped at signed 16-bits
-					t_i32 = outL[0][i] + outL[1][i] + system_calibrations->codec_dac_calibration_dcoffset[0];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = 0;
-
-					//Chan 1 R + Chan 2 R clipped at signed 16-bits
-					t_i32 = outR[0][i] + outR[1][i] + system_calibrations->codec_dac_calibration_dcoffset[1];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = 0;
-				}
-			}
-			else
-			{
-				//in mono mode, outL is the average of L+R
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-					//Chan 1 L+R clipped at signed 16-bits
-					t_i32 = outL[0][i] + system_calibrations->codec_dac_calibration_dcoffset[0];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = 0;
-
-					//Chan 2 L+R clipped at signed 16-bits
-					t_i32 = outL[1][i] + system_calibrations->codec_dac_calibration_dcoffset[1];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = 0;
-				}
-			}
-
-		}
-	}
-	else if (global_mode[MONITOR_RECORDING] == MONITOR_RIGHT)
-	{
-		if (SAMPLINGBYTES==2)
-		{
-			if (global_mode[STEREO_MODE])
-			{
-				//Left Out = Sum of both L channels
-				//Right Out = right input
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-					//Chan 1 L + Chan 2 L clipped at signed 16-bits
-					t_i32 = outL[0][i] + outL[1][i] + system_calibrations->codec_dac_calibration_dcoffset[0];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = 0;
-
-					dummy = *src++;dummy = *src++; //ignore L input
-					//copy R input signal to R output
-					t_i32 = (*src++) + system_calibrations->codec_dac_calibration_dcoffset[1];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = *src++;
-				}
-			}
-			else
-			{
-				//in mono mode, outL is the average of L+R
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-					//Chan 1 L+R clipped at signed 16-bits
-					t_i32 = outL[0][i] + system_calibrations->codec_dac_calibration_dcoffset[0];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = 0;
-
-					dummy = *src++;dummy = *src++; //ignore L input
-					//copy R input signal to R output
-					t_i32 = (*src++) + system_calibrations->codec_dac_calibration_dcoffset[1];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = *src++;
-				}
-			}
-
-		}
-	}
-	else if (global_mode[MONITOR_RECORDING] == MONITOR_LEFT)
-	{
-		if (SAMPLINGBYTES==2)
-		{
-			if (global_mode[STEREO_MODE])
-			{
-				//Left Out = L input signal
-				//Right Out = Sum of both R channels
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-					//L input signal
-					t_i32 = (*src++) + system_calibrations->codec_dac_calibration_dcoffset[0];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = *src++;
-					//ignore R input
-					dummy = *src++;dummy = *src++;
-
-					//Chan 1 R + Chan 2 R clipped at signed 16-bits
-					t_i32 = outR[0][i] + outR[1][i] + system_calibrations->codec_dac_calibration_dcoffset[1];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = 0;
-				}
-			}
-			else
-			{
-				//in mono mode, outL is the average of L+R
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-					//L input signal
-					t_i32 = (*src++) + system_calibrations->codec_dac_calibration_dcoffset[0];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = *src++;
-					//ignore R input
-					dummy = *src++;dummy = *src++;
-
-					//Chan 2 L+R clipped at signed 16-bits
-					t_i32 = outL[1][i] + system_calibrations->codec_dac_calibration_dcoffset[1];
-					asm("ssat %[dst], #16, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-					*dst++ = t_i32;
-					*dst++ = 0;
-				}
-			}
+#ifndef DEBUG_ADC_TO_CODEC
 
-		}
-	}
+	dcoffset = __PKHBT(system_calibrations->codec_dac_calibration_dcoffset[0], system_calibrations->codec_dac_calibration_dcoffset[1], 16);
 
+	mix_kernel((uint32_t *)src, (uint32_t *)dst, dcoffset);
 
-		// else //SAMPLINGBYTES==4
-		// {
-		// 	if (global_mode[STEREO_MODE])
-		// 	{
-		// 		for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-		// 		{
-		// 			//L out clipped at signed 24 bits
-		// 			t_i32 = ((outL[0][i] + outL[1][i]) >> 1) + (int16_t)system_calibrations->codec_dac_calibration_dcoffset[0];
-		//			asm("ssat %[dst], #24, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-		// 			*dst++ = (int16_t)(t_i32>>16) ;
-		// 			*dst++ = (int16_t)(t_i32 & 0x0000FF00);
-
-		// 			//R out clipped at signed 24 bits
-		// 			t_i32 = ((outR[0][i] + outR[1][i]) >> 1) + (int16_t)system_calibrations->codec_dac_calibration_dcoffset[0];
-		//			asm("ssat %[dst], #24, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-		// 			*dst++ = (int16_t)(t_i32>>16) ;
-		// 			*dst++ = (int16_t)(t_i32 & 0x0000FF00);
-		// 		}
-		// 	}
-		// 	else
-		// 	{
-		// 		for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-		// 		{
-		// 			//Chan 1 L+R out clipped at signed 24 bits
-		//			t_i32 = outL[0][i] + system_calibrations->codec_dac_calibration_dcoffset[0];
-		//			asm("ssat %[dst], #24, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-		// 			*dst++ = (int16_t)(t_i32>>16) ;
-		// 			*dst++ = (int16_t)(t_i32 & 0x0000FF00);
-
-		// 			//Chan 2 L+R out clipped at signed 24 bits
-		//			t_i32 = outL[1][i] + system_calibrations->codec_dac_calibration_dcoffset[1];
-		//			asm("ssat %[dst], #24, %[src]" : [dst] "=r" (t_i32) : [src] "r" (t_i32));
-		// 			*dst++ = (int16_t)(t_i32>>16) ;
-		// 			*dst++ = (int16_t)(t_i32 & 0x0000FF00);
-		// 		}
-		// 	}
-		// }
+	PROFILE_END(PROF_AUDIO_BLOCK);
 
+#ifdef BENCHMARK_AUDIO_KERNELS
+	measure_audio_load(DWT->CYCCNT - start_cycles);
+#endif
 
 #else //DEBUG_ADC_TO_CODEC
+	uint16_t i;
+
 	for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
 	{
 		//*dst++ = potadc_buffer[channel+2]*4;
@@ -260,3 +219,35 @@ void process_audio_block_codec(int16_t *src, int16_t *dst)
 
 }
 
+#ifdef BENCHMARK_AUDIO_KERNELS
+
+uint32_t mix_kernel_cycles[4][2];
+
+//
+// Measures the cycles per block of each mix kernel, with the DWT cycle counter
+// Results are left in mix_kernel_cycles[MONITOR_RECORDING][STEREO_MODE] and sent on ITM port 0
+//
+void benchmark_audio_mix_kernels(void)
+{
+	static uint32_t src[HT16_BUFF_LEN];
+	static uint32_t dst[HT16_BUFF_LEN];
+	uint32_t monitor, stereo, rep;
+	uint32_t start;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for (monitor=0; monitor<4; monitor++)
+	{
+		for (stereo=0; stereo<2; stereo++)
+		{
+			start = DWT->CYCCNT;
+			for (rep=0; rep<BENCHMARK_REPS; rep++)
+				mix_kernels[monitor][stereo](src, dst, 0);
+
+			mix_kernel_cycles[monitor][stereo] = (DWT->CYCCNT - start) / BENCHMARK_REPS;
+			ITM_SendValue(0, mix_kernel_cycles[monitor][stereo]);
+		}
+	}
+}
+#endif
@@ -14,19 +14,103 @@
 #include "dig_pins.h"
 #include "leds.h"
 #include "circular_buffer.h"
+#include "sdram_dma.h"
+#include "sample_file.h"
 
 
 extern uint8_t SAMPLINGBYTES;
 
-void memory_clear(void)
+extern CircularBuffer* 	play_buff[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK];
+extern Sample 			samples[MAX_NUM_BANKS][NUM_SAMPLES_PER_BANK];
+extern uint8_t 			i_param[NUM_ALL_CHAN][NUM_I_PARAMS];
+
+
+//
+// Clearing the play and record buffers
+// Only the play buffer slots of samples in each channel's bank, and the head of the record buffer, are cleared.
+// The DMA clears them in the background (see sdram_dma.c), SDRAM_CLEAR_CHUNK bytes at a time, started from the main loop.
+// A slot that has started filling, or the record buffer once a recording has started, is left alone:
+// claim_play_buff_slot() and claim_rec_buff() must be called before writing to them.
+// The dir listing, index text and sample catalog areas are always written before they're read, so they're not cleared.
+//
+#define NUM_PLAY_SLOTS			(NUM_PLAY_CHAN * NUM_SAMPLES_PER_BANK)
+#define SDRAM_CLEAR_REC_HEAD	NUM_PLAY_SLOTS
+#define SDRAM_CLEAR_DONE		(NUM_PLAY_SLOTS + 1)
+
+static uint8_t 	sdram_clear_region = SDRAM_CLEAR_DONE;		//play buffer slot number, SDRAM_CLEAR_REC_HEAD or SDRAM_CLEAR_DONE
+static uint32_t sdram_clear_addr;
+static uint8_t 	play_slot_claimed[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK];
+static uint8_t 	rec_buff_claimed;
+
+//Call after the banks are loaded
+void start_sdram_clear(void)
 {
-	uint32_t i;
-	//Takes 700ms to clear the channel buffer in 32-bit chunks, roughly 83ns per write
-	for(i = SDRAM_BASE; i < (SDRAM_BASE + SDRAM_SIZE); i += 4)
-			*((uint32_t *)i) = 0x00000000;
+	sdram_clear_region 	= 0;
+	sdram_clear_addr 	= play_buff[0][0]->min;
+}
+
+void claim_play_buff_slot(uint8_t chan, uint8_t samplenum)
+{
+	play_slot_claimed[chan][samplenum] = 1;
+
+	//The DMA might be clearing part of this slot right now
+	if (sdram_clear_region != SDRAM_CLEAR_DONE) sdram_dma_wait();
+}
+
+void claim_rec_buff(void)
+{
+	rec_buff_claimed = 1;
+
+	if (sdram_clear_region != SDRAM_CLEAR_DONE) sdram_dma_wait();
 }
 
+//Returns 1 when there's nothing left to clear
+uint8_t clear_sdram_step(void)
+{
+	uint8_t chan, i;
+	uint32_t end, len;
+
+	if (sdram_clear_region == SDRAM_CLEAR_DONE) return(1);
+	if (sdram_dma_busy()) return(0);
+
+	if (sdram_clear_region < NUM_PLAY_SLOTS)
+	{
+		chan 	= sdram_clear_region / NUM_SAMPLES_PER_BANK;
+		i 		= sdram_clear_region % NUM_SAMPLES_PER_BANK;
+		end 	= play_buff[chan][i]->max;
+
+		if (play_slot_claimed[chan][i] || !samples[i_param[chan][BANK]][i].filename[0])
+			sdram_clear_addr = end;
+	}
+	else
+	{
+		end = REC_BUFF_START + REC_BUFF_CLEAR_SIZE;
 
+		if (rec_buff_claimed)
+			sdram_clear_addr = end;
+	}
+
+	if (sdram_clear_addr >= end)
+	{
+		sdram_clear_region++;
+
+		if (sdram_clear_region < NUM_PLAY_SLOTS)
+			sdram_clear_addr = play_buff[sdram_clear_region / NUM_SAMPLES_PER_BANK][sdram_clear_region % NUM_SAMPLES_PER_BANK]->min;
+
+		else if (sdram_clear_region == SDRAM_CLEAR_REC_HEAD)
+			sdram_clear_addr = REC_BUFF_START;
+
+		return (sdram_clear_region == SDRAM_CLEAR_DONE);
+	}
+
+	len = end - sdram_clear_addr;
+	if (len > SDRAM_CLEAR_CHUNK) len = SDRAM_CLEAR_CHUNK;
+
+	if (sdram_dma_fill(sdram_clear_addr, len, 0x00000000, 0))
+		sdram_clear_addr += len;
+
+	return(0);
+}
 
 uint32_t memory_read16_cb(CircularBuffer* b, int16_t *rd_buff, uint32_t num_samples, uint8_t decrement)
 {
@@ -305,57 +389,23 @@ uint32_t memory_fade_write(uint32_t *addr, uint8_t channel, int32_t *wr_buff, ui
 }
 */
 
-uint32_t RAM_test(void){
-
-	uint32_t addr;
-	uint32_t i;
-	uint16_t rd0;
-	uint16_t rd1;
-	volatile uint32_t fail=0;
-
-	addr=SDRAM_BASE;
-	for (i=0;i<(SDRAM_SIZE/2);i++){
-
-		if (i & 0x80000) 	PLAYLED1_ON;
-		else 				SIGNALLED_ON;
-
-		while(SDRAM_IS_BUSY){;}
-
-		if (i & 0x80000) 	PLAYLED1_OFF;
-		else				SIGNALLED_OFF;
-
-		rd1 = (uint16_t)((i) & 0x0000FFFF);
-		*((uint16_t *)addr) = rd1;
-
-		addr+=2;
-
-
-	}
-
-	addr=SDRAM_BASE;
-	for (i=0;i<(SDRAM_SIZE/2);i++){
-
-		if (i & 0x80000) 	PLAYLED2_ON;
-		else 				BUSYLED_ON;
-
-		while(SDRAM_IS_BUSY){;}
-
-		if (i & 0x80000) 	PLAYLED2_OFF;
-		else				BUSYLED_OFF;
-
-		rd1 = *((uint16_t *)addr);
-
-		rd0=(uint16_t)((i) & 0x0000FFFF);
-		if (rd1 != rd0)
-		{
-			fail++;
-		}
+//
+// Writes each halfword of the SDRAM with its index, then reads it back.
+// Returns the number of halfwords that didn't match.
+// The DMA does the work (see sdram_dma.c): the lights stay on while it runs
+//
+uint32_t RAM_test(void)
+{
+	SIGNALLED_ON;
+	BUSYLED_ON;
 
-		addr+=2;
+	sdram_dma_test(SDRAM_BASE, SDRAM_SIZE, 0);
+	sdram_dma_wait();
 
-	}
+	SIGNALLED_OFF;
+	BUSYLED_OFF;
 
-	return(fail);
+	return (sdram_dma_errors());
 }
 
 
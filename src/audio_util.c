@@ -22,3 +22,55 @@ uint32_t align_addr(uint32_t addr, uint32_t blockAlign)
 	return addr;
 }
 
+
+
+static inline int32_t _SMULWB(int32_t a, int32_t b);
+static inline int32_t _SMULWB(int32_t a, int32_t b) {int32_t r; asm("smulwb %[dst], %[a], %[b]" : [dst] "=r" (r) : [a] "r" (a), [b] "r" (b)); return r;}
+
+static inline int32_t _SSAT16(int32_t x);
+static inline int32_t _SSAT16(int32_t x) {asm("ssat %[dst], #16, %[src]" : [dst] "=r" (x) : [src] "r" (x)); return x;}
+
+//
+// Multiplies a block of 16-bit audio (stored in int32_t) by a gain that ramps linearly from gain_start to gain_end,
+// and saturates the result to 16 bits.
+// Gains are Q16 fixed-point (1.0 = 65536), so up to 32767.99x
+// len must be even: samples are processed in pairs
+// outR can be 0 for a single (mono) buffer
+//
+void apply_gain_ramp(int32_t *outL, int32_t *outR, uint32_t len, int32_t gain_start, int32_t gain_end)
+{
+	int32_t g0, g1, inc;
+
+	inc = (gain_end - gain_start) / (int32_t)len;
+	g0 = gain_start;
+	g1 = gain_start + inc;
+	inc <<= 1;
+
+	len >>= 1;
+
+	if (outR)
+	{
+		while (len--)
+		{
+			outL[0] = _SSAT16(_SMULWB(g0, outL[0]));
+			outR[0] = _SSAT16(_SMULWB(g0, outR[0]));
+			outL[1] = _SSAT16(_SMULWB(g1, outL[1]));
+			outR[1] = _SSAT16(_SMULWB(g1, outR[1]));
+			outL += 2;
+			outR += 2;
+			g0 += inc;
+			g1 += inc;
+		}
+	}
+	else
+	{
+		while (len--)
+		{
+			outL[0] = _SSAT16(_SMULWB(g0, outL[0]));
+			outL[1] = _SSAT16(_SMULWB(g1, outL[1]));
+			outL += 2;
+			g0 += inc;
+			g1 += inc;
+		}
+	}
+}
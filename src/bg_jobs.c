@@ -0,0 +1,173 @@
+/*
+ * bg_jobs.c
+ *
+ * Background jobs: index file, index backup, settings file, HTML sample list and CPU profile writes, and backup index loads.
+ *
+ * Each job is split into steps (one bank, one settings block, one chunk of the header cache, one line...)
+ * run_bg_jobs() is called from the main loop and runs steps of the current job until its
+ * time budget is used up, but only when is_storage_idle() says playback has enough buffered ahead.
+ * So a long write never holds off read_storage_to_buffer() for more than one step.
+ *
+ * Jobs are not pre-empted: once a job has started it runs to completion before another is picked,
+ * since the jobs share FatFs objects and the index write buffer.
+ * A job that's requested again while it's running is restarted after it finishes.
+ *
+ */
+
+#include "globals.h"
+#include "ff.h"
+#include "sampler.h"
+#include "sts_fs_index.h"
+#include "user_settings.h"
+#include "bg_jobs.h"
+#include "event_queue.h"
+#include "profiler.h"
+#include "res/LED_palette.h"
+
+extern volatile uint32_t 	sys_tmr;
+extern uint8_t 				flags[NUM_FLAGS];
+extern enum g_Errors 		g_error;
+
+#define BGJOB_TIME_BUDGET	(BASE_SAMPLE_RATE/1000) 	//1ms of sys_tmr per call to run_bg_jobs()
+
+#define BGJOB_NONE			NUM_BGJOBS
+
+static uint8_t 	bgjob_pending[NUM_BGJOBS];
+static uint8_t 	bgjob_arg[NUM_BGJOBS];
+static uint8_t 	bgjob_cur = BGJOB_NONE;
+
+
+//
+// Requests a job. arg is only used by BGJOB_LOAD_INDEX (the bank to load, or ALL_BANKS)
+//
+void start_bg_job(enum BgJobs job, uint8_t arg)
+{
+	if (job >= NUM_BGJOBS) return;
+
+	bgjob_pending[job] 	= 1;
+	bgjob_arg[job] 		= arg;
+}
+
+uint8_t is_bg_job_running(enum BgJobs job)
+{
+	return (bgjob_cur == job || bgjob_pending[job]);
+}
+
+static uint8_t begin_job(enum BgJobs job)
+{
+	switch (job)
+	{
+		case BGJOB_LOAD_INDEX:
+			if (load_sampleindex_begin(USE_BACKUP_FILE, bgjob_arg[job])) return(0);
+			break;
+
+		//The request is taken now, so a rewrite requested while this one runs sets flags[RewriteIndex] again
+		case BGJOB_WRITE_INDEX:
+			flags[WritingIndex] = MAGENTA;
+			flags[RewriteIndex] = 0;
+			write_sampleindex_begin();
+			break;
+
+		case BGJOB_BACKUP_INDEX:
+			if (backup_sampleindex_begin()!=FR_OK) return(0);
+			break;
+
+		case BGJOB_SAVE_SETTINGS:
+			begin_save_user_settings();
+			break;
+
+		case BGJOB_WRITE_SAMPLELIST:
+			write_samplelist_begin();
+			break;
+
+		case BGJOB_WRITE_PROFILE:
+			write_profile_begin();
+			break;
+
+		default:
+			return(0);
+	}
+	return(1);
+}
+
+//Returns 1 when the job is done
+static uint8_t step_job(enum BgJobs job)
+{
+	uint8_t done;
+
+	switch (job)
+	{
+		case BGJOB_LOAD_INDEX:			return load_sampleindex_step();
+		case BGJOB_WRITE_INDEX:
+		{
+			PROFILE_START(PROF_INDEX_WRITE);
+			done = write_sampleindex_step();
+			PROFILE_END(PROF_INDEX_WRITE);
+			return done;
+		}
+		case BGJOB_BACKUP_INDEX:		return backup_sampleindex_step();
+		case BGJOB_SAVE_SETTINGS:		return save_user_settings_step();
+		case BGJOB_WRITE_SAMPLELIST:	return write_samplelist_step();
+		case BGJOB_WRITE_PROFILE:		return write_profile_step();
+		default:						return 1;
+	}
+}
+
+static void finish_job(enum BgJobs job)
+{
+	switch (job)
+	{
+		case BGJOB_LOAD_INDEX:
+			load_sampleindex_end();
+			post_event(EV_FORCE_RELOAD, 0);
+			post_event(EV_FORCE_RELOAD, 1);
+			break;
+
+		case BGJOB_WRITE_INDEX:
+			if (write_sampleindex_result()!=FR_OK)
+			{
+				flags[RewriteIndexFail] = 255;
+				g_error |= CANNOT_WRITE_INDEX;
+			}
+			else
+			{
+				flags[RewriteIndexSucess] 	= 255;
+				flags[RewriteSampleList] 	= 1;
+			}
+			flags[WritingIndex] = 0;
+			break;
+
+		default:
+			break;
+	}
+}
+
+void run_bg_jobs(void)
+{
+	uint32_t 	start_tmr;
+	uint8_t 	job;
+
+	if (bgjob_cur == BGJOB_NONE)
+	{
+		for (job=0; job<NUM_BGJOBS; job++)
+			if (bgjob_pending[job]) break;
+
+		if (job == NUM_BGJOBS) return;
+
+		bgjob_pending[job] = 0;
+		if (!begin_job(job)) return;
+
+		bgjob_cur = job;
+	}
+
+	start_tmr = sys_tmr;
+	while (is_storage_idle() && (sys_tmr - start_tmr) < BGJOB_TIME_BUDGET)
+	{
+		if (step_job(bgjob_cur))
+		{
+			finish_job(bgjob_cur);
+			bgjob_cur = BGJOB_NONE;
+			break;
+		}
+	}
+}
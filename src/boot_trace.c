@@ -0,0 +1,78 @@
+/*
+ * boot_trace.c
+ *
+ * Boot-time trace (see boot_trace.h)
+ *
+ * boot_trace_mark() records the cycles since the previous mark, so each phase is timed from the end of the one before.
+ * The cycle counter wraps after 23 seconds at 180MHz: only the deltas are used, so that's ok as long as no single phase is that long.
+ *
+ */
+
+#include "globals.h"
+#include "boot_trace.h"
+#include "ITM.h"
+
+static uint32_t boot_phase_cycles[NUM_BOOT_PHASES];
+static uint32_t last_mark;
+
+static const char *boot_phase_names[NUM_BOOT_PHASES] = {
+	"Codec deinit",
+	"Pins",
+	"SDRAM",
+	"SD Card",
+	"LEDs",
+	"ADCs",
+	"Codec",
+	"Settings",
+	"Audio start",
+	"Banks",
+};
+
+void boot_trace_start(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	last_mark = 0;
+}
+
+void boot_trace_mark(enum BootPhases phase)
+{
+	uint32_t now = DWT->CYCCNT;
+
+	if (phase >= NUM_BOOT_PHASES) return;
+
+	boot_phase_cycles[phase] = now - last_mark;
+	last_mark = now;
+}
+
+uint32_t boot_phase_us(enum BootPhases phase)
+{
+	return boot_phase_cycles[phase] / (SystemCoreClock / 1000000);
+}
+
+const char *boot_phase_name(enum BootPhases phase)
+{
+	return boot_phase_names[phase];
+}
+
+//
+// Sends 0x424F4F00 + phase number and the phase's time in microseconds for each phase,
+// then 0x424F4FFF and the total
+//
+void boot_trace_end(void)
+{
+	uint8_t p;
+	uint32_t total = 0;
+
+	for (p=0; p<NUM_BOOT_PHASES; p++)
+	{
+		ITM_SendValue(BOOT_TRACE_ITM_PORT, 0x424F4F00 | p);
+		ITM_SendValue(BOOT_TRACE_ITM_PORT, boot_phase_us(p));
+		total += boot_phase_us(p);
+	}
+
+	ITM_SendValue(BOOT_TRACE_ITM_PORT, 0x424F4FFF);
+	ITM_SendValue(BOOT_TRACE_ITM_PORT, total);
+}
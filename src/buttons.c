@@ -8,6 +8,7 @@
 #include "calibration.h"
 #include "bank.h"
 #include "button_knob_combo.h"
+#include "event_queue.h"
 #include "adc.h"
 #include "system_mode.h"
 #include "sampler.h"
@@ -171,7 +172,7 @@ void Button_Debounce_IRQHandler(void)
 							if (!global_mode[EDIT_MODE])
 							{
 								if (!i_param[i-Play1][LOOPING]) 
-									flags[Play1But + (i-Play1)]=1;
+									post_event(EV_PLAY_BUT, i-Play1);
 								clear_errors();
 							}
 						break;
@@ -341,7 +342,7 @@ void Button_Debounce_IRQHandler(void)
 
 							case Rec:
 								if (button_state[Rec]<SHORT_PRESSED)
-									flags[RecTrig]=1;
+									post_event(EV_REC_TRIG, 0);
 							break;
 
 							case RecBank:
@@ -376,7 +377,7 @@ void Button_Debounce_IRQHandler(void)
 								if (!global_mode[EDIT_MODE])
 								{
 									if (i_param[i==0?Play1:Play2][LOOPING] && button_state[i==0?Play1:Play2] == DOWN) 
-										flags[i==0?Play1But:Play2But] = 1; //if looping, stop playing when lifted (assuming it's a short press)
+										post_event(EV_PLAY_BUT, i==0?0:1); //if looping, stop playing when lifted (assuming it's a short press)
 								}
 							break;
 
@@ -393,7 +394,7 @@ void Button_Debounce_IRQHandler(void)
 								if (g_button_knob_combo[bkc_Reverse1][bkc_StartPos1].combo_state == COMBO_ACTIVE)
 									g_button_knob_combo[bkc_Reverse1][bkc_StartPos1].combo_state = COMBO_LATCHED;
 								else
-									flags[Rev1Trig]=1;
+									post_event(EV_REV_TRIG, 0);
 				
 
 								clear_errors();
@@ -408,7 +409,7 @@ void Button_Debounce_IRQHandler(void)
 								if (g_button_knob_combo[bkc_Reverse2][bkc_StartPos2].combo_state == COMBO_ACTIVE)
 									g_button_knob_combo[bkc_Reverse2][bkc_StartPos2].combo_state = COMBO_LATCHED;
 								else
-									flags[Rev2Trig]=1;
+									post_event(EV_REV_TRIG, 1);
 
 								clear_errors();
 								break;
@@ -504,7 +505,7 @@ void Button_Debounce_IRQHandler(void)
 									case Rec:
 										if ( all_buttons_except( UP, (1<<Rec) ) )
 										{
-											flags[ToggleMonitor] = 1;
+											post_event(EV_TOGGLE_MONITOR, 0);
 										}
 										break;
 
@@ -520,7 +521,7 @@ void Button_Debounce_IRQHandler(void)
 												save_flash_params(0);
 											}
 											else
-												flags[ToggleLooping1] 		= 1;
+												post_event(EV_TOGGLE_LOOPING, 0);
 										}
 										break;
 
@@ -530,11 +531,11 @@ void Button_Debounce_IRQHandler(void)
 											if (global_mode[EDIT_MODE])
 											{
 												copy_sample(i_param[1][BANK], i_param[1][SAMPLE], i_param[0][BANK], i_param[0][SAMPLE]);
-												flags[ForceFileReload2] 	= 1;
+												post_event(EV_FORCE_RELOAD, 1);
 												flags[SkipProcessButtons]	= 2;
 											}
 											else
-												flags[ToggleLooping2] 		= 1;
+												post_event(EV_TOGGLE_LOOPING, 1);
 										}
 										break;
 
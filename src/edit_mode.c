@@ -13,8 +13,10 @@
 #include "bank.h"
 #include "sample_file.h"
 #include "sts_fs_index.h"
+#include "sts_fs_catalog.h"
 #include "adc.h"
 #include "button_knob_combo.h"
+#include "event_queue.h"
 
 
 
@@ -24,6 +26,8 @@ DIR 					assign_dir;
 enum AssignmentStates 	cur_assign_state=ASSIGN_OFF;
 char 					cur_assign_bank_path[_MAX_LFN];
 int32_t 				cur_assign_sample=0; 
+uint8_t					assign_use_catalog=0;
+uint32_t				cur_assign_catalog_i=0;
 
 Sample					undo_sample;
 uint8_t					undo_samplenum, undo_banknum;
@@ -46,11 +50,26 @@ extern uint8_t 			global_mode[NUM_GLOBAL_MODES];
 
 extern Sample 			samples[MAX_NUM_BANKS][NUM_SAMPLES_PER_BANK];
 extern enum 			PlayStates play_state[NUM_PLAY_CHAN];
+extern uint8_t			sample_num_now_playing[NUM_PLAY_CHAN];
+extern uint8_t			sample_bank_now_playing[NUM_PLAY_CHAN];
 
 extern ButtonKnobCombo 	g_button_knob_combo[NUM_BUTTON_KNOB_COMBO_BUTTONS][NUM_BUTTON_KNOB_COMBO_KNOBS];
 
 DIR root_dir;
 
+//Stops the channels streaming the Sample that's being assigned (i_param[0]'s bank and sample), before it's replaced.
+//A channel playing another Sample keeps playing. do_assignment() posts the reload and play events for the new one
+static void stop_chans_playing_assign_slot(void)
+{
+	uint8_t chan;
+
+	for (chan=0; chan<NUM_PLAY_CHAN; chan++)
+	{
+		if (sample_bank_now_playing[chan]==i_param[0][BANK] && sample_num_now_playing[chan]==i_param[0][SAMPLE])
+			play_state[chan] = SILENT;
+	}
+}
+
 //Wrapper for entering assignment mode,
 //going to the next assigned or unassigned sample
 //and handling the playback and visual feedback flags
@@ -136,8 +155,8 @@ void do_assignment(uint8_t direction)
 		{
 			flags[UndoSampleDiffers] = 1;
 
-			flags[ForceFileReload1] = 1;
-			flags[Play1Trig]		= 1;
+			post_event(EV_FORCE_RELOAD, 0);
+			post_event(EV_PLAY_TRIG, 0);
 
 			flags[PlaySample1Changed_valid] = 1;
 			flags[PlaySample1Changed_empty] = 0;
@@ -202,6 +221,7 @@ FRESULT init_unassigned_scan(Sample *s_sample, uint8_t samplenum, uint8_t banknu
 	//Unassigned samples represented by bank of 0xFF
 	cur_assign_bank = 0xFF;
 	cur_assign_sample = -1;
+	assign_use_catalog = 0;
 
 	//If the slot is empty, look for a filled slot in this bank
 	samplenum=0;
@@ -227,7 +247,11 @@ FRESULT init_unassigned_scan(Sample *s_sample, uint8_t samplenum, uint8_t banknu
 		//See if the folder with the default color name exists
 		bank_to_color(banknum, cur_assign_bank_path);
 
-		if (f_opendir(&assign_dir, cur_assign_bank_path) == FR_OK)
+		//(with the catalog, a missing folder just has no files in it)
+		if (is_sample_catalog_ready())
+			cur_assign_state = ASSIGN_IN_FOLDER;
+
+		else if (f_opendir(&assign_dir, cur_assign_bank_path) == FR_OK)
 		{
 			cur_assign_state = ASSIGN_IN_FOLDER;
 			return(FR_OK);
@@ -241,12 +265,76 @@ FRESULT init_unassigned_scan(Sample *s_sample, uint8_t samplenum, uint8_t banknu
 
 	}
 
+	//Browse the catalog instead of the filesystem if it's been built,
+	//unless the folder is too deep to be in the catalog
+	assign_use_catalog = is_sample_catalog_ready() && sample_catalog_has_folder(cur_assign_bank_path);
+	if (assign_use_catalog)
+	{
+		cur_assign_catalog_i = 0;
+		return(FR_OK);
+	}
+
 	//Verify the folder exists and can be opened
 	//Leave it open, so we can browse it with next_unassigned_sample
 	return (f_opendir(&assign_dir, cur_assign_bank_path));
 
 }
 
+//Same as next_unassigned_sample(), but looks up the files in the catalog
+//instead of reading the filesystem, so playback doesn't have to stop
+static uint8_t next_unassigned_sample_from_catalog(void)
+{
+	CatalogEntry	*entry;
+	char 			undo_path[_MAX_LFN];
+	char 			tmp[_MAX_LFN];
+	uint8_t			bank;
+
+	if (!is_sample_catalog_ready()) return(0); //catalog was invalidated (SD Card reloaded)
+
+	//The original sample's folder is browsed first (ASSIGN_IN_FOLDER), so it's skipped afterwards
+	if (str_split(undo_sample.filename,'/', undo_path, tmp))
+			undo_path[str_len(undo_path)-1]='\0'; //remove trailing slash
+	else	undo_path[0]='\0'; //filename contained no slash: use root dir
+
+	bank = next_enabled_bank(MAX_NUM_BANKS);
+
+	for (;;)
+	{
+		if (cur_assign_catalog_i >= sample_catalog_size())
+		{
+			//We hit the end of the original sample's folder: 
+			//Go through the entire catalog
+			if (cur_assign_state==ASSIGN_IN_FOLDER)
+			{
+				cur_assign_state = ASSIGN_UNUSED_IN_FS;
+				cur_assign_catalog_i = 0;
+				continue;
+			}
+
+			//No more unassigned files: go through the assigned samples
+			init_assigned_scan();
+			return (next_assigned_sample());
+		}
+
+		entry = sample_catalog_entry(cur_assign_catalog_i++);
+
+		if (cur_assign_state==ASSIGN_IN_FOLDER)
+		{
+			if (!is_catalog_entry_in_folder(entry, cur_assign_bank_path)) continue;
+		}
+		else
+		{
+			if (is_catalog_entry_in_folder(entry, undo_path)) continue;
+			if (find_filename_in_all_banks(bank, entry->filename) != 0xFF) continue; //Skip this file if it's already assigned somewhere
+		}
+
+		catalog_entry_to_sample(entry, &samples[i_param[0][BANK]][i_param[0][SAMPLE]]);
+
+		cur_assign_sample++;
+		return(1); //sample found
+	}
+}
+
 //Find the next file in the folder, 
 //and when we get to the end we go to the next bank
 //and after that we load the original file name
@@ -264,8 +352,10 @@ uint8_t next_unassigned_sample(void)
 	uint8_t	bank;
 	uint32_t max_folders_bailout=1024;
 
-	play_state[0]=SILENT;
-	play_state[1]=SILENT;
+	stop_chans_playing_assign_slot();
+
+	if (assign_use_catalog)
+		return (next_unassigned_sample_from_catalog());
 
 	//
 	//Search for files in the bank we are currently checking (assign_dir)
@@ -452,6 +542,7 @@ uint8_t next_assigned_sample(void)
 		// If so, then we want to load the undo_sample
 		if (cur_assign_bank==i_param[0][BANK] && cur_assign_sample==i_param[0][SAMPLE])
 		{
+			stop_chans_playing_assign_slot();
 			restore_undo_state( i_param[0][BANK], i_param[0][SAMPLE] );
 			return(1); //sample found
 		}
@@ -459,6 +550,7 @@ uint8_t next_assigned_sample(void)
 		// See if this sample is valid, and then load in the current slot
 		if (is_wav(samples[cur_assign_bank][cur_assign_sample].filename))
 		{
+			stop_chans_playing_assign_slot();
 			copy_sample( i_param[0][BANK], i_param[0][SAMPLE], cur_assign_bank, cur_assign_sample);
 			return(1); //sample found
 		}
@@ -516,8 +608,8 @@ uint8_t restore_undo_state(uint8_t bank, uint8_t samplenum)
 		samples[undo_banknum][undo_samplenum].inst_end 			= undo_sample.inst_end;
 		samples[undo_banknum][undo_samplenum].inst_gain 		= undo_sample.inst_gain;
 
-		flags[ForceFileReload1] 	= 1;
-		flags[Play1Trig]			= 1;
+		post_event(EV_FORCE_RELOAD, 0);
+		post_event(EV_PLAY_TRIG, 0);
 		flags[UndoSampleExists] 	= 0;
 		flags[UndoSampleDiffers]	= 0;
 
@@ -600,7 +692,7 @@ void exit_edit_mode(void)
 
 		if (scrubbed_in_edit)
 		{
-			if (cached_play_state)	flags[Play1Trig] = 1;
+			if (cached_play_state)	post_event(EV_PLAY_TRIG, 0);
 			else if (play_state[0] == PREBUFFERING) 	play_state[0] = SILENT;
 			else if (play_state[0] != SILENT){
 				play_state[0] = PLAY_FADEDOWN;
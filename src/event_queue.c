@@ -0,0 +1,122 @@
+/*
+ * event_queue.c
+ *
+ * Single-producer/single-consumer event queues from the interrupts to the main loop (see event_queue.h)
+ *
+ * head and tail are free-running 8-bit counters: the queue holds (head - tail) events.
+ * The producer writes the event, then head (after a memory barrier), and the main loop reads the event, then writes tail,
+ * so neither side needs to disable interrupts.
+ *
+ * get_next_event() merges the queues in the order the events were posted (by timestamp),
+ * and keeps track of the longest time an event waited in a queue.
+ *
+ */
+
+#include "globals.h"
+#include "codec.h"
+#include "event_queue.h"
+
+extern volatile uint32_t 	sys_tmr;
+
+static EventQueue 	event_queue[NUM_EVENT_QUEUES];
+
+static uint32_t 	max_latency;
+static uint32_t 	unknown_producer_events;
+
+//Returns the queue for the interrupt (or main loop) that's running, or NUM_EVENT_QUEUES if it doesn't have one
+static enum EventQueues current_event_queue(void)
+{
+	uint32_t ipsr = __get_IPSR();
+
+	if (ipsr == 0) return EVQ_MAIN;
+
+	switch ((int32_t)ipsr - 16)
+	{
+		case AUDIO_I2S2_EXT_DMA_IRQ:	return EVQ_AUDIO;
+		case TIM5_IRQn:					return EVQ_TRIG_JACKS;
+		case TIM4_IRQn:					return EVQ_BUTTONS;
+		case TIM1_BRK_TIM9_IRQn:		return EVQ_PARAMS;
+		default:						return NUM_EVENT_QUEUES;
+	}
+}
+
+void post_event(enum EventTypes type, uint8_t chan)
+{
+	enum EventQueues q;
+	EventQueue *evq;
+	Event *e;
+	uint8_t head;
+
+	q = current_event_queue();
+	if (q >= NUM_EVENT_QUEUES) {unknown_producer_events++; return;}
+
+	evq = &event_queue[q];
+	head = evq->head;
+
+	if ((uint8_t)(head - evq->tail) >= EVENT_QUEUE_SIZE) {evq->overflows++; return;}
+
+	e = &evq->ev[head & (EVENT_QUEUE_SIZE - 1)];
+	e->timestamp 	= sys_tmr;
+	e->type 		= type;
+	e->chan 		= chan;
+
+	__DMB();
+	evq->head = head + 1;
+}
+
+//
+// Main loop only: takes the oldest event from all the queues.
+// Returns 0 if all queues are empty
+//
+uint8_t get_next_event(Event *e)
+{
+	EventQueue *evq;
+	Event *first;
+	uint8_t q, oldest_q;
+	uint32_t latency;
+
+	oldest_q = NUM_EVENT_QUEUES;
+	for (q=0; q<NUM_EVENT_QUEUES; q++)
+	{
+		evq = &event_queue[q];
+		if (evq->head == evq->tail) continue;
+		__DMB();
+
+		first = &evq->ev[evq->tail & (EVENT_QUEUE_SIZE - 1)];
+		if (oldest_q == NUM_EVENT_QUEUES || (int32_t)(first->timestamp - e->timestamp) < 0)
+		{
+			oldest_q = q;
+			e->timestamp = first->timestamp;
+		}
+	}
+	if (oldest_q == NUM_EVENT_QUEUES) return(0);
+
+	evq = &event_queue[oldest_q];
+	*e = evq->ev[evq->tail & (EVENT_QUEUE_SIZE - 1)];
+
+	__DMB();
+	evq->tail = evq->tail + 1;
+
+	latency = sys_tmr - e->timestamp;
+	if (latency > max_latency) max_latency = latency;
+
+	return(1);
+}
+
+//Longest time an event waited to be handled, in sys_tmr ticks (frames)
+uint32_t event_max_latency(void)
+{
+	return max_latency;
+}
+
+//Events dropped because a queue was full, or posted from an interrupt that doesn't have a queue
+uint32_t events_lost(void)
+{
+	uint32_t lost = unknown_producer_events;
+	uint8_t q;
+
+	for (q=0; q<NUM_EVENT_QUEUES; q++)
+		lost += event_queue[q].overflows;
+
+	return lost;
+}
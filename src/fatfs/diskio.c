@@ -283,29 +283,76 @@ DSTATUS sdio_disk_status(void) {
 
 
 //
-// sdio_disk_read()
+// A CRC error at the high speed bus clock means the card (or the wiring) can't keep up:
+// drop to the default speed for good (see SD_LimitBusSpeed()), and the caller tries the transfer again
 //
-DRESULT sdio_disk_read(BYTE *data, DWORD addr, UINT count)
+static uint8_t sdio_crc_fallback(SD_Error err)
+{
+	if (err != SD_DATA_CRC_FAIL || SD_GetBusSpeed() == SD_BUS_SPEED_DEFAULT)
+		return 0;
+
+	SD_LimitBusSpeed(SD_BUS_SPEED_DEFAULT);
+	return 1;
+}
+
+static DRESULT sdio_read_blocks(BYTE *data, DWORD addr, UINT count, SD_Error *err)
 {
-	SD_Error 		err=0;
 	SDTransferState State;
 
-	err = SD_ReadMultiBlocksFIXED(data, addr, BLOCK_SIZE, count);
+	*err = SD_ReadMultiBlocksFIXED(data, addr, BLOCK_SIZE, count);
 
-	if (err==SD_OK)
+	if (*err==SD_OK)
 	{
-		err = SD_WaitReadOperation();
+		*err = SD_WaitReadOperation();
 
 		//while(SD_GetStatus() != SD_TRANSFER_OK);
 		while ((State = SD_GetStatus()) == SD_TRANSFER_BUSY);
 
-		if ((State == SD_TRANSFER_ERROR) || (err != SD_OK))
+		if ((State == SD_TRANSFER_ERROR) || (*err != SD_OK))
+			return RES_ERROR;
+		else
+			return RES_OK;
+	}
+
+	return(*err);
+}
+
+//
+// sdio_disk_read()
+//
+DRESULT sdio_disk_read(BYTE *data, DWORD addr, UINT count)
+{
+	SD_Error 		err=0;
+	DRESULT 		res;
+
+	res = sdio_read_blocks(data, addr, count, &err);
+
+	if (res != RES_OK && sdio_crc_fallback(err))
+		res = sdio_read_blocks(data, addr, count, &err);
+
+	return res;
+}
+
+static DRESULT sdio_write_blocks(const BYTE *buff, DWORD sector, UINT count, SD_Error *err)
+{
+	SDTransferState State;
+
+//	*err = SD_WriteMultiBlocksFIXED((uint8_t *)buff, sector << 9, BLOCK_SIZE, count);
+	*err = SD_WriteMultiBlocksFIXED((uint8_t *)buff, sector, BLOCK_SIZE, count);
+
+	if (*err == SD_OK) {
+
+		*err = SD_WaitWriteOperation();
+
+		while ((State = SD_GetStatus()) == SD_TRANSFER_BUSY); // BUSY, OK (DONE), ERROR (FAIL)
+
+		if ((State == SD_TRANSFER_ERROR) || (*err != SD_OK))
 			return RES_ERROR;
 		else
 			return RES_OK;
 	}
 
-	return(err);
+	return(*err);
 }
 
 //
@@ -314,7 +361,7 @@ DRESULT sdio_disk_read(BYTE *data, DWORD addr, UINT count)
 DRESULT sdio_disk_write(const BYTE *buff, DWORD sector, UINT count)
 {
 	SD_Error 		err = 0;
-	SDTransferState State;
+	DRESULT 		res;
 
 #if FATFS_USE_WRITEPROTECT_PIN > 0
 	if (!sdio_write_enabled()) {
@@ -328,22 +375,13 @@ DRESULT sdio_disk_write(const BYTE *buff, DWORD sector, UINT count)
 	}
 #endif
 
-//	err = SD_WriteMultiBlocksFIXED((uint8_t *)buff, sector << 9, BLOCK_SIZE, count);
-	err = SD_WriteMultiBlocksFIXED((uint8_t *)buff, sector, BLOCK_SIZE, count);
+	res = sdio_write_blocks(buff, sector, count, &err);
 
-	if (err == SD_OK) {
-
-		err = SD_WaitWriteOperation();
-
-		while ((State = SD_GetStatus()) == SD_TRANSFER_BUSY); // BUSY, OK (DONE), ERROR (FAIL)
+	//Writing the same blocks again is safe
+	if (res != RES_OK && sdio_crc_fallback(err))
+		res = sdio_write_blocks(buff, sector, count, &err);
 
-		if ((State == SD_TRANSFER_ERROR) || (err != SD_OK))
-			return RES_ERROR;
-		else
-			return RES_OK;
-	}
-		
-	return(err);
+	return res;
 }
 
 
@@ -355,6 +355,11 @@ __IO SD_Error TransferError = SD_OK;
 __IO uint32_t TransferEnd = 0, DMAEndOfTransfer = 0;
 SD_CardInfo SDCardInfo;
 
+static SD_BusSpeed BusSpeed = SD_BUS_SPEED_DEFAULT;
+static SD_BusSpeed BusSpeedLimit = SD_BUS_SPEED_HIGH; /*!< Lowered after CRC errors, kept until reset */
+static uint8_t HighSpeedCard = 0;
+static __IO uint32_t CRCErrorCount = 0;
+
 SDIO_InitTypeDef SDIO_InitStructure;
 SDIO_CmdInitTypeDef SDIO_CmdInitStructure;
 SDIO_DataInitTypeDef SDIO_DataInitStructure;
@@ -375,6 +380,8 @@ static SD_Error CmdResp6Error(uint8_t cmd, uint16_t *prca);
 static SD_Error SDEnWideBus(FunctionalState NewState);
 static SD_Error IsCardProgramming(uint8_t *pstatus);
 static SD_Error FindSCR(uint16_t rca, uint32_t *pscr);
+static SD_Error SDSwitchFunction(uint32_t arg, uint8_t *pstatus);
+static void SDConfigBus(uint32_t BusWide);
 uint8_t convert_from_bytes_to_power_of_two(uint16_t NumberOfBytes);
 
 /**
@@ -430,13 +437,10 @@ SD_Error SD_Init(void)
   /*!< Configure the SDIO peripheral */
   /*!< SDIO_CK = SDIOCLK / (SDIO_TRANSFER_CLK_DIV + 2) */
   /*!< on STM32F4xx devices, SDIOCLK is fixed to 48MHz */
-  SDIO_InitStructure.SDIO_ClockDiv = SDIO_TRANSFER_CLK_DIV;
-  SDIO_InitStructure.SDIO_ClockEdge = SDIO_ClockEdge_Rising;
-  SDIO_InitStructure.SDIO_ClockBypass = SDIO_ClockBypass_Enable; //was disabled
-  SDIO_InitStructure.SDIO_ClockPowerSave = SDIO_ClockPowerSave_Disable;
-  SDIO_InitStructure.SDIO_BusWide = SDIO_BusWide_1b;
-  SDIO_InitStructure.SDIO_HardwareFlowControl = SDIO_HardwareFlowControl_Enable; //was disabled
-  SDIO_Init(&SDIO_InitStructure);
+  /*!< The card is in default speed mode until SD_HighSpeed() switches it */
+  BusSpeed = SD_BUS_SPEED_DEFAULT;
+  HighSpeedCard = 0;
+  SDConfigBus(SDIO_BusWide_1b);
   /*----------------- Read CSD/CID MSD registers ------------------*/
   errorstatus = SD_GetCardInfo(&SDCardInfo);
 
@@ -451,6 +455,17 @@ SD_Error SD_Init(void)
     errorstatus = SD_EnableWideBusOperation(SDIO_BusWide_4b);
   }
 
+  /*----------------- High speed mode (48MHz) --------------------*/
+  /*!< If the card can't switch, it stays in default speed mode (24MHz) */
+  if (errorstatus == SD_OK)
+  {
+    if (SD_HighSpeed() == SD_OK)
+    {
+      HighSpeedCard = 1;
+      SD_SetBusSpeed(SD_BUS_SPEED_HIGH);
+    }
+  }
+
   return(errorstatus);
 }
 
@@ -1103,13 +1118,7 @@ SD_Error SD_EnableWideBusOperation(uint32_t WideMode)
       if (SD_OK == errorstatus)
       {
         /*!< Configure the SDIO peripheral */
-        SDIO_InitStructure.SDIO_ClockDiv = SDIO_TRANSFER_CLK_DIV;
-        SDIO_InitStructure.SDIO_ClockEdge = SDIO_ClockEdge_Rising;
-        SDIO_InitStructure.SDIO_ClockBypass = SDIO_ClockBypass_Enable; //was disabled
-        SDIO_InitStructure.SDIO_ClockPowerSave = SDIO_ClockPowerSave_Disable;
-        SDIO_InitStructure.SDIO_BusWide = SDIO_BusWide_4b;
-        SDIO_InitStructure.SDIO_HardwareFlowControl = SDIO_HardwareFlowControl_Enable; //was disabled
-        SDIO_Init(&SDIO_InitStructure);
+        SDConfigBus(SDIO_BusWide_4b);
       }
     }
     else
@@ -1119,13 +1128,7 @@ SD_Error SD_EnableWideBusOperation(uint32_t WideMode)
       if (SD_OK == errorstatus)
       {
         /*!< Configure the SDIO peripheral */
-        SDIO_InitStructure.SDIO_ClockDiv = SDIO_TRANSFER_CLK_DIV;
-        SDIO_InitStructure.SDIO_ClockEdge = SDIO_ClockEdge_Rising;
-        SDIO_InitStructure.SDIO_ClockBypass = SDIO_ClockBypass_Enable; //was disabled
-        SDIO_InitStructure.SDIO_ClockPowerSave = SDIO_ClockPowerSave_Disable;
-        SDIO_InitStructure.SDIO_BusWide = SDIO_BusWide_1b;
-        SDIO_InitStructure.SDIO_HardwareFlowControl = SDIO_HardwareFlowControl_Enable; //was disabled
-        SDIO_Init(&SDIO_InitStructure);
+        SDConfigBus(SDIO_BusWide_1b);
       }
     }
   }
@@ -1133,6 +1136,136 @@ SD_Error SD_EnableWideBusOperation(uint32_t WideMode)
   return(errorstatus);
 }
 
+/**
+  * @brief  Switches the card to high speed mode (CMD6, function group 1, function 1),
+  *         if it supports it. Needs SD spec version 1.10 or later (SCR).
+  *         The SDIO clock is not changed: call SD_SetBusSpeed(SD_BUS_SPEED_HIGH) after.
+  * @param  None
+  * @retval SD_Error: SD_OK if the card switched, SD_UNSUPPORTED_FEATURE if it can't,
+  *         or the error of the command that failed.
+  */
+SD_Error SD_HighSpeed(void)
+{
+  SD_Error errorstatus = SD_OK;
+  uint32_t scr[2] = {0, 0};
+  uint32_t status[16];
+  uint8_t *pstatus = (uint8_t *)status;
+
+  if ((SDIO_STD_CAPACITY_SD_CARD_V1_1 != CardType) && (SDIO_STD_CAPACITY_SD_CARD_V2_0 != CardType) && (SDIO_HIGH_CAPACITY_SD_CARD != CardType))
+  {
+    return(SD_UNSUPPORTED_FEATURE);
+  }
+
+  /*!< Get SCR Register: SD_SPEC is in bits 59:56 */
+  errorstatus = FindSCR(RCA, scr);
+
+  if (errorstatus != SD_OK)
+  {
+    return(errorstatus);
+  }
+
+  if (((scr[1] >> 24) & 0x0F) == SD_ALLZERO)
+  {
+    return(SD_UNSUPPORTED_FEATURE);
+  }
+
+  /*!< Check mode: is function 1 (high speed) of group 1 supported? (status bit 401) */
+  errorstatus = SDSwitchFunction(0x00FFFFF1, pstatus);
+
+  if (errorstatus != SD_OK)
+  {
+    return(errorstatus);
+  }
+
+  if ((pstatus[13] & 0x02) == SD_ALLZERO)
+  {
+    return(SD_UNSUPPORTED_FEATURE);
+  }
+
+  /*!< Switch mode: the card answers with the function it switched to (status bits 379:376) */
+  errorstatus = SDSwitchFunction(0x80FFFFF1, pstatus);
+
+  if (errorstatus != SD_OK)
+  {
+    return(errorstatus);
+  }
+
+  if ((pstatus[16] & 0x0F) != 0x01)
+  {
+    return(SD_SWITCH_ERROR);
+  }
+
+  return(SD_OK);
+}
+
+/**
+  * @brief  Sets the SDIO bus clock, up to the limit set by SD_LimitBusSpeed().
+  *         SD_BUS_SPEED_HIGH is only used if the card is in high speed mode.
+  * @param  speed: SD_BUS_SPEED_DEFAULT (24MHz) or SD_BUS_SPEED_HIGH (48MHz)
+  * @retval None
+  */
+void SD_SetBusSpeed(SD_BusSpeed speed)
+{
+  if (speed > BusSpeedLimit)
+  {
+    speed = BusSpeedLimit;
+  }
+
+  if ((speed == SD_BUS_SPEED_HIGH) && !HighSpeedCard)
+  {
+    speed = SD_BUS_SPEED_DEFAULT;
+  }
+
+  BusSpeed = speed;
+  SDConfigBus(SDIO_InitStructure.SDIO_BusWide);
+}
+
+/**
+  * @brief  Lowers the fastest bus clock allowed, and the current one if it's faster.
+  *         The limit is kept when the card is initialized again (until reset).
+  * @param  max_speed: fastest bus clock allowed.
+  * @retval None
+  */
+void SD_LimitBusSpeed(SD_BusSpeed max_speed)
+{
+  BusSpeedLimit = max_speed;
+
+  if (BusSpeed > BusSpeedLimit)
+  {
+    SD_SetBusSpeed(BusSpeedLimit);
+  }
+}
+
+/**
+  * @brief  Returns the current bus clock.
+  * @param  None
+  * @retval SD_BusSpeed
+  */
+SD_BusSpeed SD_GetBusSpeed(void)
+{
+  return(BusSpeed);
+}
+
+/**
+  * @brief  Returns 1 if the card was switched to high speed mode by SD_Init().
+  * @param  None
+  * @retval uint8_t
+  */
+uint8_t SD_IsHighSpeedCard(void)
+{
+  return(HighSpeedCard);
+}
+
+/**
+  * @brief  Returns the number of data transfers that ended with a CRC error, since reset.
+  * @param  None
+  * @retval uint32_t
+  */
+uint32_t SD_GetCRCErrorCount(void)
+{
+  return(CRCErrorCount);
+}
+
 /**
   * @brief  Selects od Deselects the corresponding card.
   * @param  addr: Address of the Card to be selected.
@@ -2175,6 +2308,7 @@ SD_Error SD_ProcessIRQSrc(void)
   {
     SDIO_ClearITPendingBit(SDIO_IT_DCRCFAIL);
     TransferError = SD_DATA_CRC_FAIL;
+    CRCErrorCount++;
   }
   else if (SDIO_GetITStatus(SDIO_IT_DTIMEOUT) != RESET)
   {
@@ -2946,6 +3080,129 @@ static SD_Error FindSCR(uint16_t rca, uint32_t *pscr)
   return(errorstatus);
 }
 
+/**
+  * @brief  Sends CMD6 SWITCH_FUNC and reads the 512-bit status the card answers with.
+  * @param  arg: CMD6 argument (mode bit 31, and the function of each group).
+  * @param  pstatus: buffer for the 64 status bytes, in the order they're sent (must be word aligned).
+  * @retval SD_Error: SD Card Error code.
+  */
+static SD_Error SDSwitchFunction(uint32_t arg, uint8_t *pstatus)
+{
+  SD_Error errorstatus = SD_OK;
+  uint32_t count = 0;
+  uint32_t *tempbuff = (uint32_t *)pstatus;
+  uint32_t *endbuff = tempbuff + 16;
+
+  SDIO->DCTRL = 0x0;
+
+  /*!< Set Block Size To 64 Bytes */
+  SDIO_CmdInitStructure.SDIO_Argument = (uint32_t)64;
+  SDIO_CmdInitStructure.SDIO_CmdIndex = SD_CMD_SET_BLOCKLEN;
+  SDIO_CmdInitStructure.SDIO_Response = SDIO_Response_Short;
+  SDIO_CmdInitStructure.SDIO_Wait = SDIO_Wait_No;
+  SDIO_CmdInitStructure.SDIO_CPSM = SDIO_CPSM_Enable;
+  SDIO_SendCommand(&SDIO_CmdInitStructure);
+
+  errorstatus = CmdResp1Error(SD_CMD_SET_BLOCKLEN);
+
+  if (errorstatus != SD_OK)
+  {
+    return(errorstatus);
+  }
+
+  SDIO_DataInitStructure.SDIO_DataTimeOut = SD_DATATIMEOUT;
+  SDIO_DataInitStructure.SDIO_DataLength = 64;
+  SDIO_DataInitStructure.SDIO_DataBlockSize = SDIO_DataBlockSize_64b;
+  SDIO_DataInitStructure.SDIO_TransferDir = SDIO_TransferDir_ToSDIO;
+  SDIO_DataInitStructure.SDIO_TransferMode = SDIO_TransferMode_Block;
+  SDIO_DataInitStructure.SDIO_DPSM = SDIO_DPSM_Enable;
+  SDIO_DataConfig(&SDIO_DataInitStructure);
+
+  /*!< Send CMD6 SWITCH_FUNC */
+  SDIO_CmdInitStructure.SDIO_Argument = arg;
+  SDIO_CmdInitStructure.SDIO_CmdIndex = SD_CMD_HS_SWITCH;
+  SDIO_CmdInitStructure.SDIO_Response = SDIO_Response_Short;
+  SDIO_CmdInitStructure.SDIO_Wait = SDIO_Wait_No;
+  SDIO_CmdInitStructure.SDIO_CPSM = SDIO_CPSM_Enable;
+  SDIO_SendCommand(&SDIO_CmdInitStructure);
+
+  errorstatus = CmdResp1Error(SD_CMD_HS_SWITCH);
+
+  if (errorstatus != SD_OK)
+  {
+    return(errorstatus);
+  }
+
+  while (!(SDIO->STA & (SDIO_FLAG_RXOVERR | SDIO_FLAG_DCRCFAIL | SDIO_FLAG_DTIMEOUT | SDIO_FLAG_DBCKEND | SDIO_FLAG_STBITERR)))
+  {
+    if ((SDIO_GetFlagStatus(SDIO_FLAG_RXFIFOHF) != RESET) && (tempbuff + 8 <= endbuff))
+    {
+      for (count = 0; count < 8; count++)
+      {
+        *(tempbuff + count) = SDIO_ReadData();
+      }
+      tempbuff += 8;
+    }
+  }
+
+  if (SDIO_GetFlagStatus(SDIO_FLAG_DTIMEOUT) != RESET)
+  {
+    SDIO_ClearFlag(SDIO_FLAG_DTIMEOUT);
+    errorstatus = SD_DATA_TIMEOUT;
+    return(errorstatus);
+  }
+  else if (SDIO_GetFlagStatus(SDIO_FLAG_DCRCFAIL) != RESET)
+  {
+    SDIO_ClearFlag(SDIO_FLAG_DCRCFAIL);
+    errorstatus = SD_DATA_CRC_FAIL;
+    return(errorstatus);
+  }
+  else if (SDIO_GetFlagStatus(SDIO_FLAG_RXOVERR) != RESET)
+  {
+    SDIO_ClearFlag(SDIO_FLAG_RXOVERR);
+    errorstatus = SD_RX_OVERRUN;
+    return(errorstatus);
+  }
+  else if (SDIO_GetFlagStatus(SDIO_FLAG_STBITERR) != RESET)
+  {
+    SDIO_ClearFlag(SDIO_FLAG_STBITERR);
+    errorstatus = SD_START_BIT_ERR;
+    return(errorstatus);
+  }
+
+  /*!< Read the words left in the FIFO */
+  count = SD_DATATIMEOUT;
+  while ((SDIO_GetFlagStatus(SDIO_FLAG_RXDAVL) != RESET) && (tempbuff < endbuff) && (count > 0))
+  {
+    *tempbuff = SDIO_ReadData();
+    tempbuff++;
+    count--;
+  }
+
+  /*!< Clear all the static flags */
+  SDIO_ClearFlag(SDIO_STATIC_FLAGS);
+
+  return(errorstatus);
+}
+
+/**
+  * @brief  Configures the SDIO peripheral for the bus width and the current bus clock (BusSpeed).
+  *         SDIO_CK = 48MHz (divider bypassed) in high speed mode, otherwise
+  *         SDIO_CK = SDIOCLK / (SDIO_TRANSFER_CLK_DIV + 2) = 24MHz
+  * @param  BusWide: SDIO_BusWide_1b or SDIO_BusWide_4b
+  * @retval None
+  */
+static void SDConfigBus(uint32_t BusWide)
+{
+  SDIO_InitStructure.SDIO_ClockDiv = SDIO_TRANSFER_CLK_DIV;
+  SDIO_InitStructure.SDIO_ClockEdge = SDIO_ClockEdge_Rising;
+  SDIO_InitStructure.SDIO_ClockBypass = (BusSpeed == SD_BUS_SPEED_HIGH) ? SDIO_ClockBypass_Enable : SDIO_ClockBypass_Disable;
+  SDIO_InitStructure.SDIO_ClockPowerSave = SDIO_ClockPowerSave_Disable;
+  SDIO_InitStructure.SDIO_BusWide = BusWide;
+  SDIO_InitStructure.SDIO_HardwareFlowControl = SDIO_HardwareFlowControl_Enable; //was disabled
+  SDIO_Init(&SDIO_InitStructure);
+}
+
 /**
   * @brief  Converts the number of bytes in power of two and returns the power.
   * @param  NumberOfBytes: number of bytes.
@@ -4,6 +4,7 @@
 #include "sts_filesystem.h"
 #include "str_util.h"
 #include "ff.h"
+#include "audio_sdram.h"
 
 
 //Returns the next directory in the parent_dir
@@ -81,47 +82,77 @@ FRESULT find_next_ext_in_dir(DIR* dir, const char *ext, char *fname)
     return (0xFD); //should not reach here, error
 }
 
-// find_next_ext_in_dir_alpha()
-// - finds next file in 'path' alphabetically
-// - sets fname as the filename for that file
-// - Returns FRESULT representing whether a file was available or not, and the reason if not.
-// - files that are already assigned are kept track of in the static array used_from_folder[MAX_FILES_IN_FOLDER]
-// - set do_init to FIND_ALPHA_INIT_FOLDER to reset the alphabetical searching, or when calling this function with a new path
-FRESULT find_next_ext_in_dir_alpha(char* path, const char *ext, char *fname, enum INIT_FIND_ALPHA_ACTIONS do_init)
+//
+// Alphabetical directory listing
+// The files in a folder ending in ext are read once into the dir listing pool (SDRAM) and sorted.
+// Names are packed from the start of the pool, and the table of name offsets grows down from the end,
+// so the number of files in a folder is only limited by the total length of their names.
+//
+static char       dirlist_path[_MAX_LFN+1];
+static char       dirlist_ext[5];
+static uint32_t   dirlist_num_files;
+static uint32_t   dirlist_cur;
+static uint8_t    dirlist_valid = 0;
+
+#define DIRLIST_TABLE_END       ((uint32_t *)(DIRLIST_POOL_START + DIRLIST_POOL_SIZE))
+#define DIRLIST_NAME(offset)    ((char *)(DIRLIST_POOL_START + (offset)))
+
+static void dirlist_sift_down(uint32_t *table, uint32_t root, uint32_t n)
 {
-    FRESULT res;
-    FILINFO fno;
-    uint32_t i;
-    DIR dir;
+    uint32_t child, tmp;
 
-    uint32_t  firstf_num = 0xFFFF;                       
-    uint32_t  fnum       = 0;
-    char      firstf_name[_MAX_LFN+1];
-    static  uint8_t  used_from_folder[MAX_FILES_IN_FOLDER];
+    while ((child = root*2 + 1) < n)
+    {
+        if ((child+1) < n && str_cmp_alpha(DIRLIST_NAME(table[child+1]), DIRLIST_NAME(table[child])) > 0)
+            child++;
 
-    
-    // Initialize variables
-    if (do_init == FIND_ALPHA_INIT_FOLDER){
-       for(i=0; i<MAX_FILES_IN_FOLDER; i++){used_from_folder[i]=0;} // Reset folder tracking   
-       return(FR_OK);
-    }  
+        if (str_cmp_alpha(DIRLIST_NAME(table[child]), DIRLIST_NAME(table[root])) <= 0)
+            return;
+
+        tmp = table[root]; table[root] = table[child]; table[child] = tmp;
+        root = child;
+    }
+}
+
+//Heapsort: in-place, O(n log n), and no recursion
+static void dirlist_sort(uint32_t *table, uint32_t n)
+{
+    uint32_t i, tmp;
 
+    if (n<2) return;
 
-    for (i=0; i<_MAX_LFN+1; i++){firstf_name[i]=127;}   // last possible file name, alphabetically
-    fname[0]      =  0;                                 // null string
-    fno.fname[0]  = 'a';                                // enables while loop
+    for (i=n/2; i>0; i--)
+        dirlist_sift_down(table, i-1, n);
 
-    // Open folder
-    res = f_opendir(&dir, path);   
+    for (i=n-1; i>0; i--)
+    {
+        tmp = table[0]; table[0] = table[i]; table[i] = tmp;
+        dirlist_sift_down(table, 0, i);
+    }
+}
+
+static FRESULT dirlist_build(char* path, const char *ext)
+{
+    FRESULT res;
+    FILINFO fno;
+    DIR dir;
+    uint32_t i;
+    uint32_t name_end = 0;
+
+    dirlist_valid     = 0;
+    dirlist_num_files = 0;
+    dirlist_cur       = 0;
+
+    res = f_opendir(&dir, path);
     if (res!=FR_OK) return(res);
 
-    // Loop through folder content
     for (;;){
-        res = f_readdir(&dir, &fno);                               // next file in firectory
-        if (res!=FR_OK)          return(res);                      // filesystem error
-        if (fno.fname[0] == 0)  {fname[0]=0; break;}               // no more files found -> exit loop
-        if (fno.fname[0] == '.') continue;                         // ignore files starting with a .
-        i = str_len(fno.fname);  if (i==0xFFFFFFFF) return (0xFE); // invalid file name 
+        res = f_readdir(&dir, &fno);
+        if (res!=FR_OK)          {f_closedir(&dir); return(res);}   // filesystem error
+        if (fno.fname[0] == 0)   break;                             // no more files found -> exit loop
+        if (fno.fname[0] == '.') continue;                          // ignore files starting with a .
+        i = str_len(fno.fname);  if (i==0xFFFFFFFF) {f_closedir(&dir); return (0xFE);} // invalid file name
+        if (i < 4 || i > (_MAX_LFN - 2)) continue;                  // ignore files with names too short or too long
 
         // check for extension at the end of filename
         if (         fno.fname[i-4]  == ext[0] \
@@ -130,29 +161,56 @@ FRESULT find_next_ext_in_dir_alpha(char* path, const char *ext, char *fname, enu
             && upper(fno.fname[i-1]) == upper(ext[3]) \
            )
         {
-            fnum++;
-            if (used_from_folder[fnum-1]){continue;}                                            // if file already used, move on to next file
-            else
-            {
-              if (str_len(fno.fname) > (_MAX_LFN - 2)) {used_from_folder[fnum-1]=1; continue;}  // if filename is too long: Mark as 'used' and look for next file
-              if((str_cmp_alpha(firstf_name, fno.fname) > 0))                                   // if found file comes first alphabetically
-              {
-                firstf_num=fnum-1;                                                              // set number of the first file to the current file number
-                str_cpy(firstf_name, fno.fname);                                                // set the name of the first file to the current file name
-              }
-            }
+            // stop if the name and its offset don't fit in the pool
+            if ((DIRLIST_POOL_START + name_end + i + 1) > (uint32_t)(DIRLIST_TABLE_END - dirlist_num_files - 1)) break;
+
+            str_cpy(DIRLIST_NAME(name_end), fno.fname);
+            *(DIRLIST_TABLE_END - dirlist_num_files - 1) = name_end;
+            dirlist_num_files++;
+            name_end += i + 1;
         }
-    }    
+    }
 
-    // Close folder
     f_closedir(&dir);
 
-    if (firstf_num==0xFFFF) return(NO_MORE_AVAILABLE_FILES); // if no more files available: return accordingly    
-    
+    dirlist_sort(DIRLIST_TABLE_END - dirlist_num_files, dirlist_num_files);
+
+    str_cpy(dirlist_path, path);
+    str_cpy(dirlist_ext, (char *)ext);
+    dirlist_valid = 1;
+
+    return (FR_OK);
+}
+
+// find_next_ext_in_dir_alpha()
+// - finds next file in 'path' alphabetically
+// - sets fname as the filename for that file
+// - Returns FRESULT representing whether a file was available or not, and the reason if not.
+// - the folder is read and sorted once (see dirlist_build()), after that each call returns the next name in the listing
+// - set do_init to FIND_ALPHA_INIT_FOLDER to reset the alphabetical searching, or when calling this function with a new path
+FRESULT find_next_ext_in_dir_alpha(char* path, const char *ext, char *fname, enum INIT_FIND_ALPHA_ACTIONS do_init)
+{
+    FRESULT res;
+
+    // Discard the listing: it's read again from the folder on the next call
+    if (do_init == FIND_ALPHA_INIT_FOLDER){
+       dirlist_valid = 0;
+       return(FR_OK);
+    }
+
+    fname[0] = 0;                                                       // null string
+
+    if (!dirlist_valid || !str_cmp(dirlist_path, path) || !str_cmp(dirlist_ext, (char *)ext))
+    {
+        res = dirlist_build(path, ext);
+        if (res!=FR_OK) return(res);
+    }
+
+    if (dirlist_cur >= dirlist_num_files) return(NO_MORE_AVAILABLE_FILES); // if no more files available: return accordingly
+
     // Return next filename, in alphabetical order
-    str_cpy(fname, firstf_name);                   // use first filename found alphabetically
-    used_from_folder[firstf_num]=1;                // mark file as found
-    return (FR_OK);                                // return accoridngly
+    str_cpy(fname, DIRLIST_NAME( (DIRLIST_TABLE_END - dirlist_num_files)[dirlist_cur++] ));
+    return (FR_OK);
 }
 
 //Checks if string ends in ".wav" (case-insensitive)
@@ -66,7 +66,7 @@ FLASH_Status flash_erase_sector(uint32_t address)
 FLASH_Status flash_open_erase_sector(uint32_t address)
 {
 	uint8_t i;
-	FLASH_Status status;
+	FLASH_Status status = FLASH_COMPLETE;
 
 	for (i = 0; i < 12; ++i) {
 		if (address == kSectorBaseAddress[i]) {
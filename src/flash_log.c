@@ -0,0 +1,317 @@
+/*
+ * flash_log.c
+ *
+ * Log-structured key/value store in internal FLASH (see flash_log.h)
+ *
+ * Sector layout (32-bit words):
+ *   [magic] [sequence] [record] [record] ... [0xFFFFFFFF (erased)]
+ * The sector with the magic word and the highest sequence number is the active one.
+ * Compaction writes the sequence number, then the records, and the magic word last,
+ * so a compaction that's cut short by a power loss leaves the old sector active.
+ *
+ * Record layout (32-bit words):
+ *   [header: FLASH_LOG_REC_MARK | key | size in bytes] [data, padded to a whole word] [check]
+ * The check word is written last: a record cut short by a power loss has no valid check, and is skipped.
+ * The latest valid record of a key holds its value.
+ *
+ */
+
+#include "globals.h"
+#include "flash.h"
+#include "flash_log.h"
+
+#define FLASH_LOG_SECTOR_MAGIC		0x5E771465
+#define FLASH_LOG_REC_MARK			0xA5000000
+#define FLASH_LOG_REC_MARK_MASK		0xFF000000
+#define FLASH_LOG_ERASED			0xFFFFFFFF
+
+#define FLASH_LOG_HEADER_BYTES		8
+
+#define REC_KEY(h)					(((h) >> 16) & 0xFF)
+#define REC_SIZE(h)					((h) & 0xFFFF)
+#define REC_BYTES(size)				(4 + (((size) + 3) & ~3) + 4)
+
+static uint32_t flash_log_sector[2] = {FLASH_LOG_SECTOR_A, FLASH_LOG_SECTOR_B};
+
+static uint8_t 	active_sector;			//index in flash_log_sector[], or 0xFF if neither sector is formatted
+static uint32_t active_seq;
+static uint32_t write_addr;				//address of the first erased word after the last record
+static uint32_t latest_rec[FLASH_LOG_MAX_KEYS];	//address of each key's latest valid record, or 0 if it has none
+static uint8_t 	log_damaged;			//set when a record header is garbled or a write fails: forces a compaction
+
+static uint32_t rec_check(uint32_t header, uint32_t data_addr)
+{
+	uint32_t i, check;
+	uint32_t words = (REC_SIZE(header) + 3) >> 2;
+
+	//Rotate-and-add over the header and data words.
+	//0xFFFFFFFF is what an erased (unwritten) check word reads as, so it's never a valid check
+	check = header;
+	for (i=0; i<words; i++)
+		check = ((check << 5) | (check >> 27)) + flash_read_word(data_addr + i*4);
+
+	return (check == FLASH_LOG_ERASED) ? 0 : check;
+}
+
+static uint8_t is_sector_blank(uint32_t sector_addr)
+{
+	uint32_t addr;
+
+	for (addr = sector_addr; addr < sector_addr + FLASH_LOG_SECTOR_SIZE; addr += 4)
+		if (flash_read_word(addr) != FLASH_LOG_ERASED) return(0);
+
+	return(1);
+}
+
+//Walks the records of the active sector, to find each key's latest record and the end of the log
+static void scan_active_sector(void)
+{
+	uint32_t i, header, rec_bytes;
+	uint32_t sector_end = flash_log_sector[active_sector] + FLASH_LOG_SECTOR_SIZE;
+	uint32_t addr = flash_log_sector[active_sector] + FLASH_LOG_HEADER_BYTES;
+
+	for (i=0; i<FLASH_LOG_MAX_KEYS; i++)
+		latest_rec[i] = 0;
+
+	while (addr < sector_end)
+	{
+		header = flash_read_word(addr);
+		if (header == FLASH_LOG_ERASED) break;
+
+		rec_bytes = REC_BYTES(REC_SIZE(header));
+
+		//A garbled header means we can't find the next record: treat the sector as full
+		if ((header & FLASH_LOG_REC_MARK_MASK) != FLASH_LOG_REC_MARK || (addr + rec_bytes) > sector_end)
+		{
+			log_damaged = 1;
+			addr = sector_end;
+			break;
+		}
+
+		if (REC_KEY(header) < FLASH_LOG_MAX_KEYS && flash_read_word(addr + rec_bytes - 4) == rec_check(header, addr + 4))
+			latest_rec[REC_KEY(header)] = addr;
+
+		addr += rec_bytes;
+	}
+	write_addr = addr;
+}
+
+//Erases the sector (if it's not already blank), and flushes the FLASH data cache so we don't read back stale words
+static FLASH_Status erase_log_sector(uint32_t sector_addr)
+{
+	FLASH_Status status;
+
+	if (is_sector_blank(sector_addr)) return FLASH_COMPLETE;
+
+	flash_begin_open_program();
+	status = flash_open_erase_sector(sector_addr);
+	flash_end_open_program();
+
+	FLASH_DataCacheCmd(DISABLE);
+	FLASH_DataCacheReset();
+	FLASH_DataCacheCmd(ENABLE);
+
+	return status;
+}
+
+//
+// Finds the active sector and scans its records.
+// If neither sector has been formatted, sector A is erased and formatted: this only happens on the first boot
+//
+void flash_log_init(void)
+{
+	uint32_t i;
+	uint32_t seq[2];
+	uint8_t valid[2];
+
+	for (i=0; i<2; i++)
+	{
+		valid[i] 	= (flash_read_word(flash_log_sector[i]) == FLASH_LOG_SECTOR_MAGIC);
+		seq[i] 		= flash_read_word(flash_log_sector[i] + 4);
+	}
+
+	log_damaged = 0;
+
+	if (valid[0] && valid[1]) 	active_sector = ((int32_t)(seq[1] - seq[0]) > 0) ? 1 : 0;
+	else if (valid[0])			active_sector = 0;
+	else if (valid[1])			active_sector = 1;
+	else
+	{
+		active_sector = 0xFF;
+		for (i=0; i<FLASH_LOG_MAX_KEYS; i++) latest_rec[i] = 0;
+
+		if (erase_log_sector(flash_log_sector[0]) != FLASH_COMPLETE) return;
+
+		flash_begin_open_program();
+		flash_open_program_word(1, flash_log_sector[0] + 4);
+		flash_open_program_word(FLASH_LOG_SECTOR_MAGIC, flash_log_sector[0]);
+		flash_end_open_program();
+
+		if (flash_read_word(flash_log_sector[0]) != FLASH_LOG_SECTOR_MAGIC) return;
+
+		active_sector = 0;
+		seq[0] = 1;
+	}
+
+	active_seq = seq[active_sector];
+	scan_active_sector();
+}
+
+//
+// Copies the latest value of key into data (up to size bytes)
+// Returns 1 if the key has a value, or 0 if it doesn't (data is left alone)
+//
+uint8_t flash_log_read(uint8_t key, void *data, uint16_t size)
+{
+	uint32_t header;
+
+	if (key >= FLASH_LOG_MAX_KEYS || !latest_rec[key]) return(0);
+
+	header = flash_read_word(latest_rec[key]);
+	if (size > REC_SIZE(header)) size = REC_SIZE(header);
+
+	flash_read_array((uint8_t *)data, latest_rec[key] + 4, size);
+	return(1);
+}
+
+static uint8_t is_same_as_latest(uint8_t key, const uint8_t *data, uint16_t size)
+{
+	uint32_t i;
+
+	if (!latest_rec[key] || REC_SIZE(flash_read_word(latest_rec[key])) != size) return(0);
+
+	for (i=0; i<size; i++)
+		if (flash_read_byte(latest_rec[key] + 4 + i) != data[i]) return(0);
+
+	return(1);
+}
+
+//Programs a record at addr, which must have room for it
+static FLASH_Status program_record(uint32_t addr, uint32_t header, const uint8_t *data)
+{
+	uint32_t i, word;
+	uint32_t size = REC_SIZE(header);
+	FLASH_Status status;
+
+	flash_begin_open_program();
+
+	status = flash_open_program_word(header, addr);
+
+	for (i=0; i<size && status==FLASH_COMPLETE; i+=4)
+	{
+		word = 	((uint32_t)data[i])
+			| (((i+1)<size ? (uint32_t)data[i+1] : 0) << 8)
+			| (((i+2)<size ? (uint32_t)data[i+2] : 0) << 16)
+			| (((i+3)<size ? (uint32_t)data[i+3] : 0) << 24);
+
+		status = flash_open_program_word(word, addr + 4 + i);
+	}
+
+	if (status == FLASH_COMPLETE)
+		status = flash_open_program_word(rec_check(header, addr + 4), addr + REC_BYTES(size) - 4);
+
+	flash_end_open_program();
+
+	return status;
+}
+
+//
+// Saves a value for key. Nothing is written if it's the same as the key's latest value.
+// Each word programmed stalls FLASH reads for about 16us, so a small record never holds off the audio interrupt for long.
+// Returns FLASH_BUSY if there's no room left in the active sector: call again after flash_log_compact()
+//
+FLASH_Status flash_log_append(uint8_t key, const void *data, uint16_t size)
+{
+	uint32_t header, rec_bytes;
+	FLASH_Status status;
+
+	if (key >= FLASH_LOG_MAX_KEYS || size > FLASH_LOG_MAX_DATA) return FLASH_ERROR_OPERATION;
+	if (active_sector > 1) return FLASH_ERROR_OPERATION;
+
+	if (is_same_as_latest(key, (const uint8_t *)data, size)) return FLASH_COMPLETE;
+
+	header 		= FLASH_LOG_REC_MARK | ((uint32_t)key << 16) | size;
+	rec_bytes 	= REC_BYTES(size);
+
+	if ((write_addr + rec_bytes) > (flash_log_sector[active_sector] + FLASH_LOG_SECTOR_SIZE))
+		return FLASH_BUSY;
+
+	status = program_record(write_addr, header, (const uint8_t *)data);
+
+	if (status == FLASH_COMPLETE && flash_read_word(write_addr + rec_bytes - 4) == rec_check(header, write_addr + 4))
+		latest_rec[key] = write_addr;
+	else
+	{
+		log_damaged = 1;
+		if (status == FLASH_COMPLETE) status = FLASH_ERROR_PROGRAM;
+	}
+
+	//Skip the whole record even if it failed, since some of its words may be programmed
+	write_addr += rec_bytes;
+
+	return status;
+}
+
+uint8_t flash_log_needs_compaction(void)
+{
+	if (active_sector > 1) return(0);
+
+	return (log_damaged || (write_addr + FLASH_LOG_COMPACT_RESERVE) > (flash_log_sector[active_sector] + FLASH_LOG_SECTOR_SIZE));
+}
+
+//
+// Copies the latest record of each key into the other sector, and makes it the active one.
+// Blocks for 1-2 seconds while the other sector is erased, and FLASH can't be read during that time,
+// so the interrupts stall as well.
+//
+FLASH_Status flash_log_compact(void)
+{
+	uint8_t key;
+	uint8_t new_sector;
+	uint32_t addr, rec_bytes, i;
+	uint32_t new_latest[FLASH_LOG_MAX_KEYS];
+	FLASH_Status status;
+
+	if (active_sector > 1) return FLASH_ERROR_OPERATION;
+
+	new_sector = 1 - active_sector;
+
+	status = erase_log_sector(flash_log_sector[new_sector]);
+	if (status != FLASH_COMPLETE) return status;
+
+	addr = flash_log_sector[new_sector] + FLASH_LOG_HEADER_BYTES;
+
+	flash_begin_open_program();
+
+	for (key=0; key<FLASH_LOG_MAX_KEYS && status==FLASH_COMPLETE; key++)
+	{
+		new_latest[key] = 0;
+		if (!latest_rec[key]) continue;
+
+		rec_bytes = REC_BYTES(REC_SIZE(flash_read_word(latest_rec[key])));
+		for (i=0; i<rec_bytes && status==FLASH_COMPLETE; i+=4)
+			status = flash_open_program_word(flash_read_word(latest_rec[key] + i), addr + i);
+
+		new_latest[key] = addr;
+		addr += rec_bytes;
+	}
+
+	if (status == FLASH_COMPLETE)
+		status = flash_open_program_word(active_seq + 1, flash_log_sector[new_sector] + 4);
+
+	if (status == FLASH_COMPLETE)
+		status = flash_open_program_word(FLASH_LOG_SECTOR_MAGIC, flash_log_sector[new_sector]);
+
+	flash_end_open_program();
+
+	if (status != FLASH_COMPLETE) return status;
+
+	active_sector 	= new_sector;
+	active_seq 		= active_seq + 1;
+	write_addr 		= addr;
+	log_damaged 	= 0;
+	for (key=0; key<FLASH_LOG_MAX_KEYS; key++)
+		latest_rec[key] = new_latest[key];
+
+	return FLASH_COMPLETE;
+}
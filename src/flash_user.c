@@ -1,5 +1,24 @@
+/*
+ * flash_user.c
+ *
+ * System calibrations in internal FLASH.
+ *
+ * Each group of calibration values is a key in the FLASH log (flash_log.c), so saving appends
+ * a small record for each group that changed, and never erases a sector.
+ * The log is only compacted at boot, before the audio and the trigger interrupts start: erasing a sector stalls
+ * every interrupt for 1-2 seconds, and there's no time during a performance when that's safe.
+ * After boot at least FLASH_LOG_COMPACT_RESERVE bytes are free, room for hundreds of saves.
+ * If a session does fill the log, saves wait until the next boot.
+ *
+ * Firmware before the log kept the whole SystemCalibrations struct in sector 1 (FLASH_ADDR_userparams).
+ * That sector is still read at boot, and values in the log override it.
+ *
+ */
+
+#include <stddef.h>
 #include "globals.h"
 #include "flash.h"
+#include "flash_log.h"
 #include "flash_user.h"
 #include "calibration.h"
 #include "params.h"
@@ -14,6 +33,7 @@ SystemCalibrations *staging_system_calibrations = &s_staging_user_params;
 extern SystemCalibrations *system_calibrations;
 
 extern uint8_t global_mode[NUM_GLOBAL_MODES];
+extern uint8_t flags[NUM_FLAGS];
 
 
 extern float 	f_param[NUM_PLAY_CHAN][NUM_F_PARAMS];
@@ -26,6 +46,32 @@ extern int16_t i_smoothed_cvadc[NUM_CV_ADCS];
 
 #define FLASH_SYMBOL_firmwareoffset 0xAA550000
 
+enum CalibrationKeys {
+	CALKEY_FW_VERSION,
+	CALKEY_CV_OFFSET,
+	CALKEY_CODEC_ADC_DCOFFSET,
+	CALKEY_CODEC_DAC_DCOFFSET,
+	CALKEY_LED_BRIGHTNESS,
+	CALKEY_TRACKING_COMP,
+	CALKEY_PITCH_DETENT,
+
+	NUM_CALKEYS
+};
+
+//The part of SystemCalibrations that each key holds
+static const struct {
+	uint16_t offset;
+	uint16_t size;
+} cal_key_field[NUM_CALKEYS] = {
+	{offsetof(SystemCalibrations, major_firmware_version), 			2 * sizeof(uint32_t)},	//major and minor
+	{offsetof(SystemCalibrations, cv_calibration_offset), 			sizeof(s_staging_user_params.cv_calibration_offset)},
+	{offsetof(SystemCalibrations, codec_adc_calibration_dcoffset), 	sizeof(s_staging_user_params.codec_adc_calibration_dcoffset)},
+	{offsetof(SystemCalibrations, codec_dac_calibration_dcoffset), 	sizeof(s_staging_user_params.codec_dac_calibration_dcoffset)},
+	{offsetof(SystemCalibrations, led_brightness), 					sizeof(s_staging_user_params.led_brightness)},
+	{offsetof(SystemCalibrations, tracking_comp), 					sizeof(s_staging_user_params.tracking_comp)},
+	{offsetof(SystemCalibrations, pitch_pot_detent_offset), 		sizeof(s_staging_user_params.pitch_pot_detent_offset)},
+};
+
 
 void apply_firmware_specific_adjustments(void)
 {
@@ -77,21 +123,12 @@ void factory_reset(void)
 
 uint32_t load_flash_params(void)
 {
-	uint8_t i;
-	uint8_t *src;
-	uint8_t *dst;
-
 	read_all_system_calibrations_from_FLASH(); //into staging area
 
 	if (staging_system_calibrations->major_firmware_version <= 30) //valid firmware version
 	{
+		*system_calibrations = *staging_system_calibrations;
 
-		//memcopy: system_calibrations = staging_system_calibrations;
-		dst = (uint8_t *)system_calibrations;
-		src = (uint8_t *)staging_system_calibrations;
-		for (i=0;i<sizeof(SystemCalibrations);i++)
-			*dst++ = *src++;
-		
 		return (1); //Valid firmware version found
 	} else
 	{
@@ -102,82 +139,92 @@ uint32_t load_flash_params(void)
 }
 
 
+//
+// Can be called from an interrupt: the values are written from the main loop, by update_flash_params()
+// The LEDs blink num_led_blinks times (see LED_PWM_IRQHandler())
+//
 void save_flash_params(uint8_t num_led_blinks)
 {
-	uint32_t i;
-
 	copy_system_calibrations_into_staging();
 
 	write_all_system_calibrations_to_FLASH();
 
-	for (i=0;i<num_led_blinks;i++){
-		SIGNALLED_ON;
-		BUSYLED_ON;
-		PLAYLED1_ON;
-		PLAYLED2_ON;
-		delay_ms(10);
-
-		SIGNALLED_OFF;
-		BUSYLED_OFF;
-		PLAYLED1_OFF;
-		PLAYLED2_OFF;
-
-		delay_ms(10);
-	}
+	flags[BlinkSavedFlashParams] = num_led_blinks;
 }
 
 
 void copy_system_calibrations_into_staging(void)
 {
-	uint8_t i;
-	uint8_t *src;
-	uint8_t *dst;
-
-	//copy: staging_system_calibrations = system_calibrations;
-	dst = (uint8_t *)staging_system_calibrations;
-	src = (uint8_t *)system_calibrations;
-	for (i=0;i<sizeof(SystemCalibrations);i++)
-		*dst++ = *src++;
+	*staging_system_calibrations = *system_calibrations;
 }
 
 
+//Requests the staging area be written to FLASH. The main loop writes it in update_flash_params()
 void write_all_system_calibrations_to_FLASH(void)
 {
-	uint8_t i;
-	uint8_t *addr;
-
-	flash_begin_open_program();
+	flags[SaveFlashParams] = 1;
+}
 
-	flash_open_erase_sector(FLASH_ADDR_userparams);
+//Appends a record for each group of values in cal that differs from what's in FLASH
+static FLASH_Status append_system_calibrations_to_log(SystemCalibrations *cal)
+{
+	uint8_t key;
+	FLASH_Status status;
 
-	staging_system_calibrations->major_firmware_version += FLASH_SYMBOL_firmwareoffset;
+	for (key=0; key<NUM_CALKEYS; key++)
+	{
+		status = flash_log_append(key, (uint8_t *)cal + cal_key_field[key].offset, cal_key_field[key].size);
+		if (status != FLASH_COMPLETE) return status;
+	}
+	return FLASH_COMPLETE;
+}
 
-	addr = (uint8_t *)staging_system_calibrations;
+//
+// Called from the main loop: writes requested saves.
+// If the log is full, the save waits for the compaction at the next boot (see read_all_system_calibrations_from_FLASH())
+//
+void update_flash_params(void)
+{
+	static SystemCalibrations snapshot;
+	FLASH_Status status;
 
-	for(i=0;i<sizeof(SystemCalibrations);i++)
+	if (flags[SaveFlashParams])
 	{
-		flash_open_program_byte(*addr++, FLASH_ADDR_userparams + i);
+		//save_flash_params() can be called from an interrupt while this runs:
+		//clear the request first so a new one isn't lost, and append a copy that can't change half-way
+		__disable_irq();
+		flags[SaveFlashParams] = 0;
+		snapshot = *staging_system_calibrations;
+		__enable_irq();
+
+		status = append_system_calibrations_to_log(&snapshot);
+
+		//FLASH_BUSY means the log is full: try again after it's compacted
+		if (status == FLASH_BUSY)
+			flags[SaveFlashParams] = 1;
 	}
-
-	flash_end_open_program();
 }
 
 
 void read_all_system_calibrations_from_FLASH(void)
 {
 	uint8_t i;
-	uint8_t *ptr;
 	uint8_t invalid_fw_version=0;
 
-	ptr = (uint8_t *)staging_system_calibrations;
-
-	for(i=0;i<sizeof(SystemCalibrations);i++)
-	{
-		*ptr++ = flash_read_byte(FLASH_ADDR_userparams + i);
-	}
+	//Values saved by firmware before the FLASH log
+	flash_read_array((uint8_t *)staging_system_calibrations, FLASH_ADDR_userparams, sizeof(SystemCalibrations));
 
 	staging_system_calibrations->major_firmware_version -= FLASH_SYMBOL_firmwareoffset;
 
+	flash_log_init();
+
+	//This is called at boot before the audio and trigger interrupts start, so the stall can't be heard
+	if (flash_log_needs_compaction())
+		flash_log_compact();
+
+	for (i=0; i<NUM_CALKEYS; i++)
+		flash_log_read(i, (uint8_t *)staging_system_calibrations + cal_key_field[i].offset, cal_key_field[i].size);
+
 	if (staging_system_calibrations->major_firmware_version > 30)
 		invalid_fw_version = 1;
 
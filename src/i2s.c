@@ -16,8 +16,9 @@ DMA_InitTypeDef dma_tx, dma_rx;
 NVIC_InitTypeDef nvic_i2s2ext, NVIC_InitStructure;
 
 
-volatile int16_t tx_buffer[codec_BUFF_LEN];
-volatile int16_t rx_buffer[codec_BUFF_LEN];
+//Word-aligned so the mix kernels can read/write a 16-bit sample and its padding word as one uint32_t
+volatile int16_t tx_buffer[codec_BUFF_LEN] __attribute__ ((aligned (4)));
+volatile int16_t rx_buffer[codec_BUFF_LEN] __attribute__ ((aligned (4)));
 
 
 uint32_t tx_buffer_start, rx_buffer_start;
@@ -8,6 +8,7 @@
 #include "timekeeper.h"
 #include "params.h"
 #include "calibration.h"
+#include "profiler.h"
 
 
 extern SystemCalibrations *system_calibrations;
@@ -15,8 +16,8 @@ extern SystemCalibrations *system_calibrations;
 extern uint32_t end_out_ctr[NUM_PLAY_CHAN];
 extern uint32_t play_led_flicker_ctr[NUM_PLAY_CHAN];
 
-uint8_t play_led_state[NUM_PLAY_CHAN]={0,0};
-//uint8_t clip_led_state[NUM_PLAY_CHAN]={0,0};
+uint8_t play_led_state[NUM_PLAY_CHAN]={0};
+//uint8_t clip_led_state[NUM_PLAY_CHAN]={0};
 
 extern uint8_t global_mode[NUM_GLOBAL_MODES];
 extern uint8_t flags[NUM_FLAGS];
@@ -27,6 +28,7 @@ extern volatile uint32_t sys_tmr;
 void LED_PWM_IRQHandler(void)
 {
 	static uint32_t loop_led_PWM_ctr=0;
+	static uint32_t save_blink_ctr=0;
 	uint32_t tm_11 = sys_tmr & 0x07FF; //11-bit counter
 	uint32_t tm_12 = sys_tmr & 0x0FFF; //12-bit counter
 	uint32_t tm_13 = sys_tmr & 0x1FFF; //13-bit counter
@@ -34,8 +36,22 @@ void LED_PWM_IRQHandler(void)
 
 	if (TIM_GetITStatus(TIM2, TIM_IT_Update) != RESET)
 	{
+		PROFILE_START(PROF_LED_PWM);
 
-		if (global_mode[CALIBRATE]==0 && global_mode[SYSTEM_MODE]==0)
+		//Saved the system calibrations (see save_flash_params()): blink 10ms on, 10ms off
+		if (flags[BlinkSavedFlashParams])
+		{
+			if (save_blink_ctr < 48)	{SIGNALLED_ON; BUSYLED_ON; PLAYLED1_ON; PLAYLED2_ON;}
+			else						{SIGNALLED_OFF; BUSYLED_OFF; PLAYLED1_OFF; PLAYLED2_OFF;}
+
+			if (++save_blink_ctr >= 96)
+			{
+				save_blink_ctr = 0;
+				flags[BlinkSavedFlashParams]--;
+			}
+		}
+
+		else if (global_mode[CALIBRATE]==0 && global_mode[SYSTEM_MODE]==0)
 		{
 
 			if ((play_led_state[1] && global_mode[STEREO_MODE] || play_led_state[0]) && (loop_led_PWM_ctr<system_calibrations->led_brightness) && !play_led_flicker_ctr[0])
@@ -80,6 +96,8 @@ void LED_PWM_IRQHandler(void)
 		else ENDOUT2_OFF;
 
 
+		PROFILE_END(PROF_LED_PWM);
+
 		TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
 
 	}
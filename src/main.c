@@ -11,6 +11,7 @@ main.c
 
 #include "audio_sdram.h"
 #include "codec.h"
+#include "audio_codec.h"
 #include "i2s.h"
 #include "adc.h"
 #include "params.h"
@@ -29,10 +30,17 @@ main.c
 #include "bank.h"
 #include "sts_fs_index.h"
 #include "sts_filesystem.h"
+#include "sts_fs_catalog.h"
 #include "edit_mode.h"
 #include "system_mode.h"
 #include "stm32f4_discovery_sdio_sd.h"
 #include "user_settings.h"
+#include "bg_jobs.h"
+#include "time_stretch.h"
+#include "profiler.h"
+#include "boot_trace.h"
+#include "sdram_dma.h"
+#include "sdcard_speed.h"
 
 #define HAS_BOOTLOADER
 
@@ -99,7 +107,6 @@ int main(void)
 	uint32_t do_factory_reset=0;
 	uint32_t timeout_boot;
 	uint32_t valid_fw_version;
-	FRESULT res;
 
 	SD_DeInit();
 
@@ -112,11 +119,14 @@ int main(void)
 	TRACE_init();
 	//ITM_Init(6000000);
 
+	boot_trace_start();
+
 	//Codec and I2S/DMA should be disabled before they can properly start up
     Codec_Deinit();
     DeInit_I2S_Clock();
 	DeInit_I2SDMA();
 	delay();
+	boot_trace_mark(BOOT_CODEC_DEINIT);
 
 	#ifdef HAS_BOOTLOADER
 	if (check_bootloader_keys())
@@ -140,7 +150,7 @@ int main(void)
 		while(timeout_boot--){;}
 		PLAYLED1_OFF;PLAYLED2_OFF;SIGNALLED_OFF;BUSYLED_OFF;
 	}
-
+	boot_trace_mark(BOOT_PINS);
 
     //Turn on middle lights, for debugging
 	SIGNALLED_ON;
@@ -149,21 +159,19 @@ int main(void)
 	init_timekeeper();
 
 	//Initialize SDRAM memory
+	//The play and record buffers are cleared in the background after boot (see clear_sdram_step())
 	SDRAM_Init();
+	init_sdram_dma();
 	if (RAMTEST_BUTTONS) RAM_startup_test();
-	delay();
-
-
-	timeout_boot = 0x00800000;
-	PLAYLED1_ON;
-	while(timeout_boot--){;}
-	PLAYLED1_OFF;
+	boot_trace_mark(BOOT_SDRAM);
 
     //Turn off middle lights, for debugging
 	SIGNALLED_OFF;
 	BUSYLED_OFF;
 
 	reload_sdcard();
+	measure_sdcard_speed();
+	boot_trace_mark(BOOT_SDCARD);
 
 	//Turn on the lights
 	LEDDriver_Init(2); //2 = # of LED driver chips
@@ -174,6 +182,7 @@ int main(void)
 	init_buttonLEDs();
 	init_ButtonLED_IRQ();
 	init_LED_PWM_IRQ();
+	boot_trace_mark(BOOT_LEDS);
 
 	//Initialize ADCs
 	Deinit_Pot_ADC();
@@ -181,13 +190,14 @@ int main(void)
 	init_LowPassCoefs();
 	Init_Pot_ADC((uint16_t *)potadc_buffer, NUM_POT_ADCS);
 	Init_CV_ADC((uint16_t *)cvadc_buffer, NUM_CV_ADCS);
-
+	boot_trace_mark(BOOT_ADCS);
 
 	//Initialize Codec
 	Codec_GPIO_Init();
 	Codec_AudioInterface_Init(BASE_SAMPLE_RATE);
 	init_audio_dma();
 	Codec_Register_Setup(0);
+	boot_trace_mark(BOOT_CODEC);
 
 	//Initialize parameters/modes
 	global_mode[CALIBRATE] = 0;
@@ -243,10 +253,20 @@ int main(void)
     init_buttons();
     init_ButtonDebounce_IRQ();
     init_TrigJackDebounce_IRQ();
+	boot_trace_mark(BOOT_SETTINGS);
 
-	//Begin audio DMA
 	audio_buffer_init();
 
+#ifdef BENCHMARK_AUDIO_KERNELS
+	benchmark_audio_mix_kernels();
+	benchmark_time_stretch();
+#endif
+
+	//Begin audio DMA: audio input is monitored while the banks load
+	update_audio_mix_kernel();
+	Start_I2SDMA();
+	boot_trace_mark(BOOT_AUDIO_START);
+
 	// request unaltered backup of index @ boot
 	flags[BootBak]=1; 
     
@@ -254,16 +274,21 @@ int main(void)
     LEDDRIVER_OUTPUTENABLE_ON;
 
     //Load all banks
-	init_banks(); // calls load_all_banks which calls index_write_wrapper()
+	init_banks(); // calls load_all_banks, which requests the index rewrite (flags[RewriteIndex])
 
-  	// Backup index file (unless we are booting for the first time)
-    if (!do_factory_reset) backup_sampleindex_file();
-
-	Start_I2SDMA();
+	//Now that we know which samples are in the banks, clear their play buffers (and the start of the rec buffer) in the background
+	start_sdram_clear();
 
-	delay();
+  	// Backup index file after it's rewritten (unless we are booting for the first time)
+    if (!do_factory_reset) start_bg_job(BGJOB_BACKUP_INDEX, 0);
 
 	init_SDIO_read_IRQ();
+	boot_trace_mark(BOOT_BANKS);
+	boot_trace_end();
+
+#ifdef CPU_PROFILER
+	profile_init();
+#endif
 
 	//Main loop
 	//All routines accessing the SD card should run here
@@ -271,12 +296,17 @@ int main(void)
 
 		check_errors();
 		
+		PROFILE_START(PROF_WRITE_STORAGE);
 		write_buffer_to_storage();
+		PROFILE_END(PROF_WRITE_STORAGE);
 
 		if (flags[TimeToReadStorage])
 		{
 			flags[TimeToReadStorage]=0;
+
+			PROFILE_START(PROF_READ_STORAGE);
 			read_storage_to_buffer();
+			PROFILE_END(PROF_READ_STORAGE);
 		}
 
 		if (flags[FindNextSampleToAssign])
@@ -296,28 +326,51 @@ int main(void)
 		if (flags[SaveUserSettings])
 		{
 			flags[SaveUserSettings] = 0;
-			save_user_settings();
+			start_bg_job(BGJOB_SAVE_SETTINGS, 0);
 		}
 
 		process_mode_flags();
 
-		if (flags[RewriteIndex])
-		{
-			res = index_write_wrapper();
-			if (res) {	flags[RewriteIndexFail] = 255;	g_error |= CANNOT_WRITE_INDEX;}
-			else 		flags[RewriteIndexSucess] = 255;
+		verify_sample_headers_idle();
 
-			flags[RewriteIndex] = 0;
-		}
+		build_sample_catalog_idle();
+
+		//flags[RewriteIndex] is cleared when the job begins. If it's set again while the job runs,
+		//the index is written again after it finishes
+		if (flags[RewriteIndex] && !is_bg_job_running(BGJOB_WRITE_INDEX))
+			start_bg_job(BGJOB_WRITE_INDEX, 0);
 
 		if (flags[LoadBackupIndex])
 		{
-			load_sampleindex_file(USE_BACKUP_FILE, flags[LoadBackupIndex] - 1);
+			start_bg_job(BGJOB_LOAD_INDEX, flags[LoadBackupIndex] - 1);
 			flags[LoadBackupIndex] 		= 0;
-			flags[ForceFileReload1] 	= 1;
-			flags[ForceFileReload2] 	= 1;
 		}
 
+		//The HTML list isn't needed while editing, so wait until we leave Edit Mode
+		if (flags[RewriteSampleList] && !global_mode[EDIT_MODE])
+		{
+			flags[RewriteSampleList] = 0;
+			start_bg_job(BGJOB_WRITE_SAMPLELIST, 0);
+		}
+
+#ifdef CPU_PROFILER
+		if (flags[WriteCPUProfile])
+		{
+			flags[WriteCPUProfile] = 0;
+			start_bg_job(BGJOB_WRITE_PROFILE, 0);
+		}
+#endif
+
+		run_bg_jobs();
+
+		clear_sdram_step();
+
+		update_flash_params();
+
+#ifdef CPU_PROFILER
+		profile_poll();
+#endif
+
 		if (flags[ShutdownAndBootload])
 		{
 			flags[ShutdownAndBootload] = 0;
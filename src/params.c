@@ -14,29 +14,38 @@
 #include "wav_recording.h"
 #include "rgb_leds.h"
 #include "equal_pow_pan_padded.h"
-#include "voltoct.h"
+#include "pitch_lut.h"
 #include "log_taper_padded.h"
-#include "pitch_pot_lut.h"
 #include "edit_mode.h"
 #include "calibration.h"
 #include "bank.h"
 #include "button_knob_combo.h"
 #include "system_mode.h"
+#include "audio_codec.h"
+#include "event_queue.h"
+#include "profiler.h"
 
 
-#define MAX_FIR_LPF_SIZE 80
-uint32_t FIR_LPF_SIZE[NUM_CV_ADCS];
+//CV FIR LPF window sizes are powers of two: 1<<FIR_LPF_BITS[]
+#define MAX_FIR_LPF_BITS 6
+#define MAX_FIR_LPF_SIZE (1<<MAX_FIR_LPF_BITS)
+uint8_t FIR_LPF_BITS[NUM_CV_ADCS/2];
+
+//Block-rate pitch CV (see update_pitch_cv()): LPF coefficient is 1/(1<<PITCH_CV_LPF_SHIFT), hysteresis is in ADC units
+#define PITCH_CV_LPF_SHIFT 2
+#define PITCH_CV_HYST 2
 
 
 extern uint8_t PCB_version;
 
-//CV LPFs
-CCMDATA int32_t 	fir_lpf		[NUM_CV_ADCS][MAX_FIR_LPF_SIZE];
-uint32_t 			fir_lpf_i	[NUM_CV_ADCS];
+//CV LPFs: moving sum over the last 1<<FIR_LPF_BITS values.
+//The two channels of a pair (PITCH1_CV/PITCH2_CV, START1_CV/START2_CV...) share a window size,
+//so their history is stored packed, one int16_t per channel (low half = channel 1)
+CCMDATA uint32_t 	fir_lpf		[NUM_CV_ADCS/2][MAX_FIR_LPF_SIZE];
+uint32_t 			fir_lpf_i	[NUM_CV_ADCS/2];
+int32_t 			fir_lpf_sum	[NUM_CV_ADCS];
 
 
-extern const float	pitch_pot_lut[4096];
-extern const float 	voltoct[4096];
 
 
 extern enum PlayStates play_state[NUM_PLAY_CHAN];
@@ -60,7 +69,8 @@ uint8_t 		flags[NUM_FLAGS]; //FixMe: is it OK to use 32-bit flags?
 uint32_t 		flags32[NUM_FLAGS];
 
 
-uint32_t play_trig_timestamp[2];
+uint32_t play_trig_timestamp[NUM_PLAY_CHAN];
+extern uint8_t force_file_reload[NUM_PLAY_CHAN];
 
 uint8_t pot_changed[NUM_POT_ADCS];
 
@@ -73,20 +83,30 @@ volatile uint32_t 			sys_tmr;
 
 extern ButtonKnobCombo g_button_knob_combo[NUM_BUTTON_KNOB_COMBO_BUTTONS][NUM_BUTTON_KNOB_COMBO_KNOBS];
 
-//jack/pot LPF coefficients:
-float POT_LPF_COEF[NUM_POT_ADCS];
-float RAWCV_LPF_COEF[NUM_CV_ADCS];
+//pot LPF coefficients: the fraction of the way the smoothed value moves towards the new value each update (Q16)
+int32_t POT_LPF_COEF[NUM_POT_ADCS];
 
 //jack/pot LPF bracketing amounts:
 int32_t POT_BRACKET[NUM_POT_ADCS];
 int32_t CV_BRACKET[NUM_CV_ADCS];
 
 // Latched 1voct values
-uint32_t voct_latch_value[2];
+uint32_t voct_latch_value[NUM_PLAY_CHAN];
+
+//Pitch from the PITCH pot in octaves, which update_pitch_cv() adds to the pitch CV
+float pitch_pot_octaves[NUM_PLAY_CHAN];
+
+//Pitch at the start of the current audio block: the resampler ramps from this to f_param[chan][PITCH]
+float block_start_pitch[NUM_PLAY_CHAN];
+
+//Block-rate pitch CV: LPF (Q16), the value after hysteresis, and the value that's played (after snapping to 0V).
+//A play trigger latches pitch_cv_now[], so a latched note plays the same as the CV does unlatched
+int32_t pitch_cv_fast[NUM_PLAY_CHAN];
+int32_t pitch_cv_held[NUM_PLAY_CHAN];
+volatile int32_t pitch_cv_now[NUM_PLAY_CHAN];
 
-//Low Pass filtered adc values:
-float smoothed_potadc[NUM_POT_ADCS];
-float smoothed_cvadc[NUM_CV_ADCS];
+//Low Pass filtered pot values (Q16):
+int32_t smoothed_potadc[NUM_POT_ADCS];
 
 //Integer-ized LowPassFiltered adc values:
 int16_t i_smoothed_potadc[NUM_POT_ADCS];
@@ -121,6 +141,12 @@ void init_params(void)
 		i_param[chan][SAMPLE] 	= 0;
 		i_param[chan][REV] 		= 0;
 		i_param[chan][LOOPING]	 =0;
+
+		pitch_pot_octaves[chan]	= 0.0;
+		block_start_pitch[chan]	= 1.0;
+		pitch_cv_fast[chan]		= 2048 << 16;
+		pitch_cv_held[chan]		= 2048;
+		pitch_cv_now[chan]		= 2048;
 	}
 
 	i_param[REC][BANK] = 0;
@@ -155,20 +181,6 @@ void init_LowPassCoefs(void)
 	float t;
 	uint8_t i;
 
-	t=300.0;
-
-	RAWCV_LPF_COEF[PITCH1_CV] = 1.0-(1.0/t);
-	RAWCV_LPF_COEF[PITCH2_CV] = 1.0-(1.0/t);
-
-	RAWCV_LPF_COEF[START1_CV] = 1.0-(1.0/t);
-	RAWCV_LPF_COEF[START2_CV] = 1.0-(1.0/t);
-
-	RAWCV_LPF_COEF[LENGTH1_CV] = 1.0-(1.0/t);
-	RAWCV_LPF_COEF[LENGTH2_CV] = 1.0-(1.0/t);
-
-	RAWCV_LPF_COEF[SAMPLE1_CV] = 1.0-(1.0/t);
-	RAWCV_LPF_COEF[SAMPLE2_CV] = 1.0-(1.0/t);
-
 	CV_BRACKET[PITCH1_CV] = 5;
 	CV_BRACKET[PITCH2_CV] = 5;
 
@@ -183,22 +195,22 @@ void init_LowPassCoefs(void)
 
 	t=20.0; //50.0 = about 100ms to turn a knob fully
 
-	POT_LPF_COEF[PITCH1_POT] = 1.0-(1.0/t);
-	POT_LPF_COEF[PITCH2_POT] = 1.0-(1.0/t);
+	POT_LPF_COEF[PITCH1_POT] = (int32_t)(65536.0/t);
+	POT_LPF_COEF[PITCH2_POT] = (int32_t)(65536.0/t);
 
 	t=50.0;
 
-	POT_LPF_COEF[START1_POT] = 1.0-(1.0/t);
-	POT_LPF_COEF[START2_POT] = 1.0-(1.0/t);
+	POT_LPF_COEF[START1_POT] = (int32_t)(65536.0/t);
+	POT_LPF_COEF[START2_POT] = (int32_t)(65536.0/t);
 
-	POT_LPF_COEF[LENGTH1_POT] = 1.0-(1.0/t);
-	POT_LPF_COEF[LENGTH2_POT] = 1.0-(1.0/t);
+	POT_LPF_COEF[LENGTH1_POT] = (int32_t)(65536.0/t);
+	POT_LPF_COEF[LENGTH2_POT] = (int32_t)(65536.0/t);
 
 
-	POT_LPF_COEF[SAMPLE1_POT] = 1.0-(1.0/t);
-	POT_LPF_COEF[SAMPLE2_POT] = 1.0-(1.0/t);
+	POT_LPF_COEF[SAMPLE1_POT] = (int32_t)(65536.0/t);
+	POT_LPF_COEF[SAMPLE2_POT] = (int32_t)(65536.0/t);
 
-	POT_LPF_COEF[RECSAMPLE_POT] = 1.0-(1.0/t);
+	POT_LPF_COEF[RECSAMPLE_POT] = (int32_t)(65536.0/t);
 
 
 
@@ -225,95 +237,97 @@ void init_LowPassCoefs(void)
 	}
 	for (i=0;i<NUM_CV_ADCS;i++)
 	{
-		smoothed_cvadc[i]		=0;
 		bracketed_cvadc[i]	=0;
 		i_smoothed_cvadc[i]		=0x7FFF;
 		i_smoothed_rawcvadc[i]	=0x7FFF;
 		cv_delta[i]				=0;
 	}
 
-	//Set FIR LPF buffer sizes
+	//Set FIR LPF window sizes (1<<bits) for each pair of CVs
 	if (PCB_version == 0)
-	{
-		FIR_LPF_SIZE[PITCH1_CV] = 80;
-		FIR_LPF_SIZE[PITCH2_CV] = 80;
-	}
+		FIR_LPF_BITS[PITCH1_CV/2] = 6; //64
 	else
-	{
-		FIR_LPF_SIZE[PITCH1_CV] = 40;
-		FIR_LPF_SIZE[PITCH2_CV] = 40;
-	}
+		FIR_LPF_BITS[PITCH1_CV/2] = 5; //32
 
-	FIR_LPF_SIZE[START1_CV] = 20;
-	FIR_LPF_SIZE[START2_CV] = 20;
-	FIR_LPF_SIZE[LENGTH1_CV] = 20;
-	FIR_LPF_SIZE[LENGTH2_CV] = 20;
-	FIR_LPF_SIZE[SAMPLE1_CV] = 1;
-	FIR_LPF_SIZE[SAMPLE2_CV] = 1;
+	FIR_LPF_BITS[START1_CV/2] = 4; //16
+	FIR_LPF_BITS[LENGTH1_CV/2] = 4;
+	FIR_LPF_BITS[SAMPLE1_CV/2] = 0; //1: no filtering
 
 	//initialize FIR LPF
 
 	for (i=0;i<MAX_FIR_LPF_SIZE;i++)
 	{
 		//PITCH CVs default to value of 2048
-		fir_lpf[0][i]=2048;
-		fir_lpf[1][i]=2048;
+		fir_lpf[PITCH1_CV/2][i] = __PKHBT(2048, 2048, 16);
 
 		//Other CVs default to 0
-		fir_lpf[2][i]=0;
-		fir_lpf[3][i]=0;
-		fir_lpf[4][i]=0;
-		fir_lpf[5][i]=0;
-		fir_lpf[6][i]=0;
-		fir_lpf[7][i]=0;
-
+		fir_lpf[START1_CV/2][i] = 0;
+		fir_lpf[LENGTH1_CV/2][i] = 0;
+		fir_lpf[SAMPLE1_CV/2][i] = 0;
 	}
-	for(i=0;i<NUM_CV_ADCS;i++)
-	{
+	for(i=0;i<NUM_CV_ADCS/2;i++)
 		fir_lpf_i[i]=0;
-		smoothed_cvadc[i] = fir_lpf[i][0];
-	}
 
+	for(i=0;i<NUM_CV_ADCS;i++)
+		fir_lpf_sum[i] = 0;
+
+	fir_lpf_sum[PITCH1_CV] = 2048 << FIR_LPF_BITS[PITCH1_CV/2];
+	fir_lpf_sum[PITCH2_CV] = 2048 << FIR_LPF_BITS[PITCH1_CV/2];
 }
 
 
+//
+// Runs in the trigger jack IRQ
+//
 void process_cv_adc(void)
-{//takes about 7us to run, at -O3
-
-	uint8_t i;
-	int32_t old_val, new_val;
+{
+	uint8_t i, pair;
+	int32_t new_val[2];
+	uint32_t new_pair, old_pair, delta;
 	int32_t t;
 
-	//Do PITCH CVs first
-	//This function assumes:
-	//Channel 1's pitch cv = PITCH1_CV   = 0
-	//Channel 2's pitch cv = PITCH1_CV+1 = 1
-	for (i=0;i<NUM_CV_ADCS;i++)
+	//
+	// Linear average LPF (moving sum), two CVs at a time
+	//
+	for (pair=0;pair<NUM_CV_ADCS/2;pair++)
 	{
-		//Apply Linear average LPF:
+		i = pair*2;
 
-		//Pull out the oldest value (before overwriting it):
-		old_val = fir_lpf[i][fir_lpf_i[i]];
-
-		//Put in the new cv value (overwrite oldest value):
 		//Don't factor in the calibration offset if we're in calibration mode, or else we'll have a runaway feedback loop
 		if (global_mode[CALIBRATE])
-			new_val = cvadc_buffer[i];
+		{
+			new_val[0] = cvadc_buffer[i];
+			new_val[1] = cvadc_buffer[i+1];
+		}
 		else
-			new_val = cvadc_buffer[i] + system_calibrations->cv_calibration_offset[i];
-
-		fir_lpf[i][fir_lpf_i[i]] 	= new_val;
+		{
+			new_val[0] = cvadc_buffer[i] + system_calibrations->cv_calibration_offset[i];
+			new_val[1] = cvadc_buffer[i+1] + system_calibrations->cv_calibration_offset[i+1];
+		}
+		new_pair = __PKHBT(new_val[0], new_val[1], 16);
 
-		//Increment the index, wrapping around the whole buffer
-		if (++fir_lpf_i[i] >= FIR_LPF_SIZE[i]) fir_lpf_i[i]=0;
+		//Swap the new values in for the oldest ones
+		old_pair = fir_lpf[pair][fir_lpf_i[pair]];
+		fir_lpf[pair][fir_lpf_i[pair]] = new_pair;
+		fir_lpf_i[pair] = (fir_lpf_i[pair] + 1) & ((1 << FIR_LPF_BITS[pair]) - 1);
 
-		//Calculate the arithmetic average (FIR LPF)
-		smoothed_cvadc[i] = (float)((smoothed_cvadc[i] * FIR_LPF_SIZE[i]) - old_val + new_val) / (float)FIR_LPF_SIZE[i];
+		//new - old for both channels at once
+		delta = __SSUB16(new_pair, old_pair);
+		fir_lpf_sum[i] 		+= (int16_t)(delta & 0xFFFF);
+		fir_lpf_sum[i+1] 	+= (int32_t)delta >> 16;
+	}
 
-		//Range check and convert to integer
-		i_smoothed_cvadc[i] = (int16_t)smoothed_cvadc[i];
-		if (i_smoothed_cvadc[i] < 0) i_smoothed_cvadc[i] = 0;
-		if (i_smoothed_cvadc[i] > 4095) i_smoothed_cvadc[i] = 4095;
+	//Do PITCH CVs first
+	//This function assumes:
+	//Channel 1's pitch cv = PITCH1_CV   = 0
+	//Channel 2's pitch cv = PITCH1_CV+1 = 1
+	for (i=0;i<NUM_CV_ADCS;i++)
+	{
+		//Arithmetic average, range checked
+		t = fir_lpf_sum[i] >> FIR_LPF_BITS[i>>1];
+		if (t < 0) t = 0;
+		if (t > 4095) t = 4095;
+		i_smoothed_cvadc[i] = t;
 
 		//FixMe: rawcvadc is not needed (but test cv calibration before removing it, we may need to use a different LPF on it)
 		i_smoothed_rawcvadc[i] 	= i_smoothed_cvadc[i];
@@ -342,6 +356,134 @@ void process_cv_adc(void)
 	}
 }
 
+//
+// Pitch mappings
+// Pitches are added in octaves and converted to a ratio once, by exp2_interp().
+// The curves and the 2^x table are in pitch_lut.h, generated by calcs/voltoct
+//
+
+//2^x: the whole octaves go straight into the float's exponent, and the fraction is interpolated from exp2_lut[]
+static inline float exp2_interp(float x)
+{
+	int32_t oct;
+	uint32_t i;
+	float idx, frac;
+	union {float f; uint32_t u;} octave_mult;
+
+	oct = (int32_t)x;
+	if ((float)oct > x) oct--;
+
+	idx = (x - (float)oct) * (float)EXP2_LUT_SIZE;
+	i = (uint32_t)idx;
+	frac = idx - (float)i;
+
+	octave_mult.u = (uint32_t)(oct + 127) << 23;
+
+	return (exp2_lut[i] + (exp2_lut[i+1] - exp2_lut[i]) * frac) * octave_mult.f;
+}
+
+//PITCH pot position (0..4095) to octaves
+static float calc_pitch_pot_octaves(int32_t potadc)
+{
+	uint8_t i;
+
+	for (i=1; i<(NUM_PITCH_POT_POINTS-1); i++)
+		if (potadc <= pitch_pot_adc[i]) break;
+
+	return pitch_pot_oct[i-1] + (pitch_pot_oct[i] - pitch_pot_oct[i-1]) * (float)(potadc - pitch_pot_adc[i-1]) / (float)(pitch_pot_adc[i] - pitch_pot_adc[i-1]);
+}
+
+//
+// 1V/oct CV (0..4095) quantized to semitones above the center (0V)
+// Each semitone starts half a semitone below its note, so a slightly flat CV still plays the note
+//
+#define SEMITONE_ADC_WIDTH (VOLTOCT_ADC_PER_OCTAVE/12)
+
+static int32_t quantize_semitones(uint32_t adcval)
+{
+	int32_t oct, root_adc, d, semitone;
+
+	//Below the lowest octave
+	if ((int32_t)adcval > VOLTOCT_CENTER_ADC + VOLTOCT_ADC_PER_OCTAVE*5) return -6*12;
+
+	//Octave whose root is at or above adcval (floor division), up to +5
+	d = VOLTOCT_CENTER_ADC - (int32_t)adcval;
+	if (d >= 0)	oct = d / VOLTOCT_ADC_PER_OCTAVE;
+	else		oct = -((-d + VOLTOCT_ADC_PER_OCTAVE - 1) / VOLTOCT_ADC_PER_OCTAVE);
+	if (oct > 5) oct = 5;
+
+	root_adc = VOLTOCT_CENTER_ADC - VOLTOCT_ADC_PER_OCTAVE*oct;
+
+	//Semitone, counting down in ADC value from half a semitone below the root
+	d = root_adc - SEMITONE_ADC_WIDTH/2 - (int32_t)adcval;
+	if (d < 0) 	semitone = 0;
+	else
+	{
+		semitone = d / SEMITONE_ADC_WIDTH + 1;
+		if (semitone > 12) semitone = 12;
+	}
+
+	return oct*12 + semitone;
+}
+
+//
+// Called from the audio IRQ at the start of every block:
+// reads the latest pitch CV from the ADC DMA buffer, and sets f_param[chan][PITCH] from it and the PITCH pot.
+// block_start_pitch[] is set to the pitch of the previous block, so the resampler can ramp between them.
+//
+// The CV is smoothed with a short LPF (PITCH_CV_LPF_SHIFT), and has a small hysteresis (PITCH_CV_HYST) so it's steady at rest.
+// The heavier FIR in process_cv_adc() is still used for the other CVs and for calibration
+//
+void update_pitch_cv(void)
+{
+	uint8_t chan;
+	int32_t cv, t;
+	uint32_t compensated_pitch_cv;
+	float pitch;
+
+	for (chan=0;chan<NUM_PLAY_CHAN;chan++)
+	{
+		block_start_pitch[chan] = f_param[chan][PITCH];
+
+		//The pitch doesn't follow the CV in calibration or system mode
+		if (global_mode[CALIBRATE] || global_mode[SYSTEM_MODE]) continue;
+
+		cv = cvadc_buffer[PITCH1_CV+chan] + system_calibrations->cv_calibration_offset[PITCH1_CV+chan];
+		pitch_cv_fast[chan] += ((cv * 65536) - pitch_cv_fast[chan]) >> PITCH_CV_LPF_SHIFT;
+
+		cv = (pitch_cv_fast[chan] + 0x8000) >> 16;
+		if (cv < 0) cv = 0;
+		if (cv > 4095) cv = 4095;
+
+		t = cv - pitch_cv_held[chan];
+		if (t > PITCH_CV_HYST)			pitch_cv_held[chan] = cv - PITCH_CV_HYST;
+		else if (t < -PITCH_CV_HYST)	pitch_cv_held[chan] = cv + PITCH_CV_HYST;
+
+		//Snap to 0V
+		if (pitch_cv_held[chan] >= (2048-3) && pitch_cv_held[chan] <= (2048+3))
+			cv = 2048;
+		else
+			cv = pitch_cv_held[chan];
+
+		pitch_cv_now[chan] = cv;
+
+		if (flags[LatchVoltOctCV1+chan])
+			cv = voct_latch_value[chan];
+
+		compensated_pitch_cv = apply_tracking_compensation(cv, system_calibrations->tracking_comp[chan]);
+
+		if (global_mode[QUANTIZE_CH1+chan]) 
+			pitch = exp2_interp(pitch_pot_octaves[chan] + (float)quantize_semitones(compensated_pitch_cv) * (1.0f/12.0f));
+		else
+			pitch = exp2_interp(pitch_pot_octaves[chan] + (float)(VOLTOCT_CENTER_ADC - (int32_t)compensated_pitch_cv) * (1.0f/VOLTOCT_ADC_PER_OCTAVE));
+
+		if (pitch > MAX_RS)
+			pitch = MAX_RS;
+
+		f_param[chan][PITCH] = pitch;
+	}
+}
+
 void process_pot_adc(void)
 {
 	uint8_t i;
@@ -356,8 +498,9 @@ void process_pot_adc(void)
 	{
 		pot_changed[i]=0;
 
-		smoothed_potadc[i] = LowPassSmoothingFilter(smoothed_potadc[i], (float)potadc_buffer[i], POT_LPF_COEF[i]);
-		i_smoothed_potadc[i] = (int16_t)smoothed_potadc[i];
+		//One-pole LPF in Q16
+		smoothed_potadc[i] += (int32_t)(((int64_t)(((int32_t)potadc_buffer[i] << 16) - smoothed_potadc[i]) * POT_LPF_COEF[i]) >> 16);
+		i_smoothed_potadc[i] = (smoothed_potadc[i] + 0x8000) >> 16;
 
 		t=i_smoothed_potadc[i] - bracketed_potadc[i];
 		if ((t>POT_BRACKET[i]) || (t<-POT_BRACKET[i]))
@@ -410,80 +553,6 @@ uint32_t apply_tracking_compensation(int32_t cv_adcval, float cal_amt)
 
 
 
-//
-// Returns a semitone-quantized tuning amount, given an ADC value
-//
-#define TWELFTH_ROOT_TWO 1.059463094
-#define SEMITONE_ADC_WIDTH 34.0
-#define OCTAVE_ADC_WIDTH (SEMITONE_ADC_WIDTH*12.0)
-
-float quantized_semitone_voct(uint32_t adcval)
-{
-	int8_t oct;
-	int8_t semitone;
-	int32_t root_adc;
-	int32_t root_adc_midpt;
-
-	uint8_t oct_mult;
-	float semitone_mult;
-
-	float octave_mult;
-
-	//every 405 adc values ocs an octtave
-	//2048-(405*oct) ---> 2^oct, oct: 0..5 ---> 1..32
-	//2048+(405*oct) ---> 1/(2^oct), oct: 0..5 --> 1..1/32
-
-	if (adcval==2048) return(1.0);
-
-//	if (adcval<2048)
-	if (0)
-	{
-		//First, set oct_mult
-		//oct_mult should be 32, 16, 8, 4, 2, or 1 to indicate the root note of the octave we're in
-		oct_mult=32; //start by testing the +5 octave
-		for (oct=5;oct>=0;oct--)
-		{
-			root_adc = 2048-(OCTAVE_ADC_WIDTH*oct);
-			if (adcval<=root_adc) break; //exit for loop
-			oct_mult>>=1; //drop down an octave
-		}
-
-		root_adc_midpt = root_adc - (SEMITONE_ADC_WIDTH/2.0);
-		semitone_mult=1.0;
-		for (semitone=0;semitone<12;semitone++)
-		{
-			if (adcval>(root_adc_midpt-(int32_t)(SEMITONE_ADC_WIDTH*(float)semitone))) break; //exit for loop
-			semitone_mult*=TWELFTH_ROOT_TWO;
-		}
-
-		return ((float)oct_mult * semitone_mult);
-	}
-	else
-	{
-		//First, set oct_mult
-		//oct_mult should be 32, 16, 8, 4, 2, 1, 0.5, 0.25, 0.125, 0.0625, 0.03125 to indicate the root note of the octave we're in
-		octave_mult=32.0; 
-		for (oct=5;oct>=-5;oct--)
-		{
-			root_adc = 2048-(OCTAVE_ADC_WIDTH*oct);
-			if (adcval<=root_adc) break; //exit for loop
-			octave_mult = octave_mult/2; //drop down an octave
-		}
-
-		root_adc_midpt = root_adc - (SEMITONE_ADC_WIDTH/2.0);
-		semitone_mult=1.0;
-		for (semitone=0;semitone<12;semitone++)
-		{
-			if (adcval>(root_adc_midpt-(int32_t)(SEMITONE_ADC_WIDTH*(float)semitone))) break; //exit for loop
-			semitone_mult*=TWELFTH_ROOT_TWO;
-		}
-
-		return (octave_mult * semitone_mult);
-	}
-
-}
-
-
 void update_params(void)
 {
 	uint8_t chan;
@@ -494,11 +563,9 @@ void update_params(void)
 	int32_t t_pitch_potadc;
 	float t_f;
 	uint16_t sample_pot;
-	int16_t pitch_cv;
 
 	uint32_t trial_bank;
 	uint8_t samplenum, banknum;
-	uint32_t compensated_pitch_cv;
 
 	ButtonKnobCombo *this_bank_bkc; //pointer to the currently active button/knob combo action
 	ButtonKnobCombo *other_bank_bkc; //pointer to the other channel's button/knob combo action
@@ -529,7 +596,7 @@ void update_params(void)
 			f_param[0][LENGTH] = 0.201f;
 			i_param[0][LOOPING] = 1;
 			i_param[0][REV] = 0;
-			if (play_state[0] == SILENT) flags[Play1Trig] = 1;
+			if (play_state[0] == SILENT) post_event(EV_PLAY_TRIG, 0);
 		}
 		
 
@@ -545,7 +612,7 @@ void update_params(void)
 			f_param[0][LENGTH] = 0.201f;
 			i_param[0][LOOPING] = 1;
 			i_param[0][REV] = 0;
-			if (play_state[0] == SILENT) flags[Play1Trig] = 1;
+			if (play_state[0] == SILENT) post_event(EV_PLAY_TRIG, 0);
 		}
 
 
@@ -662,30 +729,15 @@ void update_params(void)
 
 
 		//
-		// PITCH POT + CV
+		// PITCH POT
+		// (the pitch CV is read every audio block, by update_pitch_cv())
 		//
 
 		t_pitch_potadc = bracketed_potadc[PITCH1_POT+chan] + system_calibrations->pitch_pot_detent_offset[chan];
 		if (t_pitch_potadc > 4095) t_pitch_potadc = 4095;
 		if (t_pitch_potadc < 0) t_pitch_potadc = 0;
 
-		if(flags[LatchVoltOctCV1+chan]) 	pitch_cv = voct_latch_value[chan];
-		else								pitch_cv = bracketed_cvadc[PITCH1_CV+chan];
-
-		if (global_mode[QUANTIZE_CH1+chan]) 
-		{
-			compensated_pitch_cv = apply_tracking_compensation(pitch_cv, system_calibrations->tracking_comp[chan]);
-			f_param[chan][PITCH] = pitch_pot_lut[t_pitch_potadc] * quantized_semitone_voct(compensated_pitch_cv);
-		}
-		else
-		{
-			compensated_pitch_cv = apply_tracking_compensation(pitch_cv, system_calibrations->tracking_comp[chan]);
-			f_param[chan][PITCH] = pitch_pot_lut[t_pitch_potadc] * voltoct[compensated_pitch_cv];
-
-		}
-
-		if (f_param[chan][PITCH] > MAX_RS)
-		    f_param[chan][PITCH] = MAX_RS;
+		pitch_pot_octaves[chan] = calc_pitch_pot_octaves(t_pitch_potadc);
 
 
 
@@ -975,140 +1027,110 @@ void update_params(void)
 		}
 	}
 
+	//Re-calculate the stop points, now that LENGTH and PITCH are updated
+	for (chan=0;chan<NUM_PLAY_CHAN;chan++)
+		update_play_bounds(chan);
 
 }
 
 
-//
-// Handle all flags to change modes
-//
-void process_mode_flags(void)
+static void toggle_monitor(void)
 {
-
-	if (flags[Rev1Trig])
+	if (global_mode[ENABLE_RECORDING] && global_mode[MONITOR_RECORDING] != MONITOR_OFF)
 	{
-		flags[Rev1Trig]=0;
-		toggle_reverse(0);
+		global_mode[ENABLE_RECORDING] 	= 0;
+		global_mode[MONITOR_RECORDING] 	= MONITOR_OFF;
+		stop_recording();
 	}
-	if (flags[Rev2Trig])
+	else
 	{
-		flags[Rev2Trig]=0;
-		toggle_reverse(1);
+		global_mode[ENABLE_RECORDING] = 1;
+		global_mode[MONITOR_RECORDING] = MONITOR_BOTH; //monitor channel 1 and 2
+		i_param[0][LOOPING] = 0;
+		i_param[1][LOOPING] = 0;
 	}
+}
 
-	if (flags[Play1But])
+static void toggle_looping(uint8_t chan)
+{
+	if (i_param[chan][LOOPING])
 	{
-		flags[Play1But]=0;
-		toggle_playing(0);
+		i_param[chan][LOOPING] = 0;
 	}
-	if (flags[Play2But])
+	else
 	{
-		flags[Play2But]=0;
-		toggle_playing(1);
+		i_param[chan][LOOPING] = 1;
+		if (play_state[chan] == SILENT) 
+			post_event(EV_PLAY_BUT, chan);
 	}
+}
 
-	if (flags[Play1TrigDelaying])
-	{
-		if ((sys_tmr - play_trig_timestamp[0]) > global_params.play_trig_latch_pitch_time)
-			flags[LatchVoltOctCV1] = 0;
-		else
-			flags[LatchVoltOctCV1] = 1;
-
-		if ((sys_tmr - play_trig_timestamp[0]) > global_params.play_trig_delay) 
-		{
-			flags[Play1Trig] 			= 1;
-			flags[Play1TrigDelaying]	= 0;
-			flags[LatchVoltOctCV1] 		= 0;		
-		}
-	}
-	if (flags[Play1Trig])
+static void handle_event(Event *e)
+{
+	switch (e->type)
 	{
-		start_playing(0);
-		flags[Play1Trig]	= 0;
-	}
+		case EV_PLAY_BUT:
+			toggle_playing(e->chan);
+			break;
 
+		case EV_PLAY_TRIG:
+			start_playing(e->chan);
+			flags[LatchVoltOctCV1 + e->chan] = 0;
+			break;
 
+		case EV_REV_TRIG:
+			toggle_reverse(e->chan);
+			break;
 
-	if (flags[Play2TrigDelaying])
-	{
-		if ((sys_tmr - play_trig_timestamp[0]) > global_params.play_trig_latch_pitch_time)
-			flags[LatchVoltOctCV2] = 0;
-		else
-			flags[LatchVoltOctCV2] = 1;
+		case EV_REC_TRIG:
+			toggle_recording();
+			break;
 
-		if ((sys_tmr - play_trig_timestamp[1]) > global_params.play_trig_delay)
-		{
-			flags[Play2Trig] 			= 1;
-			flags[Play2TrigDelaying]	= 0;
-			flags[LatchVoltOctCV2]		= 0;
-			// DEBUG3_OFF;
-		}
-	}
-	if (flags[Play2Trig])
-	{
-		// DEBUG3_OFF;
-		start_playing(1);
-		flags[Play2Trig]	 = 0;
-		flags[LatchVoltOctCV2] = 0;		
-	}
+		case EV_TOGGLE_MONITOR:
+			toggle_monitor();
+			break;
 
-	if (flags[RecTrig]==1)
-	{
-		flags[RecTrig]=0;
-		toggle_recording();
-	}
+		case EV_TOGGLE_LOOPING:
+			toggle_looping(e->chan);
+			break;
 
-	if (flags[ToggleMonitor])
-	{
-		flags[ToggleMonitor] = 0;
+		case EV_FORCE_RELOAD:
+			force_file_reload[e->chan] = 1;
+			break;
 
-		if (global_mode[ENABLE_RECORDING] && global_mode[MONITOR_RECORDING] != MONITOR_OFF)
-		{
-			global_mode[ENABLE_RECORDING] 	= 0;
-			global_mode[MONITOR_RECORDING] 	= MONITOR_OFF;
-			stop_recording();
-		}
-		else
-		{
-			global_mode[ENABLE_RECORDING] = 1;
-			global_mode[MONITOR_RECORDING] = MONITOR_BOTH; //monitor channel 1 and 2
-			i_param[0][LOOPING] = 0;
-			i_param[1][LOOPING] = 0;
-		}
+		default:
+			break;
 	}
+}
 
+//
+// Handle all events and flags to change modes
+// Events are handled in the order they were posted
+//
+void process_mode_flags(void)
+{
+	Event e;
+	uint8_t chan;
 
-	if (flags[ToggleLooping1])
-	{
-		flags[ToggleLooping1] = 0;
-
-		if (i_param[0][LOOPING])
-		{
-			i_param[0][LOOPING] = 0;
-		}
-		else
-		{
-			i_param[0][LOOPING] = 1;
-			if (play_state[0] == SILENT) 
-				flags[Play1But] = 1;
-		}
-
-
-	}
+	while (get_next_event(&e))
+		handle_event(&e);
 
-	if (flags[ToggleLooping2])
+	//A play trigger starts playing after the trigger delay
+	for (chan=0; chan<NUM_PLAY_CHAN; chan++)
 	{
-		flags[ToggleLooping2] = 0;
-
-		if (i_param[1][LOOPING])
-		{
-			i_param[1][LOOPING] = 0;
-		}
-		else
+		if (flags[Play1TrigDelaying + chan])
 		{
-			i_param[1][LOOPING] = 1;
-			if (play_state[1] == SILENT) 
-				flags[Play2But] = 1;
+			if ((sys_tmr - play_trig_timestamp[chan]) > global_params.play_trig_latch_pitch_time)
+				flags[LatchVoltOctCV1 + chan] = 0;
+			else
+				flags[LatchVoltOctCV1 + chan] = 1;
+
+			if ((sys_tmr - play_trig_timestamp[chan]) > global_params.play_trig_delay) 
+			{
+				flags[Play1TrigDelaying + chan]	= 0;
+				flags[LatchVoltOctCV1 + chan] 	= 0;		
+				retrigger_playing_at(chan, play_trig_timestamp[chan] + global_params.play_trig_delay + TRIG_SYNC_LATENCY);
+			}
 		}
 	}
 }
@@ -1203,9 +1225,12 @@ void adc_param_update_IRQHandler(void)
 {
 
 	if (TIM_GetITStatus(TIM9, TIM_IT_Update) != RESET) {
+		PROFILE_START(PROF_PARAM_UPDATE);
 
 		process_pot_adc();
 
+		update_audio_mix_kernel();
+
 		if (global_mode[CALIBRATE])
 		{
 			update_calibration(1);
@@ -1220,6 +1245,7 @@ void adc_param_update_IRQHandler(void)
 		else
 			update_params();
 
+		PROFILE_END(PROF_PARAM_UPDATE);
 
 		TIM_ClearITPendingBit(TIM9, TIM_IT_Update);
 
@@ -27,6 +27,7 @@
  */
 
 #include <stm32f4xx.h>
+#include <string.h>
 #include "dig_pins.h"
 #include "pca9685_driver.h"
 #include "globals.h"
@@ -171,64 +172,165 @@ uint32_t LEDDriver_writeregister(uint8_t driverAddr, uint8_t RegisterAddr, uint8
 }
 
 
-inline uint32_t LEDDriver_startxfer(uint8_t driverAddr){
-	uint32_t result=0;
+//
+// Copy of each chip's LED registers (ON_L, ON_H, OFF_L, OFF_H for each element), and which elements changed since they were sent
+//
+static uint8_t				led_regs[LEDDRIVER_MAX_DRIVERS][LEDDRIVER_ELEMENTS * 4];
+static volatile uint16_t	led_dirty[LEDDRIVER_MAX_DRIVERS];
 
-	driverAddr = PCA9685_I2C_BASE_ADDRESS | (driverAddr << 1);
+//The burst being sent: the first register address, then the registers
+static uint8_t				led_tx_buf[1 + LEDDRIVER_ELEMENTS * 4];
+static uint16_t				led_tx_len;
 
-	/*!< While the bus is busy */
-	LEDDriverTimeout = LEDDRIVER_LONG_TIMEOUT;
-	while(I2C_GetFlagStatus(LEDDRIVER_I2C, I2C_FLAG_BUSY))
-	{
-		if((LEDDriverTimeout--) == 0)
-			return LEDDRIVER_TIMEOUT_UserCallback();
-	}
+#define LEDDRIVER_IDLE 0xFF
+static volatile uint8_t		led_tx_driver = LEDDRIVER_IDLE;
+static uint8_t				led_num_drivers = 0;
+static uint32_t				led_tx_start_tmr;
 
-	/* Start the config sequence */
-	I2C_GenerateSTART(LEDDRIVER_I2C, ENABLE);
+extern volatile uint32_t 	sys_tmr;
 
-	LEDDriverTimeout = LEDDRIVER_FLAG_TIMEOUT;
-	while (!I2C_CheckEvent(LEDDRIVER_I2C, I2C_EVENT_MASTER_MODE_SELECT))
+
+static void set_element(uint8_t driverAddr, uint8_t element, uint16_t brightness)
+{
+	uint8_t *regs = &led_regs[driverAddr][element * 4];
+
+	if (regs[2] == (brightness & 0xFF) && regs[3] == (brightness >> 8)) return;
+
+	regs[0] = 0; //on-time = 0
+	regs[1] = 0;
+	regs[2] = brightness & 0xFF; //off-time = brightness
+	regs[3] = brightness >> 8;
+
+	__disable_irq();
+	led_dirty[driverAddr] |= (1 << element);
+	__enable_irq();
+}
+
+//
+// Starts sending the changed registers of the first chip (from driverAddr up) that has any.
+// Must be called with the I2C idle, from an I2C/DMA IRQ or with interrupts disabled
+//
+static void start_next_burst(uint8_t driverAddr)
+{
+	uint16_t dirty;
+	uint8_t lo, hi;
+
+	for (; driverAddr < led_num_drivers; driverAddr++)
 	{
-		if((LEDDriverTimeout--) == 0)
-			return LEDDRIVER_TIMEOUT_UserCallback();
+		dirty = led_dirty[driverAddr];
+		if (!dirty) continue;
+
+		for (lo=0; !(dirty & (1<<lo)); lo++) {;}
+		for (hi=LEDDRIVER_ELEMENTS-1; !(dirty & (1<<hi)); hi--) {;}
+
+		led_dirty[driverAddr] = 0;
+
+		//Send every element from lo to hi in one auto-increment burst
+		led_tx_buf[0] = PCA9685_LED0 + (lo * 4);
+		memcpy(&led_tx_buf[1], &led_regs[driverAddr][lo * 4], (hi - lo + 1) * 4);
+		led_tx_len = 1 + (hi - lo + 1) * 4;
+
+		led_tx_driver = driverAddr;
+		led_tx_start_tmr = sys_tmr;
+
+		I2C_ITConfig(LEDDRIVER_I2C, I2C_IT_EVT | I2C_IT_ERR, ENABLE);
+		I2C_GenerateSTART(LEDDRIVER_I2C, ENABLE);
+		return;
 	}
 
-	/* Transmit the slave address */
-	I2C_Send7bitAddress(LEDDRIVER_I2C, driverAddr, I2C_Direction_Transmitter);
+	led_tx_driver = LEDDRIVER_IDLE;
+}
 
-	LEDDriverTimeout = LEDDRIVER_FLAG_TIMEOUT;
-	while (!I2C_CheckEvent(LEDDRIVER_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED))
+//Stops the burst in progress and marks that chip to be sent again
+static void abort_burst(void)
+{
+	I2C_ITConfig(LEDDRIVER_I2C, I2C_IT_EVT | I2C_IT_ERR, DISABLE);
+	I2C_DMACmd(LEDDRIVER_I2C, DISABLE);
+	DMA_Cmd(LEDDRIVER_DMA_STREAM, DISABLE);
+	DMA_ClearFlag(LEDDRIVER_DMA_STREAM, LEDDRIVER_DMA_FLAGS_ALL);
+
+	if (led_tx_driver < led_num_drivers)
+		led_dirty[led_tx_driver] = (1 << LEDDRIVER_ELEMENTS) - 1;
+
+	led_tx_driver = LEDDRIVER_IDLE;
+}
+
+//
+// Sends the LED registers that changed since the last update.
+// Returns right away: the bursts are sent in the background by the I2C and DMA IRQs.
+// If a burst is still being sent, the changes are sent after it
+//
+void LEDDriver_update(void)
+{
+	__disable_irq();
+
+	if (led_tx_driver == LEDDRIVER_IDLE)
+		start_next_burst(0);
+
+	else if ((sys_tmr - led_tx_start_tmr) > LEDDRIVER_STALL_TIME)
 	{
-		if((LEDDriverTimeout--) == 0)
-			return LEDDRIVER_TIMEOUT_UserCallback();
+		//The bus is stuck: reset the I2C peripheral, and send it all again next time
+		abort_burst();
+		LEDDriver_I2C_Init();
 	}
 
-	return result;
+	__enable_irq();
 }
 
-inline uint32_t LEDDriver_senddata(uint8_t data){
-	uint32_t result=0;
+void LEDDRIVER_I2C_EV_IRQHandler(void)
+{
+	uint16_t sr1;
+
+	sr1 = LEDDRIVER_I2C->SR1;
 
-	/* Transmit the data for write operation */
-	I2C_SendData(LEDDRIVER_I2C, data);
+	//Start condition sent: send the chip's address
+	if (sr1 & I2C_SR1_SB)
+		I2C_Send7bitAddress(LEDDRIVER_I2C, PCA9685_I2C_BASE_ADDRESS | (led_tx_driver << 1), I2C_Direction_Transmitter);
 
-	LEDDriverTimeout = LEDDRIVER_FLAG_TIMEOUT;
-	while (!I2C_CheckEvent(LEDDRIVER_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTING))
+	//Address acknowledged: DMA sends the registers. Reading SR2 clears ADDR and starts the transfer
+	else if (sr1 & I2C_SR1_ADDR)
 	{
-		if((LEDDriverTimeout--) == 0)
-			return LEDDRIVER_TIMEOUT_UserCallback();
+		I2C_ITConfig(LEDDRIVER_I2C, I2C_IT_EVT, DISABLE);
+
+		DMA_SetCurrDataCounter(LEDDRIVER_DMA_STREAM, led_tx_len);
+		DMA_Cmd(LEDDRIVER_DMA_STREAM, ENABLE);
+		I2C_DMACmd(LEDDRIVER_I2C, ENABLE);
+
+		(void)LEDDRIVER_I2C->SR2;
 	}
-	return result;
 
+	//Last byte is out: end this chip's burst and start the next one
+	else if (sr1 & I2C_SR1_BTF)
+	{
+		I2C_GenerateSTOP(LEDDRIVER_I2C, ENABLE);
+		I2C_ITConfig(LEDDRIVER_I2C, I2C_IT_EVT | I2C_IT_ERR, DISABLE);
+
+		start_next_burst(led_tx_driver + 1);
+	}
 }
 
-inline void LEDDriver_endxfer(void){
-	/* End the configuration sequence */
-	I2C_GenerateSTOP(LEDDRIVER_I2C, ENABLE);
+//No acknowledge, bus error or arbitration lost: give up on this burst
+void LEDDRIVER_I2C_ER_IRQHandler(void)
+{
+	LEDDRIVER_I2C->SR1 &= ~(I2C_SR1_AF | I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR);
 
+	I2C_GenerateSTOP(LEDDRIVER_I2C, ENABLE);
+	abort_burst();
 }
 
+//DMA has written the last byte: wait for it to be shifted out (BTF)
+void LEDDRIVER_DMA_IRQHandler(void)
+{
+	if (DMA_GetFlagStatus(LEDDRIVER_DMA_STREAM, LEDDRIVER_DMA_FLAG_TC) != RESET)
+	{
+		DMA_ClearFlag(LEDDRIVER_DMA_STREAM, LEDDRIVER_DMA_FLAG_TC);
+
+		I2C_DMACmd(LEDDRIVER_I2C, DISABLE);
+		DMA_Cmd(LEDDRIVER_DMA_STREAM, DISABLE);
+
+		I2C_ITConfig(LEDDRIVER_I2C, I2C_IT_EVT, ENABLE);
+	}
+}
 
 
 /*
@@ -236,97 +338,33 @@ inline void LEDDriver_endxfer(void){
  */
 void LEDDriver_set_one_LED(uint8_t led_number, uint16_t brightness) //sets one LED element
 {
-	uint8_t driverAddr;
-
 	//element_number is 0..(NUM_LEDS*3-1)
 
-	driverAddr = driverAddress[led_number];
-	led_number = driverElement[led_number];
-
-	LEDDriver_startxfer(driverAddr); //20us
-	LEDDriver_senddata(PCA9685_LED0 + (led_number*4)); //4 registers per LED element
-	LEDDriver_senddata(0); //on-time = 0
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(brightness & 0xFF); //off-time = brightness
-	LEDDriver_senddata(brightness >> 8);
-	LEDDriver_endxfer();
-
+	set_element(driverAddress[led_number], driverElement[led_number], brightness);
 }
 
 /*
  * Sets one RGB LED with a 10+10+10 bit color value
  */
 void LEDDriver_setRGBLED(uint8_t rgbled_number, uint32_t rgb){
-	uint8_t driverAddr;
-	uint8_t led_number;
 
 	uint16_t c_red= (rgb >> 20) & 0b1111111111;
 	uint16_t c_green= (rgb >> 10) & 0b1111111111;
 	uint16_t c_blue= rgb & 0b1111111111;
 
-	driverAddr = driverRGBBaseAddress[rgbled_number];
-	led_number = driverRGBBaseElement[rgbled_number];
-
-	LEDDriver_startxfer(driverAddr);
-
-	LEDDriver_senddata(PCA9685_LED0 + (led_number*4)); //4 registers per LED element
-	LEDDriver_senddata(0); //on-time = 0
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_red & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_red >> 8);
-
-	LEDDriver_senddata(0); //on-time = 0 //four senddata commands take 140us
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_green & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_green >> 8);
-
-	LEDDriver_senddata(0); //on-time = 0
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_blue & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_blue >> 8);
-
-	LEDDriver_endxfer();
-
+	LEDDriver_setRGBLED_RGB(rgbled_number, c_red, c_green, c_blue);
 }
 
 /*
  * Sets one RGB LED with a 10+10+10 bit color value, shifted to 12+12+12bit values
  */
 void LEDDriver_setRGBLED_12bit(uint8_t rgbled_number, uint32_t rgb){
-	uint8_t driverAddr;
-	uint8_t led_number;
 
 	uint16_t c_red= (rgb >> 20) & 0b1111111111;
 	uint16_t c_green= (rgb >> 10) & 0b1111111111;
 	uint16_t c_blue= rgb & 0b1111111111;
 
-	c_red *= 4;
-	c_green *= 4;
-	c_blue *= 4;
-
-	driverAddr = driverRGBBaseAddress[rgbled_number];
-	led_number = driverRGBBaseElement[rgbled_number];
-
-	LEDDriver_startxfer(driverAddr);
-
-	LEDDriver_senddata(PCA9685_LED0 + (led_number*4)); //4 registers per LED element
-	LEDDriver_senddata(0); //on-time = 0
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_red & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_red >> 8);
-
-	LEDDriver_senddata(0); //on-time = 0 //four senddata commands take 140us
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_green & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_green >> 8);
-
-	LEDDriver_senddata(0); //on-time = 0
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_blue & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_blue >> 8);
-
-	LEDDriver_endxfer();
-
+	LEDDriver_setRGBLED_RGB(rgbled_number, c_red*4, c_green*4, c_blue*4);
 }
 
 void LEDDriver_setRGBLED_RGB(uint8_t rgbled_number, int16_t c_red, int16_t c_green, int16_t c_blue)
@@ -334,31 +372,12 @@ void LEDDriver_setRGBLED_RGB(uint8_t rgbled_number, int16_t c_red, int16_t c_gre
 	uint8_t driverAddr;
 	uint8_t led_number;
 
-
 	driverAddr = driverRGBBaseAddress[rgbled_number];
 	led_number = driverRGBBaseElement[rgbled_number];
 
-	LEDDriver_startxfer(driverAddr);
-
-	LEDDriver_senddata(PCA9685_LED0 + (led_number*4)); //4 registers per LED element
-	LEDDriver_senddata(0); //on-time = 0
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_red & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_red >> 8);
-
-	LEDDriver_senddata(0); //on-time = 0 //four senddata commands take 140us
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_green & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_green >> 8);
-
-	LEDDriver_senddata(0); //on-time = 0
-	LEDDriver_senddata(0);
-	LEDDriver_senddata(c_blue & 0xFF); //off-time = brightness
-	LEDDriver_senddata(c_blue >> 8);
-
-	LEDDriver_endxfer();
-
-
+	set_element(driverAddr, led_number, c_red);
+	set_element(driverAddr, led_number+1, c_green);
+	set_element(driverAddr, led_number+2, c_blue);
 }
 
 void LEDDriver_Reset(uint8_t driverAddr){
@@ -382,6 +401,48 @@ void LEDDriver_Reset(uint8_t driverAddr){
 
 }
 
+void LEDDriver_DMA_Init(void)
+{
+	DMA_InitTypeDef DMA_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+
+	RCC_AHB1PeriphClockCmd(LEDDRIVER_DMA_CLK, ENABLE);
+
+	DMA_DeInit(LEDDRIVER_DMA_STREAM);
+	DMA_InitStructure.DMA_Channel = LEDDRIVER_DMA_CHANNEL;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&(LEDDRIVER_I2C->DR);
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)led_tx_buf;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	DMA_InitStructure.DMA_BufferSize = 1; //set for each burst
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+	DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+	DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+	DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+	DMA_Init(LEDDRIVER_DMA_STREAM, &DMA_InitStructure);
+
+	DMA_ITConfig(LEDDRIVER_DMA_STREAM, DMA_IT_TC, ENABLE);
+
+	//Same pre-emption priority as the Button LED IRQ, so it can't be interrupted in the middle of setting LEDs
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 3;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+
+	NVIC_InitStructure.NVIC_IRQChannel = LEDDRIVER_DMA_IRQ;
+	NVIC_Init(&NVIC_InitStructure);
+
+	NVIC_InitStructure.NVIC_IRQChannel = LEDDRIVER_I2C_EV_IRQ;
+	NVIC_Init(&NVIC_InitStructure);
+
+	NVIC_InitStructure.NVIC_IRQChannel = LEDDRIVER_I2C_ER_IRQ;
+	NVIC_Init(&NVIC_InitStructure);
+}
+
 void LEDDriver_Init(uint8_t numdrivers){
 
 	uint8_t i;
@@ -396,6 +457,11 @@ void LEDDriver_Init(uint8_t numdrivers){
 		LEDDriver_Reset(i);
 	}
 
+	if (numdrivers > LEDDRIVER_MAX_DRIVERS) numdrivers = LEDDRIVER_MAX_DRIVERS;
+	led_num_drivers = numdrivers;
+
+	//Updates are sent with DMA after the chips are set up
+	LEDDriver_DMA_Init();
 }
 
 
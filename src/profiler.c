@@ -0,0 +1,216 @@
+/*
+ * profiler.c
+ *
+ * CPU load profiler (see profiler.h)
+ *
+ * Each interrupt handler and main loop task that has PROFILE_START()/PROFILE_END() hooks records
+ * the number of cycles of each call: count, min, average, max and a histogram (so the worst cases can be seen, not just the average).
+ *
+ * The stats are sent once a second on ITM port PROFILE_ITM_PORT (see profile_poll() for the format),
+ * and can be written to PROFILE_FILE in the system directory from System Mode (Rec Bank button)
+ *
+ */
+
+#include "globals.h"
+#include "ff.h"
+#include "sts_filesystem.h"
+#include "str_util.h"
+#include "ITM.h"
+#include "profiler.h"
+#include "event_queue.h"
+#include "boot_trace.h"
+#include "sdcard_speed.h"
+#include "stm32f4_discovery_sdio_sd.h"
+
+extern volatile uint32_t 	sys_tmr;
+extern SdCardSpeed 			sdcard_speed;
+
+static ProfileStats 		profile_stats[NUM_PROFILE_POINTS];
+static uint32_t 			profile_reset_tmr;
+
+static const char *profile_names[NUM_PROFILE_POINTS] = {
+	"Audio block",
+	"Param update IRQ",
+	"Trig debounce IRQ",
+	"Button LED IRQ",
+	"LED PWM IRQ",
+	"Read storage",
+	"Write storage",
+	"Index write step",
+};
+
+void profile_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	profile_reset();
+}
+
+void profile_reset(void)
+{
+	uint8_t p, i;
+
+	__disable_irq();
+	for (p=0; p<NUM_PROFILE_POINTS; p++)
+	{
+		profile_stats[p].count 	= 0;
+		profile_stats[p].min 	= 0xFFFFFFFF;
+		profile_stats[p].max 	= 0;
+		profile_stats[p].total 	= 0;
+		for (i=0; i<PROFILE_HIST_BINS; i++)
+			profile_stats[p].hist[i] = 0;
+	}
+	profile_reset_tmr = sys_tmr;
+	__enable_irq();
+}
+
+void profile_record(enum ProfilePoints p, uint32_t cycles)
+{
+	ProfileStats *s = &profile_stats[p];
+	uint32_t bin;
+
+	s->count++;
+	s->total += cycles;
+	if (cycles < s->min) s->min = cycles;
+	if (cycles > s->max) s->max = cycles;
+
+	if (cycles >> (PROFILE_HIST_MIN_BITS + 1))
+	{
+		bin = 31 - __CLZ(cycles) - PROFILE_HIST_MIN_BITS;
+		if (bin >= PROFILE_HIST_BINS) bin = PROFILE_HIST_BINS - 1;
+	}
+	else
+		bin = 0;
+
+	s->hist[bin]++;
+}
+
+//Copies one point's stats, so an interrupt doesn't change them half-way through
+static void get_profile_stats(enum ProfilePoints p, ProfileStats *s)
+{
+	__disable_irq();
+	*s = profile_stats[p];
+	__enable_irq();
+}
+
+//CPU time used by a point since the stats were reset, in 1/1000ths
+static uint32_t calc_load_permille(ProfileStats *s)
+{
+	uint64_t elapsed_cycles;
+
+	elapsed_cycles = (uint64_t)(sys_tmr - profile_reset_tmr) * (SystemCoreClock / BASE_SAMPLE_RATE);
+	if (!elapsed_cycles) return 0;
+
+	return (s->total * 1000) / elapsed_cycles;
+}
+
+//
+// Once a second, sends each point's stats on ITM port PROFILE_ITM_PORT:
+// 0x50524F00 + point number, count, min, average, max (cycles), load (1/1000ths of the CPU), then the PROFILE_HIST_BINS histogram bins.
+// Then 0x45565400, the longest time an event waited in its queue (sys_tmr ticks), and the number of events lost
+//
+void profile_poll(void)
+{
+	static uint32_t last_send_tmr = 0;
+	ProfileStats s;
+	uint8_t p, i;
+
+	if ((sys_tmr - last_send_tmr) < BASE_SAMPLE_RATE) return;
+	last_send_tmr = sys_tmr;
+
+	for (p=0; p<NUM_PROFILE_POINTS; p++)
+	{
+		get_profile_stats(p, &s);
+
+		ITM_SendValue(PROFILE_ITM_PORT, 0x50524F00 | p);
+		ITM_SendValue(PROFILE_ITM_PORT, s.count);
+		ITM_SendValue(PROFILE_ITM_PORT, s.count ? s.min : 0);
+		ITM_SendValue(PROFILE_ITM_PORT, s.count ? (uint32_t)(s.total / s.count) : 0);
+		ITM_SendValue(PROFILE_ITM_PORT, s.max);
+		ITM_SendValue(PROFILE_ITM_PORT, calc_load_permille(&s));
+
+		for (i=0; i<PROFILE_HIST_BINS; i++)
+			ITM_SendValue(PROFILE_ITM_PORT, s.hist[i]);
+	}
+
+	ITM_SendValue(PROFILE_ITM_PORT, 0x45565400);
+	ITM_SendValue(PROFILE_ITM_PORT, event_max_latency());
+	ITM_SendValue(PROFILE_ITM_PORT, events_lost());
+}
+
+
+//
+// Writing the stats to PROFILE_FILE: a background job, one point per step
+//
+static FIL		profile_file;
+static uint8_t	profile_write_step;
+static FRESULT	profile_write_res;
+
+#define PROFILE_STEP_OPEN	0xFF
+
+void write_profile_begin(void)
+{
+	profile_write_step 	= PROFILE_STEP_OPEN;
+	profile_write_res 	= FR_OK;
+}
+
+//Returns 1 when the file is closed (or failed)
+uint8_t write_profile_step(void)
+{
+	char		filepath[_MAX_LFN];
+	ProfileStats s;
+	uint8_t 	i;
+
+	if (profile_write_step == PROFILE_STEP_OPEN)
+	{
+		profile_write_res = check_sys_dir();
+		if (profile_write_res!=FR_OK) return(1);
+
+		str_cat(filepath, SYS_DIR_SLASH, PROFILE_FILE);
+		profile_write_res = f_open(&profile_file, filepath, FA_CREATE_ALWAYS | FA_WRITE);
+		if (profile_write_res!=FR_OK) return(1);
+
+		f_printf(&profile_file, "## CPU profile: cycles per call, since boot\n");
+		f_printf(&profile_file, "## Core clock: %lu Hz. Audio block: %lu cycles\n", SystemCoreClock, SystemCoreClock / (BASE_SAMPLE_RATE / HT16_CHAN_BUFF_LEN));
+		f_printf(&profile_file, "## Load is the share of CPU time, in 1/1000ths. Times include higher-priority interrupts\n");
+		f_printf(&profile_file, "## Histogram bin n counts calls of %u * 2^n cycles or more (less than twice that)\n\n", 1 << PROFILE_HIST_MIN_BITS);
+
+		profile_write_step = 0;
+		return(0);
+	}
+
+	if (profile_write_step >= NUM_PROFILE_POINTS)
+	{
+		f_printf(&profile_file, "[Event queues]\nmax latency %lu frames, lost %lu\n\n", event_max_latency(), events_lost());
+
+		f_printf(&profile_file, "[Boot] (us)\n");
+		for (i=0; i<NUM_BOOT_PHASES; i++)
+			f_printf(&profile_file, "%s: %lu\n", boot_phase_name(i), boot_phase_us(i));
+
+		f_printf(&profile_file, "\n[SD Card]\n");
+		f_printf(&profile_file, "bus %s, CRC errors %lu\n", (SD_GetBusSpeed() == SD_BUS_SPEED_HIGH) ? "48MHz high speed" : "24MHz", SD_GetCRCErrorCount());
+		if (sdcard_speed.measured)
+		{
+			f_printf(&profile_file, "seq read %lu kB/s\n", sdcard_speed.seq_read_kBps);
+			f_printf(&profile_file, "random read avg %lu us, max %lu us\n", sdcard_speed.rand_read_us, sdcard_speed.max_rand_read_us);
+		}
+		f_printf(&profile_file, "max resample rate %lu/100, buffer threshold %lu\n", (uint32_t)(sdcard_speed.max_rs * 100.0f), sdcard_speed.buffer_threshold);
+
+		profile_write_res = f_close(&profile_file);
+		return(1);
+	}
+
+	get_profile_stats(profile_write_step, &s);
+
+	f_printf(&profile_file, "[%s]\n", profile_names[profile_write_step]);
+	f_printf(&profile_file, "calls %lu, min %lu, avg %lu, max %lu, load %lu\n", s.count, s.count ? s.min : 0, s.count ? (uint32_t)(s.total / s.count) : 0, s.max, calc_load_permille(&s));
+	f_printf(&profile_file, "histogram");
+	for (i=0; i<PROFILE_HIST_BINS; i++)
+		f_printf(&profile_file, " %lu", s.hist[i]);
+	f_printf(&profile_file, "\n\n");
+
+	profile_write_step++;
+	return(0);
+}
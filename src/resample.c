@@ -18,6 +18,8 @@ extern uint8_t flags[NUM_FLAGS];
 
 extern uint8_t	i_param[NUM_ALL_CHAN][NUM_I_PARAMS];
 
+extern Voice	voice[NUM_PLAY_CHAN];
+
 void safe_inc_play_addr(CircularBuffer* buf, uint8_t blockAlign,  uint8_t chan);
 
 inline void safe_inc_play_addr(CircularBuffer* buf, uint8_t blockAlign, uint8_t chan)
@@ -77,18 +79,16 @@ inline int16_t get_16b_sample_left(uint32_t addr)
 }
 
 
-void resample_read16_avg(float rs, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out)
+void resample_read16_avg(float rs, float rs_step, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out)
 {
-	static float fractional_pos[4] = {0,0,0,0};
-	static float xm1[4], x0[4], x1[4], x2[4];
+	ResampleState *st;
 	float a,b,c;
 	uint32_t outpos;
 	float t_out;
-	uint8_t ch;
 
-	ch = chan * 2; //0 or 2
+	st = &voice[chan].resample[0];
 
-	if (rs == 1.0)
+	if (rs == 1.0 && rs_step == 0.0f)
 	{
 		for(outpos=0;outpos<buff_len;outpos++)
 		{
@@ -106,124 +106,123 @@ void resample_read16_avg(float rs, CircularBuffer* buf, uint32_t buff_len, uint8
 			flags[PlayBuff1_Discontinuity+chan] = 0;
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x0[ch] = get_16b_sample_avg(buf->out);
+			st->x0 = get_16b_sample_avg(buf->out);
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x1[ch] = get_16b_sample_avg(buf->out);
+			st->x1 = get_16b_sample_avg(buf->out);
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x2[ch] = get_16b_sample_avg(buf->out);
+			st->x2 = get_16b_sample_avg(buf->out);
 
-			fractional_pos[ch] = 0.0;
+			st->fractional_pos = 0.0;
 		}
 
 		outpos=0;
 		while (outpos < buff_len)
 		{
 			//Optimize for resample rates >= 4
-			if (fractional_pos[ch] >= 4.0)
+			if (st->fractional_pos >= 4.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 4.0;
+				st->fractional_pos = st->fractional_pos - 4.0;
 
 				//shift samples back one
 				//and read a new sample
 				safe_inc_play_addr(buf, block_align, chan);
-				xm1[ch] 	= get_16b_sample_avg(buf->out);
+				st->xm1 	= get_16b_sample_avg(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x0[ch] 	= get_16b_sample_avg(buf->out);
+				st->x0 	= get_16b_sample_avg(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_avg(buf->out);
+				st->x1 	= get_16b_sample_avg(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_avg(buf->out);
+				st->x2 	= get_16b_sample_avg(buf->out);
 
 			}
 			//Optimize for resample rates >= 3
-			if (fractional_pos[ch] >= 3.0)
+			if (st->fractional_pos >= 3.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 3.0;
+				st->fractional_pos = st->fractional_pos - 3.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x2[ch];
+				st->xm1 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x0[ch] 	= get_16b_sample_avg(buf->out);
+				st->x0 	= get_16b_sample_avg(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_avg(buf->out);
+				st->x1 	= get_16b_sample_avg(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_avg(buf->out);
+				st->x2 	= get_16b_sample_avg(buf->out);
 
 			}
 			//Optimize for resample rates >= 2
-			if (fractional_pos[ch] >= 2.0)
+			if (st->fractional_pos >= 2.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 2.0;
+				st->fractional_pos = st->fractional_pos - 2.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x1[ch];
-				x0[ch] 	= x2[ch];
+				st->xm1 	= st->x1;
+				st->x0 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_avg(buf->out);
+				st->x1 	= get_16b_sample_avg(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_avg(buf->out);
+				st->x2 	= get_16b_sample_avg(buf->out);
 
 			}
 			//Optimize for resample rates >= 1
-			if (fractional_pos[ch] >= 1.0)
+			if (st->fractional_pos >= 1.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 1.0;
+				st->fractional_pos = st->fractional_pos - 1.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x0[ch];
-				x0[ch] 	= x1[ch];
-				x1[ch] 	= x2[ch];
+				st->xm1 	= st->x0;
+				st->x0 	= st->x1;
+				st->x1 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_avg(buf->out);
+				st->x2 	= get_16b_sample_avg(buf->out);
 
 			}
 
 			//calculate coefficients
-			a = (3 * (x0[ch]-x1[ch]) - xm1[ch] + x2[ch]) / 2;
-			b = 2*x1[ch] + xm1[ch] - (5*x0[ch] + x2[ch]) / 2;
-			c = (x1[ch] - xm1[ch]) / 2;
+			a = (3 * (st->x0-st->x1) - st->xm1 + st->x2) / 2;
+			b = 2*st->x1 + st->xm1 - (5*st->x0 + st->x2) / 2;
+			c = (st->x1 - st->xm1) / 2;
 
 			//calculate as many fractionally placed output points as we need
-			while ( fractional_pos[ch]<1.0 && outpos<buff_len)
+			while ( st->fractional_pos<1.0 && outpos<buff_len)
 			{
-				t_out = (((a * fractional_pos[ch]) + b) * fractional_pos[ch] + c) * fractional_pos[ch] + x0[ch];
+				t_out = (((a * st->fractional_pos) + b) * st->fractional_pos + c) * st->fractional_pos + st->x0;
 				if (t_out >= 32767.0)		out[outpos++] = 32767;
 				else if (t_out <= -32767.0)	out[outpos++] = -32767;
 				else						out[outpos++] = t_out;
 
-				fractional_pos[ch] += rs;
+				st->fractional_pos += rs;
+				rs += rs_step;
 			}
 		}
 	}
 }
 
 
-void resample_read16_right(float rs, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out)
+void resample_read16_right(float rs, float rs_step, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out)
 {
-	static float fractional_pos[4] = {0,0,0,0};
-	static float xm1[4], x0[4], x1[4], x2[4];
+	ResampleState *st;
 	float a,b,c;
 	uint32_t outpos;
 	float t_out;
-	uint8_t ch;
 
-	ch = chan * 2 + 1; //1 or 3
+	st = &voice[chan].resample[1];
 
-	if (rs == 1.0)
+	if (rs == 1.0 && rs_step == 0.0f)
 	{
 		for(outpos=0;outpos<buff_len;outpos++)
 		{
@@ -241,125 +240,124 @@ void resample_read16_right(float rs, CircularBuffer* buf, uint32_t buff_len, uin
 			flags[PlayBuff1_Discontinuity+chan] = 0;
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x0[ch] = get_16b_sample_right(buf->out);
+			st->x0 = get_16b_sample_right(buf->out);
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x1[ch] = get_16b_sample_right(buf->out);
+			st->x1 = get_16b_sample_right(buf->out);
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x2[ch] = get_16b_sample_right(buf->out);
+			st->x2 = get_16b_sample_right(buf->out);
 
-			fractional_pos[ch] = 0.0;
+			st->fractional_pos = 0.0;
 		}
 
 		outpos=0;
 		while (outpos < buff_len)
 		{
 			//Optimize for resample rates >= 4
-			if (fractional_pos[ch] >= 4.0)
+			if (st->fractional_pos >= 4.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 4.0;
+				st->fractional_pos = st->fractional_pos - 4.0;
 
 				//shift samples back one
 				//and read a new sample
 				safe_inc_play_addr(buf, block_align, chan);
-				xm1[ch] 	= get_16b_sample_right(buf->out);
+				st->xm1 	= get_16b_sample_right(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x0[ch] 	= get_16b_sample_right(buf->out);
+				st->x0 	= get_16b_sample_right(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_right(buf->out);
+				st->x1 	= get_16b_sample_right(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_right(buf->out);
+				st->x2 	= get_16b_sample_right(buf->out);
 
 			}
 			//Optimize for resample rates >= 3
-			if (fractional_pos[ch] >= 3.0)
+			if (st->fractional_pos >= 3.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 3.0;
+				st->fractional_pos = st->fractional_pos - 3.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x2[ch];
+				st->xm1 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x0[ch] 	= get_16b_sample_right(buf->out);
+				st->x0 	= get_16b_sample_right(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_right(buf->out);
+				st->x1 	= get_16b_sample_right(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_right(buf->out);
+				st->x2 	= get_16b_sample_right(buf->out);
 
 			}
 			//Optimize for resample rates >= 2
-			if (fractional_pos[ch] >= 2.0)
+			if (st->fractional_pos >= 2.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 2.0;
+				st->fractional_pos = st->fractional_pos - 2.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x1[ch];
-				x0[ch] 	= x2[ch];
+				st->xm1 	= st->x1;
+				st->x0 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_right(buf->out);
+				st->x1 	= get_16b_sample_right(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_right(buf->out);
+				st->x2 	= get_16b_sample_right(buf->out);
 
 			}
 			//Optimize for resample rates >= 1
-			if (fractional_pos[ch] >= 1.0)
+			if (st->fractional_pos >= 1.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 1.0;
+				st->fractional_pos = st->fractional_pos - 1.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x0[ch];
-				x0[ch] 	= x1[ch];
-				x1[ch] 	= x2[ch];
+				st->xm1 	= st->x0;
+				st->x0 	= st->x1;
+				st->x1 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_right(buf->out);
+				st->x2 	= get_16b_sample_right(buf->out);
 
 			}
 
 			//calculate coefficients
-			a = (3 * (x0[ch]-x1[ch]) - xm1[ch] + x2[ch]) / 2;
-			b = 2*x1[ch] + xm1[ch] - (5*x0[ch] + x2[ch]) / 2;
-			c = (x1[ch] - xm1[ch]) / 2;
+			a = (3 * (st->x0-st->x1) - st->xm1 + st->x2) / 2;
+			b = 2*st->x1 + st->xm1 - (5*st->x0 + st->x2) / 2;
+			c = (st->x1 - st->xm1) / 2;
 
 			//calculate as many fractionally placed output points as we need
-			while ( fractional_pos[ch]<1.0 && outpos<buff_len)
+			while ( st->fractional_pos<1.0 && outpos<buff_len)
 			{
-				t_out = (((a * fractional_pos[ch]) + b) * fractional_pos[ch] + c) * fractional_pos[ch] + x0[ch];
+				t_out = (((a * st->fractional_pos) + b) * st->fractional_pos + c) * st->fractional_pos + st->x0;
 				if (t_out >= 32767.0)		out[outpos++] = 32767;
 				else if (t_out <= -32767.0)	out[outpos++] = -32767;
 				else						out[outpos++] = t_out;
 
-				fractional_pos[ch] += rs;
+				st->fractional_pos += rs;
+				rs += rs_step;
 			}
 		}
 	}
 }
 
 
-void resample_read16_left(float rs, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out)
+void resample_read16_left(float rs, float rs_step, CircularBuffer* buf, uint32_t buff_len, uint8_t block_align, uint8_t chan, int32_t *out)
 {
-	static float fractional_pos[4] = {0,0,0,0};
-	static float xm1[4], x0[4], x1[4], x2[4];
+	ResampleState *st;
 	float a,b,c;
 	uint32_t outpos;
 	float t_out;
-	uint8_t ch;
 
 
-	ch = chan * 2; //0 or 2
+	st = &voice[chan].resample[0];
 
-	if (rs == 1.0)
+	if (rs == 1.0 && rs_step == 0.0f)
 	{
 		for(outpos=0;outpos<buff_len;outpos++)
 		{
@@ -377,106 +375,107 @@ void resample_read16_left(float rs, CircularBuffer* buf, uint32_t buff_len, uint
 			flags[PlayBuff1_Discontinuity+chan] = 0;
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x0[ch] = get_16b_sample_left(buf->out);
+			st->x0 = get_16b_sample_left(buf->out);
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x1[ch] = get_16b_sample_left(buf->out);
+			st->x1 = get_16b_sample_left(buf->out);
 
 			safe_inc_play_addr(buf, block_align, chan);
-			x2[ch] = get_16b_sample_left(buf->out);
+			st->x2 = get_16b_sample_left(buf->out);
 
-			fractional_pos[ch] = 0.0;
+			st->fractional_pos = 0.0;
 		}
 
 		outpos=0;
 		while (outpos < buff_len)
 		{
 			//Optimize for resample rates >= 4
-			if (fractional_pos[ch] >= 4.0)
+			if (st->fractional_pos >= 4.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 4.0;
+				st->fractional_pos = st->fractional_pos - 4.0;
 
 				//shift samples back one
 				//and read a new sample
 				safe_inc_play_addr(buf, block_align, chan);
-				xm1[ch] 	= get_16b_sample_left(buf->out);
+				st->xm1 	= get_16b_sample_left(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x0[ch] 	= get_16b_sample_left(buf->out);
+				st->x0 	= get_16b_sample_left(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_left(buf->out);
+				st->x1 	= get_16b_sample_left(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_left(buf->out);
+				st->x2 	= get_16b_sample_left(buf->out);
 
 			}
 			//Optimize for resample rates >= 3
-			if (fractional_pos[ch] >= 3.0)
+			if (st->fractional_pos >= 3.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 3.0;
+				st->fractional_pos = st->fractional_pos - 3.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x2[ch];
+				st->xm1 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x0[ch] 	= get_16b_sample_left(buf->out);
+				st->x0 	= get_16b_sample_left(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_left(buf->out);
+				st->x1 	= get_16b_sample_left(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_left(buf->out);
+				st->x2 	= get_16b_sample_left(buf->out);
 
 			}
 			//Optimize for resample rates >= 2
-			if (fractional_pos[ch] >= 2.0)
+			if (st->fractional_pos >= 2.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 2.0;
+				st->fractional_pos = st->fractional_pos - 2.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x1[ch];
-				x0[ch] 	= x2[ch];
+				st->xm1 	= st->x1;
+				st->x0 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x1[ch] 	= get_16b_sample_left(buf->out);
+				st->x1 	= get_16b_sample_left(buf->out);
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_left(buf->out);
+				st->x2 	= get_16b_sample_left(buf->out);
 
 			}
 			//Optimize for resample rates >= 1
-			if (fractional_pos[ch] >= 1.0)
+			if (st->fractional_pos >= 1.0)
 			{
-				fractional_pos[ch] = fractional_pos[ch] - 1.0;
+				st->fractional_pos = st->fractional_pos - 1.0;
 
 				//shift samples back one
 				//and read a new sample
-				xm1[ch] 	= x0[ch];
-				x0[ch] 	= x1[ch];
-				x1[ch] 	= x2[ch];
+				st->xm1 	= st->x0;
+				st->x0 	= st->x1;
+				st->x1 	= st->x2;
 
 				safe_inc_play_addr(buf, block_align, chan);
-				x2[ch] 	= get_16b_sample_left(buf->out);
+				st->x2 	= get_16b_sample_left(buf->out);
 
 			}
 
 			//calculate coefficients
-			a = (3 * (x0[ch]-x1[ch]) - xm1[ch] + x2[ch]) / 2;
-			b = 2*x1[ch] + xm1[ch] - (5*x0[ch] + x2[ch]) / 2;
-			c = (x1[ch] - xm1[ch]) / 2;
+			a = (3 * (st->x0-st->x1) - st->xm1 + st->x2) / 2;
+			b = 2*st->x1 + st->xm1 - (5*st->x0 + st->x2) / 2;
+			c = (st->x1 - st->xm1) / 2;
 
 			//calculate as many fractionally placed output points as we need
-			while ( fractional_pos[ch]<1.0 && outpos<buff_len)
+			while ( st->fractional_pos<1.0 && outpos<buff_len)
 			{
-				t_out = (((a * fractional_pos[ch]) + b) * fractional_pos[ch] + c) * fractional_pos[ch] + x0[ch];
+				t_out = (((a * st->fractional_pos) + b) * st->fractional_pos + c) * st->fractional_pos + st->x0;
 				if (t_out >= 32767.0)		out[outpos++] = 32767;
 				else if (t_out <= -32767.0)	out[outpos++] = -32767;
 				else						out[outpos++] = t_out;
 
-				fractional_pos[ch] += rs;
+				st->fractional_pos += rs;
+				rs += rs_step;
 			}
 		}
 	}
@@ -14,6 +14,7 @@
 #include "res/LED_palette.h"
 #include "edit_mode.h"
 #include "system_mode.h"
+#include "profiler.h"
 
 #define BIG_PLAY_BUTTONS
 #define FROSTED_BUTTONS
@@ -134,6 +135,8 @@ void display_one_ButtonLED(uint8_t ButtonLED_number)
 		cached_ButLED_color[ButtonLED_number][0]=ButLED_color[ButtonLED_number][0];
 		cached_ButLED_color[ButtonLED_number][1]=ButLED_color[ButtonLED_number][1];
 		cached_ButLED_color[ButtonLED_number][2]=ButLED_color[ButtonLED_number][2];
+
+		LEDDriver_update();
 	}
 
 }
@@ -143,6 +146,7 @@ void display_one_ButtonLED(uint8_t ButtonLED_number)
  * display_all_ButtonLEDs()
  *
  * Tells the LED Driver chip to set the RGB color of all LEDs that have changed value
+ * The changes are sent in the background (see LEDDriver_update())
  */
 void display_all_ButtonLEDs(void)
 {
@@ -172,6 +176,7 @@ void display_all_ButtonLEDs(void)
 		}
 	}
 
+	LEDDriver_update();
 }
 
 void all_buttonLEDs_off(void)
@@ -181,6 +186,7 @@ void all_buttonLEDs_off(void)
 	{
 		LEDDriver_setRGBLED(j,0 );
 	}
+	LEDDriver_update();
 }
 /*
  * test_all_buttonLEDs()
@@ -331,10 +337,10 @@ void update_ButtonLEDs(void)
 		//
 
 		// Writing index
-		if (flags[RewriteIndex])
+		if (flags[RewriteIndex] || flags[WritingIndex])
 		{	
 			if (ButLEDnum!=Play1ButtonLED && ButLEDnum!=Play2ButtonLED)
-				set_ButtonLED_byPalette(ButLEDnum, flags[RewriteIndex]);
+				set_ButtonLED_byPalette(ButLEDnum, flags[RewriteIndex] ? flags[RewriteIndex] : flags[WritingIndex]);
 			else
 				set_ButtonLED_byPalette(ButLEDnum, OFF);
 
@@ -733,6 +739,8 @@ void ButtonLED_IRQHandler(void)
 {
 	if (TIM_GetITStatus(TIM10, TIM_IT_Update) != RESET)
 	{
+		PROFILE_START(PROF_BUTTON_LEDS);
+
 		if (global_mode[CALIBRATE])
 			update_calibration_button_leds();
 		else
@@ -743,6 +751,8 @@ void ButtonLED_IRQHandler(void)
 
 		display_all_ButtonLEDs();
 
+		PROFILE_END(PROF_BUTTON_LEDS);
+
 		TIM_ClearITPendingBit(TIM10, TIM_IT_Update);
 	}
 }
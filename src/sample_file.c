@@ -7,6 +7,7 @@
 #include "wavefmt.h"
 #include "sample_file.h"
 #include "dig_pins.h"
+#include "event_queue.h"
 
 extern enum g_Errors g_error;
 extern uint8_t	i_param[NUM_ALL_CHAN][NUM_I_PARAMS];
@@ -15,6 +16,9 @@ extern uint8_t global_mode[NUM_GLOBAL_MODES];
 extern FATFS FatFs;
 
 extern enum PlayStates play_state				[NUM_PLAY_CHAN];
+extern uint8_t	sample_num_now_playing	[NUM_PLAY_CHAN];
+extern uint8_t	sample_bank_now_playing	[NUM_PLAY_CHAN];
+extern volatile uint32_t sys_tmr;
 
 Sample samples[MAX_NUM_BANKS][NUM_SAMPLES_PER_BANK];
 
@@ -170,6 +174,9 @@ uint8_t load_sample_header(Sample *s_sample, FIL *sample_file)
 						else 	s_sample->PCM 		= fmt_chunk.audioFormat;
 
 						s_sample->file_found 		= 1;
+						s_sample->file_size 		= f_size(sample_file);
+						s_sample->file_datetime 	= 0;
+						s_sample->hdr_verified 		= 1;
 						s_sample->inst_end 			= s_sample->sampleSize;
 						s_sample->inst_size 		= s_sample->sampleSize;
 						s_sample->inst_start 		= 0;
@@ -200,8 +207,326 @@ void clear_sample_header(Sample *s_sample)
 
 	s_sample->file_found = 0;
 
+	s_sample->file_size = 0;
+	s_sample->file_datetime = 0;
+	s_sample->hdr_verified = 0;
+
 	s_sample->inst_start = 0;
 	s_sample->inst_end = 0;
 	s_sample->inst_size = 0;
 	s_sample->inst_gain = 1.0;
 }
+
+
+//
+// Sample header cache
+//
+// Booting with a full card used to open and parse every assigned wav file.
+// Instead, the header fields are saved along with the index, and at boot we
+// only stat() each file: if the size and timestamp match, the cached header is used.
+// Headers taken from the cache are verified later, either by verify_sample_headers_idle()
+// or by start_playing() the first time the slot is played.
+//
+
+#define HDRCACHE_NUM_ENTRIES		(MAX_NUM_BANKS*NUM_SAMPLES_PER_BANK)
+#define HDRCACHE_DATA_START			(3*sizeof(uint32_t))	//magic, version, number of entries
+#define HDRCACHE_ENTRIES_PER_WRITE	16
+#define HDR_VERIFY_PERIOD			(BASE_SAMPLE_RATE/50) 	//20ms between idle header checks
+
+static uint32_t hash_path(char *path)
+{
+	uint32_t h = 2166136261;		//FNV-1a
+
+	while (*path)
+	{
+		h ^= (uint8_t)(*path++);
+		h *= 16777619;
+	}
+	return (h ? h : 1); //0 is reserved for empty entries
+}
+
+static uint32_t fno_datetime(FILINFO *fno)
+{
+	return (((uint32_t)fno->fdate)<<16) | fno->ftime;
+}
+
+static FIL			hdrcache_wr_file;
+static uint32_t		hdrcache_wr_i = HDRCACHE_NUM_ENTRIES;
+static FRESULT		hdrcache_wr_res;
+
+//Creates the header cache file for write_sample_header_cache_step()
+void write_sample_header_cache_begin(void)
+{
+	uint32_t	file_hdr[3];
+	uint32_t	bw;
+	char		path[_MAX_LFN+1];
+
+	hdrcache_wr_i = 0;
+
+	str_cat(path, SYS_DIR_SLASH, SAMPLE_HDRCACHE_FILE);
+	hdrcache_wr_res = f_open(&hdrcache_wr_file, path, FA_WRITE | FA_CREATE_ALWAYS);
+	if (hdrcache_wr_res != FR_OK) {hdrcache_wr_i = HDRCACHE_NUM_ENTRIES; return;}
+
+	file_hdr[0] = HDRCACHE_MAGIC;
+	file_hdr[1] = HDRCACHE_VERSION;
+	file_hdr[2] = HDRCACHE_NUM_ENTRIES;
+	hdrcache_wr_res = f_write(&hdrcache_wr_file, file_hdr, HDRCACHE_DATA_START, &bw);
+}
+
+//Writes the next HDRCACHE_ENTRIES_PER_WRITE entries
+//Returns 1 when the file is written (or failed)
+uint8_t write_sample_header_cache_step(void)
+{
+	FILINFO				fno;
+	SampleHeaderCache	entries[HDRCACHE_ENTRIES_PER_WRITE];
+	SampleHeaderCache	*e;
+	Sample				*s;
+	uint32_t			n, bw;
+
+	if (hdrcache_wr_i >= HDRCACHE_NUM_ENTRIES) return(1);
+
+	for (n=0; n<HDRCACHE_ENTRIES_PER_WRITE && hdrcache_wr_i<HDRCACHE_NUM_ENTRIES; n++, hdrcache_wr_i++)
+	{
+		e = &entries[n];
+		s = &samples[hdrcache_wr_i/NUM_SAMPLES_PER_BANK][hdrcache_wr_i%NUM_SAMPLES_PER_BANK];
+
+		e->path_hash = 0;
+
+		if (s->filename[0] && s->file_found)
+		{
+			//Headers loaded from the file don't have the timestamp yet
+			if (!s->file_datetime && f_stat(s->filename, &fno)==FR_OK)
+			{
+				s->file_size 		= fno.fsize;
+				s->file_datetime 	= fno_datetime(&fno);
+			}
+
+			if (s->file_datetime)
+			{
+				e->path_hash 		= hash_path(s->filename);
+				e->file_size 		= s->file_size;
+				e->file_datetime 	= s->file_datetime;
+				e->sampleSize 		= s->sampleSize;
+				e->startOfData 		= s->startOfData;
+				e->sampleRate 		= s->sampleRate;
+				e->PCM 				= s->PCM;
+				e->sampleByteSize 	= s->sampleByteSize;
+				e->numChannels 		= s->numChannels;
+				e->blockAlign 		= s->blockAlign;
+			}
+		}
+	}
+
+	if (hdrcache_wr_res == FR_OK)
+		hdrcache_wr_res = f_write(&hdrcache_wr_file, entries, n*sizeof(SampleHeaderCache), &bw);
+
+	if (hdrcache_wr_res != FR_OK || hdrcache_wr_i >= HDRCACHE_NUM_ENTRIES)
+	{
+		hdrcache_wr_i = HDRCACHE_NUM_ENTRIES;
+		f_close(&hdrcache_wr_file);
+		return(1);
+	}
+	return(0);
+}
+
+FRESULT write_sample_header_cache(void)
+{
+	write_sample_header_cache_begin();
+
+	while (!write_sample_header_cache_step()) {;}
+
+	return(hdrcache_wr_res);
+}
+
+//
+// Opens the header cache file and checks it matches this firmware's layout
+// Returns 1 if the cache can be used (file is left open), 0 if not
+//
+uint8_t open_sample_header_cache(FIL *hdrcache)
+{
+	FRESULT		res;
+	uint32_t	file_hdr[3];
+	uint32_t	br;
+	char		path[_MAX_LFN+1];
+
+	str_cat(path, SYS_DIR_SLASH, SAMPLE_HDRCACHE_FILE);
+	res = f_open(hdrcache, path, FA_READ);
+	if (res != FR_OK) return(0);
+
+	res = f_read(hdrcache, file_hdr, HDRCACHE_DATA_START, &br);
+	if (res != FR_OK || br != HDRCACHE_DATA_START \
+		|| file_hdr[0] != HDRCACHE_MAGIC \
+		|| file_hdr[1] != HDRCACHE_VERSION \
+		|| file_hdr[2] != HDRCACHE_NUM_ENTRIES)
+	{
+		f_close(hdrcache);
+		return(0);
+	}
+
+	return(1);
+}
+
+//
+// Loads the header for s_sample->filename, which must exist (fno is its directory entry)
+// Uses the header cache entry for bank/samplenum if it matches the directory entry,
+// otherwise the header is parsed from the file.
+// hdrcache can be 0 if the cache is not available
+//
+uint8_t load_sample_header_cached(Sample *s_sample, FILINFO *fno, FIL *hdrcache, uint8_t bank, uint8_t samplenum)
+{
+	SampleHeaderCache	e;
+	FIL					wav_file;
+	uint32_t			br;
+	uint8_t				res;
+
+	if (hdrcache)
+	{
+		res = f_lseek(hdrcache, HDRCACHE_DATA_START + (bank*NUM_SAMPLES_PER_BANK + samplenum)*sizeof(SampleHeaderCache));
+		if (res == FR_OK)
+			res = f_read(hdrcache, &e, sizeof(SampleHeaderCache), &br);
+
+		if (res == FR_OK && br == sizeof(SampleHeaderCache) \
+			&& e.path_hash 		== hash_path(s_sample->filename) \
+			&& e.file_size 		== fno->fsize \
+			&& e.file_datetime 	== fno_datetime(fno) \
+			&& e.sampleByteSize && e.numChannels && e.blockAlign && e.sampleRate)
+		{
+			s_sample->sampleSize 		= e.sampleSize;
+			s_sample->startOfData 		= e.startOfData;
+			s_sample->sampleRate 		= e.sampleRate;
+			s_sample->PCM 				= e.PCM;
+			s_sample->sampleByteSize 	= e.sampleByteSize;
+			s_sample->numChannels 		= e.numChannels;
+			s_sample->blockAlign 		= e.blockAlign;
+
+			s_sample->file_found 		= 1;
+			s_sample->file_size 		= e.file_size;
+			s_sample->file_datetime 	= e.file_datetime;
+			s_sample->hdr_verified 		= 0;
+			s_sample->inst_end 			= s_sample->sampleSize;
+			s_sample->inst_size 		= s_sample->sampleSize;
+			s_sample->inst_start 		= 0;
+			s_sample->inst_gain 		= 1.0;
+
+			return(FR_OK);
+		}
+	}
+
+	//Cache miss: read the header from the file
+	res = f_open(&wav_file, s_sample->filename, FA_READ);
+	if (res != FR_OK) return(res);
+
+	res = load_sample_header(s_sample, &wav_file);
+	f_close(&wav_file);
+
+	if (res == FR_OK)
+	{
+		s_sample->file_size 		= fno->fsize;
+		s_sample->file_datetime 	= fno_datetime(fno);
+	}
+	return(res);
+}
+
+//
+// Parses the header of a sample whose header came from the cache, and corrects it if needed
+// If the file can't be read as a wav file, it's marked as not found
+// Returns FR_OK if the sample is valid
+//
+uint8_t verify_sample_header(Sample *s_sample)
+{
+	Sample		tmp;
+	FIL			wav_file;
+	FILINFO		fno;
+	uint8_t		res;
+	uint8_t		chan;
+
+	s_sample->hdr_verified = 1;
+
+	str_cpy(tmp.filename, s_sample->filename);
+
+	res = f_stat(tmp.filename, &fno);
+	if (res == FR_OK)
+		res = f_open(&wav_file, tmp.filename, FA_READ);
+
+	if (res == FR_OK)
+	{
+		res = load_sample_header(&tmp, &wav_file);
+		f_close(&wav_file);
+	}
+
+	if (res != FR_OK)
+	{
+		s_sample->file_found = 0;
+		return(res);
+	}
+
+	s_sample->file_size 	= fno.fsize;
+	s_sample->file_datetime = fno_datetime(&fno);
+
+	if (   tmp.sampleSize 		!= s_sample->sampleSize
+		|| tmp.startOfData 		!= s_sample->startOfData
+		|| tmp.sampleRate 		!= s_sample->sampleRate
+		|| tmp.PCM 				!= s_sample->PCM
+		|| tmp.sampleByteSize 	!= s_sample->sampleByteSize
+		|| tmp.numChannels 		!= s_sample->numChannels
+		|| tmp.blockAlign 		!= s_sample->blockAlign )
+	{
+		s_sample->sampleSize 		= tmp.sampleSize;
+		s_sample->startOfData 		= tmp.startOfData;
+		s_sample->sampleRate 		= tmp.sampleRate;
+		s_sample->PCM 				= tmp.PCM;
+		s_sample->sampleByteSize 	= tmp.sampleByteSize;
+		s_sample->numChannels 		= tmp.numChannels;
+		s_sample->blockAlign 		= tmp.blockAlign;
+
+		//Keep the play data within the (new) sample size
+		if (s_sample->inst_start >= s_sample->sampleSize)
+		{
+			s_sample->inst_start 	= 0;
+			s_sample->inst_size 	= s_sample->sampleSize;
+		}
+		if (s_sample->inst_end > s_sample->sampleSize)
+			s_sample->inst_end = s_sample->sampleSize;
+
+		if ((s_sample->inst_start + s_sample->inst_size) > s_sample->sampleSize)
+			s_sample->inst_size = s_sample->sampleSize - s_sample->inst_start;
+
+		//Re-open the file on any channel that has this sample loaded
+		for (chan=0; chan<NUM_PLAY_CHAN; chan++)
+		{
+			if (s_sample == &samples[ sample_bank_now_playing[chan] ][ sample_num_now_playing[chan] ])
+				post_event(EV_FORCE_RELOAD, chan);
+		}
+	}
+
+	return(FR_OK);
+}
+
+//
+// Verifies one cached header at a time, when the SD card isn't needed for playback
+// Called from the main loop
+//
+void verify_sample_headers_idle(void)
+{
+	static uint32_t last_verify_tmr = 0;
+	static uint32_t slot_i = 0;
+	uint32_t 		i;
+	Sample			*s;
+
+	if ((sys_tmr - last_verify_tmr) < HDR_VERIFY_PERIOD) return;
+	last_verify_tmr = sys_tmr;
+
+	if (!is_storage_idle()) return;
+
+	for (i=0; i<HDRCACHE_NUM_ENTRIES; i++)
+	{
+		if (++slot_i >= HDRCACHE_NUM_ENTRIES) slot_i = 0;
+
+		s = &samples[slot_i/NUM_SAMPLES_PER_BANK][slot_i%NUM_SAMPLES_PER_BANK];
+		if (s->filename[0] && s->file_found && !s->hdr_verified)
+		{
+			verify_sample_header(s);
+			return;
+		}
+	}
+}
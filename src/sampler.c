@@ -3,10 +3,12 @@
  */
 
 
+#include <string.h>
 #include "globals.h"
 #include "audio_sdram.h"
 #include "ff.h"
 #include "sampler.h"
+#include "audio_codec.h"
 #include "audio_util.h"
 
 #include "adc.h"
@@ -27,6 +29,9 @@
 #include "circular_buffer_cache.h"
 #include "bank.h"
 #include "leds.h"
+#include "voices.h"
+#include "event_queue.h"
+#include "sdcard_speed.h"
 
 static inline int32_t _SSAT16(int32_t x);
 static inline int32_t _SSAT16(int32_t x) {asm("ssat %[dst], #16, %[src]" : [dst] "=r" (x) : [src] "r" (x)); return x;}
@@ -43,11 +48,13 @@ Sample dbg_sample;
 // Filesystem:
 //
 extern FATFS FatFs;
+extern SdCardSpeed sdcard_speed;
 
 //
 // System-wide parameters, flags, modes, states
 //
 extern float 				f_param[NUM_PLAY_CHAN][NUM_F_PARAMS];
+extern float 				block_start_pitch[NUM_PLAY_CHAN];
 extern uint8_t				i_param[NUM_ALL_CHAN][NUM_I_PARAMS];
 
 extern uint8_t 				global_mode[NUM_GLOBAL_MODES];
@@ -62,8 +69,8 @@ uint32_t					last_play_start_tmr[NUM_PLAY_CHAN];
 
 uint8_t 					SAMPLINGBYTES=2;
 
-uint32_t 					end_out_ctr[NUM_PLAY_CHAN]={0,0};
-uint32_t 					play_led_flicker_ctr[NUM_PLAY_CHAN]={0,0};
+uint32_t 					end_out_ctr[NUM_PLAY_CHAN]={0};
+uint32_t 					play_led_flicker_ctr[NUM_PLAY_CHAN]={0};
 
 
 //
@@ -72,9 +79,12 @@ uint32_t 					play_led_flicker_ctr[NUM_PLAY_CHAN]={0,0};
 
 uint32_t tmp_buff_u32[READ_BLOCK_SIZE>>2];
 
+//Frames a streamed loop's next pass crossfades with: kept by begin_loop_wrap() and mixed by mix_loop_wrap() as the next pass is read
+static int16_t loop_xfade_save[NUM_PLAY_CHAN][LOOP_XFADE_MAX_FRAMES*2];
+
 //
 // SDRAM buffer addresses for playing from sdcard
-// SD Card:fil[]@sample_file_curpos --> SDARM @play_buff[]->in ... SDRAM @play_buff[]->out --> Codec
+// SD Card:fil[]@file_curpos --> SDARM @play_buff[]->in ... SDRAM @play_buff[]->out --> Codec
 //
 CircularBuffer splay_buff				[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK];
 CircularBuffer* play_buff				[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK];
@@ -83,38 +93,23 @@ CircularBuffer* play_buff				[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK];
 enum PlayStates play_state				[NUM_PLAY_CHAN]; //activity
 uint8_t			sample_num_now_playing	[NUM_PLAY_CHAN]; //sample_now_playing
 uint8_t			sample_bank_now_playing	[NUM_PLAY_CHAN]; //bank_now_playing
+uint8_t			force_file_reload		[NUM_PLAY_CHAN]; //re-open the file the next time it starts (EV_FORCE_RELOAD)
 
-//ToDo: make cache_* a struct
-//The cache tells us what section of the file has been cached into the play_buff
-//cache_low and cache_high and cache_size are all in file's native units (varies by the file's bit rate and stereo/mono)
-//cache_map_pt is in units of play_buff, and tells us what address cache_low maps to
-//
-uint32_t		cache_low				[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK]; //file position address that corresponds to lowest position in file that's cached
-uint32_t		cache_high				[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK]; //file position address that corresponds to highest position in file that's cached
-uint32_t		cache_size				[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK]; //size in bytes of the cache (should always equal play_buff[]->size / 2 * sampleByteSize
-uint32_t		cache_map_pt			[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK]; //address in play_buff[] that corresponds to cache_low
-uint8_t 		is_buffered_to_file_end	[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK]; //1 = file is totally cached (from inst_start to inst_end), otherwise 0
-uint32_t 		play_buff_bufferedamt	[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK];
-uint8_t			cached_rev_state		[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK];
-
-//ToDo: make this a struct
-uint32_t 		sample_file_startpos	[NUM_PLAY_CHAN]; //file position where we began playback. 
-uint32_t		sample_file_endpos		[NUM_PLAY_CHAN]; //file position where we will end playback. endpos > startpos when REV==0, endpos < startpos when REV==1
-
-uint32_t 		sample_file_curpos		[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK]; //current file position being read. Must match the actual open file's position. This is always inc/decrementing from startpos towards endpos
+//Per-channel stream state: cache bounds and file positions for each sample slot, and the resampler history
+CCMDATA Voice	voice					[NUM_PLAY_CHAN];
 
 
 enum PlayLoadTriage play_load_triage;
 
-#define SET_FILE_POS(c, b, s)	f_lseek(&fil[c][s], samples[b][s].startOfData + sample_file_curpos[c][s]);\
-								if(fil[c][s].fptr != (samples[b][s].startOfData + sample_file_curpos[c][s]) ) g_error|=LSEEK_FPTR_MISMATCH;
+#define SET_FILE_POS(c, b, s)	f_lseek(&fil[c][s], samples[b][s].startOfData + voice[c].cache[s].file_curpos);\
+								if(fil[c][s].fptr != (samples[b][s].startOfData + voice[c].cache[s].file_curpos) ) g_error|=LSEEK_FPTR_MISMATCH;
 
 
 //
 //PLAYING_PERC envelopes:
 //
 float decay_amp_i[NUM_PLAY_CHAN];
-float decay_inc[NUM_PLAY_CHAN]={0,0};
+float decay_inc[NUM_PLAY_CHAN]={0};
 
 
 //
@@ -135,11 +130,13 @@ void audio_buffer_init(void)
 
 	SAMPLINGBYTES=2;
 
-	memory_clear();
-
 	init_rec_buff();
 
 	for ( chan=0; chan<NUM_PLAY_CHAN; chan++ ){
+
+		//voice[] is in CCM, which the startup code does not zero
+		memset(&voice[chan], 0, sizeof(Voice));
+
 		for ( i=0; i<NUM_SAMPLES_PER_BANK; i++ )
 		{
 			play_buff[chan][i] 				= &(splay_buff[chan][i]);
@@ -155,12 +152,7 @@ void audio_buffer_init(void)
 
 			play_buff[chan][i]->wrapping	= 0;
 
-			cache_map_pt[chan][i]		 	= play_buff[chan][i]->min;
-			cache_low[chan][i] 				= 0;
-			cache_high[chan][i] 			= 0;
-			cached_rev_state[chan][i]		= 0;
-			play_buff_bufferedamt[chan][i]	= 0;
-			is_buffered_to_file_end[chan][i]= 0;
+			voice[chan].cache[i].map_pt		= play_buff[chan][i]->min;
 		}
 	}
 
@@ -176,6 +168,17 @@ void toggle_reverse(uint8_t chan)
 	uint8_t samplenum, banknum;
 	enum PlayStates tplay_state;
 
+	//The play_buff holds the end of one pass of a streamed loop and the start of the next, which can't be reversed through:
+	//play from the opposite end instead
+	if (voice[chan].loop_wrap_pending)
+	{
+		if (i_param[chan][REV])	i_param[chan][REV] = 0;
+		else 					i_param[chan][REV] = 1;
+
+		start_playing(chan);
+		return;
+	}
+
 	if (play_state[chan] == PLAYING || play_state[chan]==PLAYING_PERC || play_state[chan] == PREBUFFERING || play_state[chan]==PLAY_FADEUP)
 	{
 		samplenum =sample_num_now_playing[chan];
@@ -196,7 +199,7 @@ void toggle_reverse(uint8_t chan)
 	if (tplay_state == PREBUFFERING || tplay_state==PLAY_FADEUP || tplay_state==PLAYING)
 	{
 		// If we just started playing, and then we get a reverse flag a short time afterwards,
-		// then we should not just reverse direction, but instead play from the opposite end (sample_file_endpos).
+		// then we should not just reverse direction, but instead play from the opposite end (file_endpos).
 		// The reason for this can be shown in the following patch:
 		// If the user fires two triggers into Play and Rev, it should play the sample backwards. 
 		// Then if the user fires those triggers again, it should play the sample forwards.
@@ -213,8 +216,8 @@ void toggle_reverse(uint8_t chan)
 		{
 			// See if the endpos is within the cache,
 			// Then we can just play from that point
-			if ((sample_file_endpos[chan] >= cache_low[chan][samplenum]) && (sample_file_endpos[chan] <= cache_high[chan][samplenum]))
-				play_buff[chan][samplenum]->out = map_cache_to_buffer(sample_file_endpos[chan], samples[banknum][samplenum].sampleByteSize, cache_low[chan][samplenum], cache_map_pt[chan][samplenum], play_buff[chan][samplenum]);
+			if ((voice[chan].file_endpos >= voice[chan].cache[samplenum].low) && (voice[chan].file_endpos <= voice[chan].cache[samplenum].high))
+				play_buff[chan][samplenum]->out = map_cache_to_buffer(voice[chan].file_endpos, samples[banknum][samplenum].sampleByteSize, voice[chan].cache[samplenum].low, voice[chan].cache[samplenum].map_pt, play_buff[chan][samplenum]);
 			else
 			{
 				//Otherwise we have to make a new cache, so run start_playing()
@@ -233,7 +236,7 @@ void toggle_reverse(uint8_t chan)
 
 	reverse_file_positions(chan, samplenum, banknum, i_param[chan][REV]);
 
-	cached_rev_state[chan][ i_param[chan][SAMPLE] ] = i_param[chan][REV];
+	voice[chan].cache[ i_param[chan][SAMPLE] ].rev_state = i_param[chan][REV];
 
 	play_state[chan] = tplay_state;
 }
@@ -243,17 +246,17 @@ void reverse_file_positions(uint8_t chan, uint8_t samplenum, uint8_t banknum, ui
 	uint32_t swap;
 	FRESULT res;
 
-	// Swap sample_file_curpos with cache_high or _low
+	// Swap file_curpos with cache.high or .low
 	// and move ->in to the equivalant address in play_buff
 	// This gets us ready to read new data to the opposite end of the cache.
 
 	if (new_dir) {
-		sample_file_curpos[chan][samplenum] = cache_low[chan][samplenum];
-		play_buff[chan][samplenum]->in		= cache_map_pt[chan][samplenum]; //cache_map_pt is the map of cache_low
+		voice[chan].cache[samplenum].file_curpos = voice[chan].cache[samplenum].low;
+		play_buff[chan][samplenum]->in		= voice[chan].cache[samplenum].map_pt; //map_pt is the map of cache.low
 	}
 	else {
-		sample_file_curpos[chan][samplenum] = cache_high[chan][samplenum];
-		play_buff[chan][samplenum]->in 		= map_cache_to_buffer(cache_high[chan][samplenum], samples[banknum][samplenum].sampleByteSize, cache_low[chan][samplenum], cache_map_pt[chan][samplenum], play_buff[chan][samplenum]);
+		voice[chan].cache[samplenum].file_curpos = voice[chan].cache[samplenum].high;
+		play_buff[chan][samplenum]->in 		= map_cache_to_buffer(voice[chan].cache[samplenum].high, samples[banknum][samplenum].sampleByteSize, voice[chan].cache[samplenum].low, voice[chan].cache[samplenum].map_pt, play_buff[chan][samplenum]);
 	}
 
 	// if (play_buff[chan][samplenum]->out < play_buff[chan][samplenum]->in)	play_buff[chan][samplenum]->wrapping = i_param[chan][REV]? 1 : 0;
@@ -261,9 +264,9 @@ void reverse_file_positions(uint8_t chan, uint8_t samplenum, uint8_t banknum, ui
 
 	//Swap the endpos with the startpos
 	//This way, curpos is always moving towards endpos and away from startpos
-	swap						= sample_file_endpos[chan];
-	sample_file_endpos[chan]	= sample_file_startpos[chan];
-	sample_file_startpos[chan]	= swap;
+	swap						= voice[chan].file_endpos;
+	voice[chan].file_endpos	= voice[chan].file_startpos;
+	voice[chan].file_startpos	= swap;
 
 	//Seek the starting position in the file 
 	//This gets us ready to start reading from the new position
@@ -286,7 +289,7 @@ void init_changed_bank(uint8_t chan)
 		res = f_close(&fil[chan][samplenum]);
 		if (res != FR_OK) fil[chan][samplenum].obj.fs = 0;
 
-		is_buffered_to_file_end[chan][samplenum] = 0;
+		voice[chan].cache[samplenum].is_buffered_to_file_end = 0;
 
 		CB_init(play_buff[chan][samplenum], 0);
 	}
@@ -297,7 +300,26 @@ void init_changed_bank(uint8_t chan)
 // Starts playing on a channel at the current param positions
 //
 
+static void begin_playing(uint8_t chan);
+
 void start_playing(uint8_t chan)
+{
+	voice[chan].start_sync = 0;
+	begin_playing(chan);
+}
+
+//
+// Starts playing so that the first frame is output when sys_tmr == start_tmr (used by the play trigger jacks)
+// The sync is set before the play state changes, so the audio IRQ never sees the new sound without it
+//
+void start_playing_at(uint8_t chan, uint32_t start_tmr)
+{
+	voice[chan].start_tmr = start_tmr;
+	voice[chan].start_sync = 1;
+	begin_playing(chan);
+}
+
+static void begin_playing(uint8_t chan)
 {
 	uint8_t samplenum, banknum;
 	Sample *s_sample;
@@ -310,7 +332,21 @@ void start_playing(uint8_t chan)
 	s_sample = &(samples[banknum][samplenum]);
 
 	if (s_sample->filename[0] == 0)
+	{
+		voice[chan].start_sync = 0;
 		return;
+	}
+
+	voice[chan].loop_wrap_pending = 0;
+	voice[chan].loop_point_pending = 0;
+	voice[chan].loop_xfade_frames = 0;
+	voice[chan].loop_stream_off = 0;
+
+	//Header was loaded from the header cache at boot: verify it the first time the sample is played
+	if (!s_sample->hdr_verified)
+	{
+		if (verify_sample_header(s_sample) != FR_OK)	{g_error |= FILE_WAVEFORMATERR; play_state[chan] = SILENT; return;}
+	}
 
 	sample_num_now_playing[chan] = samplenum;
 
@@ -323,9 +359,9 @@ void start_playing(uint8_t chan)
 	//
 	// Reload the sample file if necessary
 	//
-	if (flags[ForceFileReload1+chan] || fil[chan][samplenum].obj.fs==0)
+	if (force_file_reload[chan] || fil[chan][samplenum].obj.fs==0)
 	{
-		flags[ForceFileReload1+chan] = 0;
+		force_file_reload[chan] = 0;
 
 		res = reload_sample_file(&fil[chan][samplenum], s_sample);
 		if (res != FR_OK)	{g_error |= FILE_OPEN_FAIL;play_state[chan] = SILENT;return;}
@@ -346,9 +382,9 @@ void start_playing(uint8_t chan)
 				s_sample->inst_size = s_sample->sampleSize - s_sample->inst_start;
 		}
 
-		cache_low[chan][samplenum] 		= 0;
-		cache_high[chan][samplenum] 	= 0;
-		cache_map_pt[chan][samplenum] 	= play_buff[chan][samplenum]->min;
+		voice[chan].cache[samplenum].low 		= 0;
+		voice[chan].cache[samplenum].high 	= 0;
+		voice[chan].cache[samplenum].map_pt 	= play_buff[chan][samplenum]->min;
 	}
 
 
@@ -358,22 +394,22 @@ void start_playing(uint8_t chan)
 	//Determine starting and ending addresses
 	if (i_param[chan][REV])
 	{
-		sample_file_endpos[chan] = calc_start_point(f_param[chan][START], s_sample);
-		sample_file_startpos[chan] = calc_stop_point(f_param[chan][LENGTH], rs, s_sample, sample_file_endpos[chan]);
+		voice[chan].file_endpos = calc_start_point(f_param[chan][START], s_sample);
+		voice[chan].file_startpos = calc_stop_point(f_param[chan][LENGTH], rs, s_sample, voice[chan].file_endpos);
 	}
 	else
 	{
-		sample_file_startpos[chan] = calc_start_point(f_param[chan][START], s_sample);
-		sample_file_endpos[chan] = calc_stop_point(f_param[chan][LENGTH], rs, s_sample, sample_file_startpos[chan]);
+		voice[chan].file_startpos = calc_start_point(f_param[chan][START], s_sample);
+		voice[chan].file_endpos = calc_stop_point(f_param[chan][LENGTH], rs, s_sample, voice[chan].file_startpos);
 	}
 
 
 	//See if the starting position is already cached
-	if (   (cache_high[chan][samplenum] > cache_low[chan][samplenum]) 
-		&& (cache_low[chan][samplenum] <= sample_file_startpos[chan]) 
-		&& (sample_file_startpos[chan] <= cache_high[chan][samplenum]) )
+	if (   (voice[chan].cache[samplenum].high > voice[chan].cache[samplenum].low) 
+		&& (voice[chan].cache[samplenum].low <= voice[chan].file_startpos) 
+		&& (voice[chan].file_startpos <= voice[chan].cache[samplenum].high) )
 	{
-		play_buff[chan][samplenum]->out = map_cache_to_buffer(sample_file_startpos[chan], s_sample->sampleByteSize, cache_low[chan][samplenum], cache_map_pt[chan][samplenum], play_buff[chan][samplenum]);
+		play_buff[chan][samplenum]->out = map_cache_to_buffer(voice[chan].file_startpos, s_sample->sampleByteSize, voice[chan].cache[samplenum].low, voice[chan].cache[samplenum].map_pt, play_buff[chan][samplenum]);
 
 		if (f_param[chan][LENGTH] <= 0.5 && i_param[chan][REV])	play_state[chan] = PLAYING_PERC;
 		else													play_state[chan] = PLAY_FADEUP;
@@ -382,10 +418,15 @@ void start_playing(uint8_t chan)
 	else //...otherwise, start buffering from scratch
 	{
 		play_state[chan]=PREBUFFERING;
+		claim_play_buff_slot(chan, samplenum);
 		CB_init(play_buff[chan][samplenum], i_param[chan][REV]);
 
+		//A re-trigger may have handed the old sound to a tail voice that's still reading this slot: start past its data
+		play_buff[chan][samplenum]->in 	= tail_safe_buff_start(chan, samplenum, i_param[chan][REV]);
+		play_buff[chan][samplenum]->out = play_buff[chan][samplenum]->in;
+
 		//Seek to the file position where we will start reading
-		sample_file_curpos[chan][samplenum] 		= sample_file_startpos[chan];
+		voice[chan].cache[samplenum].file_curpos 		= voice[chan].file_startpos;
 		res = SET_FILE_POS(chan, banknum, samplenum);
 
 		//If seeking fails, perhaps we need to reload the file
@@ -401,14 +442,14 @@ void start_playing(uint8_t chan)
 		}
 		if (g_error & LSEEK_FPTR_MISMATCH)
 		{
-			sample_file_startpos[chan] = align_addr(f_tell(&fil[chan][samplenum]) - s_sample->startOfData, s_sample->blockAlign);
+			voice[chan].file_startpos = align_addr(f_tell(&fil[chan][samplenum]) - s_sample->startOfData, s_sample->blockAlign);
 		}
 
-		cache_low[chan][samplenum] 					= sample_file_startpos[chan];
-		cache_high[chan][samplenum] 				= sample_file_startpos[chan];
-		cache_map_pt[chan][samplenum] 				= play_buff[chan][samplenum]->min;
-		cache_size[chan][samplenum]					= (play_buff[chan][samplenum]->size>>1) * s_sample->sampleByteSize;
-		is_buffered_to_file_end[chan][samplenum] 	= 0;
+		voice[chan].cache[samplenum].low 					= voice[chan].file_startpos;
+		voice[chan].cache[samplenum].high 				= voice[chan].file_startpos;
+		voice[chan].cache[samplenum].map_pt 				= play_buff[chan][samplenum]->in;
+		voice[chan].cache[samplenum].size					= (play_buff[chan][samplenum]->size>>1) * s_sample->sampleByteSize;
+		voice[chan].cache[samplenum].is_buffered_to_file_end 	= 0;
 	}
 
 	last_play_start_tmr[chan]	= sys_tmr; //used by toggle_reverse() to see if we hit a reverse trigger right after a play trigger
@@ -449,6 +490,91 @@ void start_playing(uint8_t chan)
 //
 // Determines whether to start/restart/stop playing
 //
+static float calc_play_time(uint8_t chan, Sample *s_sample);
+static float calc_play_rs(uint8_t chan, Sample *s_sample);
+
+//
+// Returns 1 if a re-trigger can hand the current sound off to a tail voice.
+// The tail keeps fading out while the new sound pre-buffers: if the new start point isn't cached,
+// begin_playing() buffers it past the data the tail reads (see tail_safe_buff_start())
+//
+static uint8_t can_crossfade_retrigger(uint8_t chan)
+{
+	//A play trigger is pending: it hands off the sound when its delay is over (retrigger_playing_at())
+	if (flags[Play1TrigDelaying+chan]) return 0;
+
+	return (samples[ i_param[chan][BANK] ][ i_param[chan][SAMPLE] ].filename[0] != 0);
+}
+
+//
+// Hands the sound playing on chan off to a tail voice, if can_crossfade_retrigger() allows it.
+// Returns 1 if it did: the caller must start playing right away
+//
+static uint8_t hand_off_to_tail_voice(uint8_t chan)
+{
+	float gain;
+	Sample *s_sample;
+
+	if (!can_crossfade_retrigger(chan)) return 0;
+
+	s_sample = &(samples[ sample_bank_now_playing[chan] ][ sample_num_now_playing[chan] ]);
+
+	gain = s_sample->inst_gain * f_param[chan][VOLUME];
+	if ((play_state[chan]==PLAYING_PERC || play_state[chan]==PLAYING_PERC_FADEDOWN) && global_mode[PERC_ENVELOPE])
+		gain *= decay_amp_i[chan];
+
+	if (!start_tail_voice(chan, gain)) return 0;
+
+	flicker_endout(chan, calc_play_time(chan, s_sample));
+	return 1;
+}
+
+//
+// Re-triggers a channel that's playing: either hands the current sound off to a tail voice and starts the new one right away,
+// or (if that's not possible) fades down and then starts again
+//
+static void retrigger_playing(uint8_t chan)
+{
+	if (play_state[chan] == PAD_SILENCE && !flags[Play1TrigDelaying+chan])
+	{
+		start_playing(chan);
+		return;
+	}
+
+	if (hand_off_to_tail_voice(chan))
+	{
+		start_playing(chan);
+		return;
+	}
+
+	play_state[chan]=RETRIG_FADEDOWN;
+	play_led_state[chan]=0;
+}
+
+//
+// Starts playing at start_tmr when a play trigger's delay is over (see process_mode_flags()).
+// The sound that's still playing is handed off to a tail voice like retrigger_playing() does.
+// If that's not possible (no tail voice fits in TAIL_COST_BUDGET, or too little is buffered),
+// it fades down and the new one starts right after, without the sync start
+//
+void retrigger_playing_at(uint8_t chan, uint32_t start_tmr)
+{
+	if (play_state[chan]==PLAYING || play_state[chan]==PLAYING_PERC || play_state[chan]==PLAYING_PERC_FADEDOWN)
+	{
+		if (hand_off_to_tail_voice(chan))
+		{
+			start_playing_at(chan, start_tmr);
+			return;
+		}
+
+		play_state[chan]=RETRIG_FADEDOWN;
+		play_led_state[chan]=0;
+		return;
+	}
+
+	start_playing_at(chan, start_tmr);
+}
+
 void toggle_playing(uint8_t chan)
 {
 
@@ -462,18 +588,14 @@ void toggle_playing(uint8_t chan)
 	//Stop it if we're playing a full sample
 	else if (play_state[chan]==PLAYING && f_param[chan][LENGTH] > 0.98)
 	{
-		if (global_mode[LENGTH_FULL_START_STOP])	play_state[chan]=PLAY_FADEDOWN;
-		else 										play_state[chan]=RETRIG_FADEDOWN;
-		
-		play_led_state[chan]=0;
+		if (global_mode[LENGTH_FULL_START_STOP])	{play_state[chan]=PLAY_FADEDOWN; play_led_state[chan]=0;}
+		else 										retrigger_playing(chan);
 	}
 
 	//Re-start if we have a short length
 	else if (play_state[chan]==PLAYING_PERC || play_state[chan]==PLAYING || play_state[chan]==PAD_SILENCE  || play_state[chan]==PLAYING_PERC_FADEDOWN)
 	{
-		play_state[chan]=RETRIG_FADEDOWN;
-		play_led_state[chan]=0;
-
+		retrigger_playing(chan);
 	}
 
 
@@ -610,10 +732,10 @@ void check_change_sample(void)
 			flags[PlaySample1Changed+chan]=0;
 
 
-			if ( cached_rev_state[ chan ][ i_param[chan][SAMPLE] ] != i_param[chan][REV] )
+			if ( voice[ chan ].cache[ i_param[chan][SAMPLE] ].rev_state != i_param[chan][REV] )
 			{
 				reverse_file_positions(chan, i_param[chan][SAMPLE], i_param[chan][BANK], i_param[chan][REV]);
-				cached_rev_state[ chan ][ i_param[chan][SAMPLE] ] = i_param[chan][REV];
+				voice[ chan ].cache[ i_param[chan][SAMPLE] ].rev_state = i_param[chan][REV];
 			}
 
 			//FixMe: Clean up this logic:
@@ -652,7 +774,7 @@ void check_change_sample(void)
 				if (global_mode[AUTO_STOP_ON_SAMPLE_CHANGE]==AutoStop_ALWAYS)
 				{
 					if (play_state[chan] == SILENT && i_param[chan][LOOPING])
-						flags[Play1But+chan]=1;
+						post_event(EV_PLAY_BUT, chan);
 
 					if (play_state[chan] != SILENT && play_state[chan] != PREBUFFERING){
 						if (play_state[chan] == PLAYING_PERC)	play_state[chan] = PLAYING_PERC_FADEDOWN;
@@ -664,7 +786,7 @@ void check_change_sample(void)
 				{
 					if (i_param[chan][LOOPING]){
 						if (play_state[chan] == SILENT)
-							flags[Play1But+chan]=1;
+							post_event(EV_PLAY_BUT, chan);
 
 						else if (global_mode[AUTO_STOP_ON_SAMPLE_CHANGE]==AutoStop_LOOPING)
 						{
@@ -698,9 +820,264 @@ void check_change_sample(void)
 // 	}
 // }
 
+//
+// Calculate the amount to pre-buffer before we play:
+//
+//Note of interest: blockAlign already includes numChannels, so we essentially square it in the calc below.
+//The reason is that we plow through the bytes in play_buff twice as fast if it's stereo,
+//and since it takes twice as long to load stereo data from the sd card,
+//we have to preload four times as much data (2^2) vs (1^1)
+//
+//The resampling rate is the one that's played, limited by sdcard_speed.max_rs.
+//The result is limited to a quarter of the play_buff, so pre-buffering always ends, and there's room to read ahead
+//
+static uint32_t calc_pre_buff_size(uint8_t chan, Sample *s_sample)
+{
+	float pb_adjustment;
+	uint32_t pre_buff_size;
+
+	pb_adjustment = calc_play_rs(chan, s_sample);
+
+	pre_buff_size = (uint32_t)((float)(sdcard_speed.buffer_threshold * s_sample->blockAlign * s_sample->numChannels) * pb_adjustment);
+
+	//Time-stretch grains read ahead of play_buff->out
+	if (global_mode[TIME_STRETCH])
+		pre_buff_size += time_stretch_lookahead((float)s_sample->sampleRate / f_BASE_SAMPLE_RATE, s_sample->numChannels * 2);
+
+	if (pre_buff_size > (PLAY_BUFF_SLOT_SIZE / 4))
+		pre_buff_size = PLAY_BUFF_SLOT_SIZE / 4;
+
+	return pre_buff_size;
+}
+
+//
+// Fills order[] with the play channels sorted by how close their buffers are to running dry,
+// measured in pre_buff_size units so a channel playing faster (higher pitch or sample rate) counts as more urgent.
+// Channels that aren't reading from storage sort last
+//
+static void order_chans_by_urgency(uint8_t *order)
+{
+	uint8_t chan, i;
+	uint8_t samplenum;
+	uint32_t pre_buff_size;
+	float urgency[NUM_PLAY_CHAN];
+
+	for (chan=0;chan<NUM_PLAY_CHAN;chan++)
+	{
+		urgency[chan] = 1e9f;
+
+		if (play_state[chan] != SILENT && play_state[chan] != PLAY_FADEDOWN && play_state[chan] != RETRIG_FADEDOWN)
+		{
+			samplenum = sample_num_now_playing[chan];
+			pre_buff_size = calc_pre_buff_size(chan, &(samples[sample_bank_now_playing[chan]][samplenum]));
+			if (pre_buff_size)
+				urgency[chan] = (float)CB_distance(play_buff[chan][samplenum], i_param[chan][REV]) / (float)pre_buff_size;
+		}
+
+		//insertion sort, ascending by buffered amount
+		for (i=chan; i>0 && urgency[order[i-1]] > urgency[chan]; i--)
+			order[i] = order[i-1];
+		order[i] = chan;
+	}
+}
+
+//
+// Streamed loops:
+// When a sample loops forwards (and not with a percussive envelope), the reader doesn't stop at file_endpos.
+// It splices the next pass into the play_buff right after this one, so the audio IRQ plays one continuous stream:
+// the loop start is read ahead like any other data, the wrap needs no SD card access or pre-buffering,
+// and the loop period is exact. The START and LENGTH params are read again for each pass.
+//
+// The splice is crossfaded over global_mode[LOOP_CROSSFADE] ms, mixed into the play_buff as the next pass is written:
+// - If there's enough data before the loop start, the end of this pass fades into the frames just before the loop start
+// - Otherwise, if there's enough data after file_endpos, the frames after the end fade into the start of the next pass
+// - Otherwise (the whole sample loops), the end of this pass fades into the start of the next one, which shortens the period by the crossfade
+//
+// Loops that can't be streamed (reverse, percussive, too short, or the reader fell behind) fade down and restart, as before.
+//
+typedef struct LoopSplice {
+	uint32_t	startpos;		//file_startpos of the next pass
+	uint32_t	read_start;		//file position where the next pass is read from
+	uint32_t	splice_pos;		//file position in this pass where the next pass is written
+	uint32_t	read_end;		//file position where reading this pass stops
+	uint32_t	xfade_frames;
+	uint32_t	loop_pt_frames;	//frames from the splice point to the next pass's startpos
+} LoopSplice;
+
+//Shorter loops are restarted: the whole next pass would be read before playback reached this one's end
+static uint32_t calc_min_stream_loop_size(uint8_t chan, Sample *s_sample)
+{
+	uint32_t min_size;
+
+	min_size = calc_pre_buff_size(chan, s_sample);
+	if (min_size < (READ_BLOCK_SIZE*2))
+		min_size = READ_BLOCK_SIZE*2;
+
+	return min_size;
+}
+
+//
+// Calculates where the next pass of a loop is spliced in, for the current START param and file_endpos.
+// Returns 0 if the loop isn't streamed
+//
+static uint8_t calc_loop_splice(uint8_t chan, Sample *s_sample, LoopSplice *ls)
+{
+	uint32_t loop_size, xfade_bytes;
+
+	if (!i_param[chan][LOOPING] || i_param[chan][REV] || f_param[chan][LENGTH] <= 0.5f || voice[chan].loop_stream_off)
+		return 0;
+
+	if (play_state[chan] != PREBUFFERING && play_state[chan] != PLAY_FADEUP && play_state[chan] != PLAYING)
+		return 0;
+
+	if (voice[chan].file_endpos <= voice[chan].file_startpos)
+		return 0;
+
+	loop_size = voice[chan].file_endpos - voice[chan].file_startpos;
+	if (loop_size < calc_min_stream_loop_size(chan, s_sample))
+		return 0;
+
+	ls->xfade_frames = (global_mode[LOOP_CROSSFADE] * s_sample->sampleRate) / 1000;
+	if (ls->xfade_frames > LOOP_XFADE_MAX_FRAMES)
+		ls->xfade_frames = LOOP_XFADE_MAX_FRAMES;
+	if (ls->xfade_frames > (loop_size / (s_sample->blockAlign * 4)))
+		ls->xfade_frames = loop_size / (s_sample->blockAlign * 4);
+
+	xfade_bytes = ls->xfade_frames * s_sample->blockAlign;
+
+	ls->startpos 	= calc_start_point(f_param[chan][START], s_sample);
+	ls->read_start 	= ls->startpos;
+	ls->splice_pos 	= voice[chan].file_endpos;
+	ls->read_end 	= voice[chan].file_endpos;
+	ls->loop_pt_frames = 0;
+
+	if (ls->startpos >= (s_sample->inst_start + xfade_bytes))
+	{
+		ls->read_start -= xfade_bytes;
+		ls->splice_pos -= xfade_bytes;
+		ls->loop_pt_frames = ls->xfade_frames;
+	}
+	else if ((voice[chan].file_endpos + xfade_bytes) <= s_sample->inst_end)
+		ls->read_end += xfade_bytes;
+	else
+		ls->splice_pos -= xfade_bytes;
+
+	return 1;
+}
+
+//Moves a play_buff address ahead by amt, wrapping around the buffer
+static inline uint32_t offset_buff_addr(CircularBuffer *b, uint32_t addr, uint32_t amt)
+{
+	if ((b->max - addr) <= amt)	return addr - (b->size - amt);
+	else						return addr + amt;
+}
+
+//
+// Points the reader at the start of the next pass of a loop: play_buff->in goes back to the splice point,
+// the cache is re-mapped to the next pass, and the file seeks to its start.
+// The frames at the splice point are kept in loop_xfade_save[chan] for mix_loop_wrap().
+// Returns 1 if the loop wraps, or 0 if it can't be streamed (and will restart at the end)
+//
+static uint8_t begin_loop_wrap(uint8_t chan, uint8_t samplenum, uint8_t banknum, Sample *s_sample, LoopSplice *ls)
+{
+	CircularBuffer *b = play_buff[chan][samplenum];
+	SampleCache *cache = &voice[chan].cache[samplenum];
+	uint32_t splice_addr, endpos, margin, addr;
+	uint32_t i;
+	FRESULT res;
+
+	endpos = calc_stop_point(f_param[chan][LENGTH], calc_play_rs(chan, s_sample), s_sample, ls->startpos);
+
+	if (ls->splice_pos < cache->low || endpos <= ls->startpos || (endpos - ls->startpos) < calc_min_stream_loop_size(chan, s_sample))
+	{
+		voice[chan].loop_stream_off = 1;
+		return 0;
+	}
+
+	splice_addr = map_cache_to_buffer(ls->splice_pos, s_sample->sampleByteSize, cache->low, cache->map_pt, b);
+
+	//The next pass overwrites the play_buff from splice_addr, so playback must be well behind it
+	margin = calc_pre_buff_size(chan, s_sample) / 4;
+	if ((CB_distance_points(b->in, splice_addr, b->size, 0) + margin) >= CB_distance(b, 0))
+	{
+		voice[chan].loop_stream_off = 1;
+		return 0;
+	}
+
+	addr = splice_addr;
+	for (i=0; i<(ls->xfade_frames * s_sample->numChannels); i++)
+	{
+		while(SDRAM_IS_BUSY){;}
+		loop_xfade_save[chan][i] = *((int16_t *)addr);
+		addr = offset_buff_addr(b, addr, 2);
+	}
+
+	voice[chan].loop_xfade_addr 	= splice_addr;
+	voice[chan].loop_xfade_pos 		= 0;
+	voice[chan].loop_xfade_frames 	= ls->xfade_frames;
+
+	//Set these before re-mapping the cache, so the audio IRQ stops checking for the end of this pass
+	voice[chan].loop_point_addr 	= offset_buff_addr(b, splice_addr, ls->loop_pt_frames * s_sample->numChannels * 2);
+	voice[chan].loop_point_pending 	= 1;
+	voice[chan].loop_wrap_addr 		= splice_addr;
+	voice[chan].loop_wrap_pending 	= 1;
+
+	CB_offset_in_address(b, CB_distance_points(b->in, splice_addr, b->size, 0), 1);
+
+	cache->low 						= ls->read_start;
+	cache->high 					= ls->read_start;
+	cache->map_pt 					= splice_addr;
+	cache->file_curpos 				= ls->read_start;
+	cache->is_buffered_to_file_end 	= 0;
+
+	voice[chan].file_startpos 		= ls->startpos;
+	voice[chan].file_endpos 		= endpos;
+
+	res = SET_FILE_POS(chan, banknum, samplenum);
+	if (res != FR_OK) g_error |= FILE_SEEK_FAIL;
+
+	return 1;
+}
+
+//
+// Crossfades the frames kept by begin_loop_wrap() into the start of the next pass, as it's written after the splice point.
+// new_frames have just been written: a read shorter than the crossfade leaves the rest for the next read
+//
+static void mix_loop_wrap(uint8_t chan, uint8_t samplenum, Sample *s_sample, uint32_t new_frames)
+{
+	CircularBuffer *b = play_buff[chan][samplenum];
+	uint32_t addr;
+	uint32_t i, c, end;
+	int32_t w_in, w_out;
+	int16_t *save;
+
+	end = voice[chan].loop_xfade_pos + new_frames;
+	if (end > voice[chan].loop_xfade_frames) end = voice[chan].loop_xfade_frames;
+
+	save = &loop_xfade_save[chan][voice[chan].loop_xfade_pos * s_sample->numChannels];
+	addr = voice[chan].loop_xfade_addr;
+	for (i=voice[chan].loop_xfade_pos; i<end; i++)
+	{
+		w_in = (i << 15) / voice[chan].loop_xfade_frames;
+		w_out = 32768 - w_in;
+
+		for (c=0; c<s_sample->numChannels; c++)
+		{
+			while(SDRAM_IS_BUSY){;}
+			*((int16_t *)addr) = (*save++ * w_out + *((int16_t *)addr) * w_in) >> 15;
+			addr = offset_buff_addr(b, addr, 2);
+		}
+	}
+
+	voice[chan].loop_xfade_addr = addr;
+	voice[chan].loop_xfade_pos 	= end;
+}
+
 void read_storage_to_buffer(void)
 {
 	uint8_t chan=0;
+	uint8_t chan_i;
+	uint8_t read_order[NUM_PLAY_CHAN];
 	uint32_t err;
 
 	FRESULT res;
@@ -715,16 +1092,21 @@ void read_storage_to_buffer(void)
 	FSIZE_t t_fptr;
 	uint32_t pre_buff_size;
 	uint32_t active_buff_size;
-	float pb_adjustment;
+	LoopSplice loop_splice;
+	uint8_t is_loop_streamed;
+	uint32_t read_end;
 
 
 	check_change_sample();
-	check_change_bank(0);
-	check_change_bank(1);
+	for (chan=0;chan<NUM_PLAY_CHAN;chan++)
+		check_change_bank(chan);
+
+	order_chans_by_urgency(read_order);
 
 	// DEBUG0_ON;
-	for (chan=0;chan<NUM_PLAY_CHAN;chan++)
+	for (chan_i=0;chan_i<NUM_PLAY_CHAN;chan_i++)
 	{
+		chan = read_order[chan_i];
 
 		if (play_state[chan] != SILENT && play_state[chan] != PLAY_FADEDOWN && play_state[chan] != RETRIG_FADEDOWN)
 		{
@@ -732,8 +1114,8 @@ void read_storage_to_buffer(void)
 			banknum = sample_bank_now_playing[chan];
 			s_sample = &(samples[banknum][samplenum]);
 
-			//FixMe: Calculate play_buff_bufferedamt after play_buff changes, not here
-			play_buff_bufferedamt[chan][samplenum] = CB_distance(play_buff[chan][samplenum], i_param[chan][REV]);
+			//FixMe: Calculate bufferedamt after play_buff changes, not here
+			voice[chan].cache[samplenum].bufferedamt = CB_distance(play_buff[chan][samplenum], i_param[chan][REV]);
 
 			//
 			//Try to recover from a file read error
@@ -752,37 +1134,36 @@ void read_storage_to_buffer(void)
 			else //If no file read error... [?? FixMe: does this logic make sense for clearing is_buffered_to_file_end ???]
 			{
 
-				if ( (!i_param[chan][REV] && (sample_file_curpos[chan][samplenum] < s_sample->inst_end))
-				 	|| (i_param[chan][REV] && (sample_file_curpos[chan][samplenum] > s_sample->inst_start)) )
-					is_buffered_to_file_end[chan][samplenum] = 0;
+				if ( (!i_param[chan][REV] && (voice[chan].cache[samplenum].file_curpos < s_sample->inst_end))
+				 	|| (i_param[chan][REV] && (voice[chan].cache[samplenum].file_curpos > s_sample->inst_start)) )
+					voice[chan].cache[samplenum].is_buffered_to_file_end = 0;
 			}
 
-			//
-			// Calculate the amount to pre-buffer before we play:
-			//
-			pb_adjustment = f_param[chan][PITCH] * (float)s_sample->sampleRate / f_BASE_SAMPLE_RATE ;
-
-			//Calculate how many bytes we need to pre-load in our buffer
-			//
-			//Note of interest: blockAlign already includes numChannels, so we essentially square it in the calc below.
-			//The reason is that we plow through the bytes in play_buff twice as fast if it's stereo,
-			//and since it takes twice as long to load stereo data from the sd card,
-			//we have to preload four times as much data (2^2) vs (1^1)
-			//
-			pre_buff_size = (uint32_t)((float)(BASE_BUFFER_THRESHOLD * s_sample->blockAlign * s_sample->numChannels) * pb_adjustment);
+			pre_buff_size = calc_pre_buff_size(chan, s_sample);
 			active_buff_size = pre_buff_size * 4;
 
 			if (active_buff_size > ((play_buff[chan][samplenum]->size * 7) / 10) ) //limit amount of buffering ahead to 90% of buffer size
 				active_buff_size = ((play_buff[chan][samplenum]->size * 7) / 10);
 
-			if (!is_buffered_to_file_end[chan][samplenum] && 
+			//A streamed loop is read up to the splice point, and then wraps once playback has reached the previous wrap
+			is_loop_streamed = calc_loop_splice(chan, s_sample, &loop_splice);
+
+			if ((!voice[chan].cache[samplenum].is_buffered_to_file_end
+					|| (is_loop_streamed && !voice[chan].loop_wrap_pending && voice[chan].cache[samplenum].file_curpos >= loop_splice.read_end)) && 
 				(
-					(play_state[chan]==PREBUFFERING && (play_buff_bufferedamt[chan][samplenum] < pre_buff_size)) ||
-					(play_state[chan]!=PREBUFFERING && (play_buff_bufferedamt[chan][samplenum] < active_buff_size))
+					(play_state[chan]==PREBUFFERING && (voice[chan].cache[samplenum].bufferedamt < pre_buff_size)) ||
+					(play_state[chan]!=PREBUFFERING && (voice[chan].cache[samplenum].bufferedamt < active_buff_size))
 				))
 			{
+				if (is_loop_streamed && !voice[chan].loop_wrap_pending && voice[chan].cache[samplenum].file_curpos >= loop_splice.read_end)
+				{
+					begin_loop_wrap(chan, samplenum, banknum, s_sample, &loop_splice);
+
+					//Re-calculate for the next pass
+					is_loop_streamed = calc_loop_splice(chan, s_sample, &loop_splice);
+				}
 
-				if (sample_file_curpos[chan][samplenum] > s_sample->sampleSize) //we read too much data somehow //When does this happen? sample_file_curpos has not changed recently...
+				if (voice[chan].cache[samplenum].file_curpos > s_sample->sampleSize) //we read too much data somehow //When does this happen? file_curpos has not changed recently...
 				{
 					g_error |= FILE_WAVEFORMATERR;
 					play_state[chan] = SILENT;
@@ -790,9 +1171,9 @@ void read_storage_to_buffer(void)
 				}
 
 
-				else if (sample_file_curpos[chan][samplenum] > s_sample->inst_end)
+				else if (voice[chan].cache[samplenum].file_curpos > s_sample->inst_end)
 				{
-					is_buffered_to_file_end[chan][samplenum] = 1;
+					voice[chan].cache[samplenum].is_buffered_to_file_end = 1;
 				}
 
 				else
@@ -802,7 +1183,12 @@ void read_storage_to_buffer(void)
 					//
 					if (i_param[chan][REV]==0)
 					{
-						rd = s_sample->inst_end -  sample_file_curpos[chan][samplenum];
+						read_end = is_loop_streamed ? loop_splice.read_end : s_sample->inst_end;
+
+						if (read_end > voice[chan].cache[samplenum].file_curpos)
+							rd = read_end - voice[chan].cache[samplenum].file_curpos;
+						else
+							rd = 0;
 
 						if (rd > READ_BLOCK_SIZE) rd = READ_BLOCK_SIZE;
 
@@ -810,22 +1196,22 @@ void read_storage_to_buffer(void)
 						if (res != FR_OK) 
 						{
 							g_error |= FILE_READ_FAIL_1 << chan; 
-							is_buffered_to_file_end[chan][samplenum] = 1; //FixMe: Do we really want to set this in case of disk error? We don't when reversing.
+							voice[chan].cache[samplenum].is_buffered_to_file_end = 1; //FixMe: Do we really want to set this in case of disk error? We don't when reversing.
 						}
 
 
 						if (br < rd)
 						{
 							g_error |= FILE_UNEXPECTEDEOF; //unexpected end of file, but we can continue writing out the data we read
-							is_buffered_to_file_end[chan][samplenum] = 1; 
+							voice[chan].cache[samplenum].is_buffered_to_file_end = 1; 
 						}
 
-						//sample_file_curpos[chan][samplenum] += br;
-						sample_file_curpos[chan][samplenum] = f_tell(&fil[chan][samplenum]) - s_sample->startOfData;
+						//voice[chan].cache[samplenum].file_curpos += br;
+						voice[chan].cache[samplenum].file_curpos = f_tell(&fil[chan][samplenum]) - s_sample->startOfData;
 
-						if (sample_file_curpos[chan][samplenum] >= s_sample->inst_end)
+						if (voice[chan].cache[samplenum].file_curpos >= s_sample->inst_end)
 						{
-							is_buffered_to_file_end[chan][samplenum] = 1;
+							voice[chan].cache[samplenum].is_buffered_to_file_end = 1;
 						}
 
 					}
@@ -835,8 +1221,8 @@ void read_storage_to_buffer(void)
 					//
 					else
 					{
-						if (sample_file_curpos[chan][samplenum] > s_sample->inst_start)
-							rd = sample_file_curpos[chan][samplenum] - s_sample->inst_start;
+						if (voice[chan].cache[samplenum].file_curpos > s_sample->inst_start)
+							rd = voice[chan].cache[samplenum].file_curpos - s_sample->inst_start;
 						else
 							rd = 0;
 
@@ -851,7 +1237,7 @@ void read_storage_to_buffer(void)
 							if (res || (f_tell(&fil[chan][samplenum])!=(t_fptr - READ_BLOCK_SIZE)))
 								g_error |= LSEEK_FPTR_MISMATCH;
 							
-							sample_file_curpos[chan][samplenum] = f_tell(&fil[chan][samplenum]) - s_sample->startOfData;
+							voice[chan].cache[samplenum].file_curpos = f_tell(&fil[chan][samplenum]) - s_sample->startOfData;
 
 						}
 						else //rd < READ_BLOCK_SIZE: read the first block (which is the last to be read, since we're reversing)
@@ -860,12 +1246,12 @@ void read_storage_to_buffer(void)
 							//align rd to 24
 
 							//Jump to the beginning
-							sample_file_curpos[chan][samplenum] = s_sample->inst_start;
+							voice[chan].cache[samplenum].file_curpos = s_sample->inst_start;
 							res = SET_FILE_POS(chan, banknum, samplenum);
 							if (res!=FR_OK)
 								g_error |= FILE_SEEK_FAIL;
 
-							is_buffered_to_file_end[chan][samplenum] = 1;
+							voice[chan].cache[samplenum].is_buffered_to_file_end = 1;
 						}
 
 						//Read one block forward
@@ -929,26 +1315,29 @@ void read_storage_to_buffer(void)
 							//
 							CB_offset_in_address(play_buff[chan][samplenum], (rd * 2) / s_sample->sampleByteSize, 1);
 
-							cache_low[chan][samplenum] 		= sample_file_curpos[chan][samplenum]; 
-							cache_map_pt[chan][samplenum] 	= play_buff[chan][samplenum]->in;
+							voice[chan].cache[samplenum].low 		= voice[chan].cache[samplenum].file_curpos; 
+							voice[chan].cache[samplenum].map_pt 	= play_buff[chan][samplenum]->in;
 
-							if ((cache_high[chan][samplenum] - cache_low[chan][samplenum]) > cache_size[chan][samplenum])
-								 cache_high[chan][samplenum] = cache_low[chan][samplenum] + cache_size[chan][samplenum];
+							if ((voice[chan].cache[samplenum].high - voice[chan].cache[samplenum].low) > voice[chan].cache[samplenum].size)
+								 voice[chan].cache[samplenum].high = voice[chan].cache[samplenum].low + voice[chan].cache[samplenum].size;
 						} 
 						else {
 
-							cache_high[chan][samplenum] 		= sample_file_curpos[chan][samplenum];
+							voice[chan].cache[samplenum].high 		= voice[chan].cache[samplenum].file_curpos;
 
-							if ((cache_high[chan][samplenum] - cache_low[chan][samplenum]) > cache_size[chan][samplenum])
+							if ((voice[chan].cache[samplenum].high - voice[chan].cache[samplenum].low) > voice[chan].cache[samplenum].size)
 							{
-								cache_map_pt[chan][samplenum] 	= play_buff[chan][samplenum]->in;
-								cache_low[chan][samplenum] 		= cache_high[chan][samplenum] - cache_size[chan][samplenum];
+								voice[chan].cache[samplenum].map_pt 	= play_buff[chan][samplenum]->in;
+								voice[chan].cache[samplenum].low 		= voice[chan].cache[samplenum].high - voice[chan].cache[samplenum].size;
 							}
 						}
 
 						if (err)
 							g_error |= READ_BUFF1_OVERRUN<<chan;
 
+						if (voice[chan].loop_xfade_pos < voice[chan].loop_xfade_frames && !i_param[chan][REV])
+							mix_loop_wrap(chan, samplenum, s_sample, br / s_sample->blockAlign);
+
 					}
 
 				}
@@ -956,7 +1345,7 @@ void read_storage_to_buffer(void)
 			}
 
 			//Check if we've prebuffered enough to start playing
-			if ((is_buffered_to_file_end[chan][samplenum] || play_buff_bufferedamt[chan][samplenum] >= pre_buff_size) && play_state[chan] == PREBUFFERING)
+			if ((voice[chan].cache[samplenum].is_buffered_to_file_end || voice[chan].cache[samplenum].bufferedamt >= pre_buff_size) && play_state[chan] == PREBUFFERING)
 			{
 				if (f_param[chan][LENGTH] <= 0.5 && i_param[chan][REV])
 					play_state[chan] = PLAYING_PERC;
@@ -994,14 +1383,173 @@ inline int32_t	calc_dist_to_end(uint8_t chan, uint8_t samplenum, uint8_t banknum
 	uint32_t sample_file_playpos;
 
 	//Find out where the audio output data is relative to the start of the cache
-	sample_file_playpos = map_buffer_to_cache(play_buff[chan][samplenum]->out, samples[banknum][samplenum].sampleByteSize, cache_low[chan][samplenum], cache_map_pt[chan][samplenum], play_buff[chan][samplenum]); 
+	sample_file_playpos = map_buffer_to_cache(play_buff[chan][samplenum]->out, samples[banknum][samplenum].sampleByteSize, voice[chan].cache[samplenum].low, voice[chan].cache[samplenum].map_pt, play_buff[chan][samplenum]); 
 
 	//Calculate the distance left to the end that we should be playing
-	if (!i_param[chan][REV]) 	return (sample_file_endpos[chan] - sample_file_playpos);
-	else 						return (sample_file_playpos - sample_file_endpos[chan]);
+	if (!i_param[chan][REV]) 	return (voice[chan].file_endpos - sample_file_playpos);
+	else 						return (sample_file_playpos - voice[chan].file_endpos);
+
+}
+
 
+//
+// Playback bounds (stop point and play time) for each channel
+// update_play_bounds() runs in the param update IRQ, and re-calculates them only when the LENGTH or PITCH params,
+// the sample, the direction or the start point change. It writes to the buffer that's not being read,
+// and then flips play_bounds_rd[], so play_audio_from_buffer() always reads a complete set.
+//
+typedef struct PlayBounds {
+	uint32_t	anchor;		//position the stop point is calculated from: file_startpos (or file_endpos in reverse)
+	uint32_t	stop_pos;
+	float		play_time;
+	float		length;
+	float		pitch;
+	uint8_t		banknum;
+	uint8_t		samplenum;
+	uint8_t		rev;
+} PlayBounds;
+
+static PlayBounds 			play_bounds[NUM_PLAY_CHAN][2];
+static volatile uint8_t 	play_bounds_rd[NUM_PLAY_CHAN];
+
+static inline uint32_t play_bounds_anchor(uint8_t chan)
+{
+	return i_param[chan][REV] ? voice[chan].file_endpos : voice[chan].file_startpos;
+}
+
+static uint8_t is_play_bounds_current(PlayBounds *pb, uint8_t chan)
+{
+	return (	pb->anchor 		== play_bounds_anchor(chan)
+			&& 	pb->rev 		== i_param[chan][REV]
+			&& 	pb->samplenum 	== sample_num_now_playing[chan]
+			&& 	pb->banknum 	== sample_bank_now_playing[chan]
+			&& 	pb->length 		== f_param[chan][LENGTH]
+			&& 	pb->pitch 		== f_param[chan][PITCH]	);
 }
 
+//Resampling rate, limited to what the resampler can read per block
+static float calc_play_rs(uint8_t chan, Sample *s_sample)
+{
+	float rs;
+
+	if (s_sample->sampleRate == BASE_SAMPLE_RATE)	rs = f_param[chan][PITCH];
+	else											rs = f_param[chan][PITCH] * ((float)s_sample->sampleRate / f_BASE_SAMPLE_RATE);
+
+	if (global_mode[STEREO_MODE])
+	{
+		if ((rs*s_sample->numChannels)>sdcard_speed.max_rs)
+			rs = sdcard_speed.max_rs / (float)s_sample->numChannels;
+	}
+	else if (rs>sdcard_speed.max_rs)
+		rs = sdcard_speed.max_rs;
+
+	return rs;
+}
+
+static float calc_play_time(uint8_t chan, Sample *s_sample)
+{
+	uint32_t dist;
+
+	if (i_param[chan][REV])	dist = voice[chan].file_startpos - voice[chan].file_endpos;
+	else					dist = voice[chan].file_endpos - voice[chan].file_startpos;
+
+	return (dist / (s_sample->blockAlign * s_sample->sampleRate * f_param[chan][PITCH]));
+}
+
+//
+// Called from update_params()
+//
+void update_play_bounds(uint8_t chan)
+{
+	PlayBounds 	*pb;
+	Sample 		*s_sample;
+	uint8_t 	wr;
+
+	if (play_state[chan] == SILENT || play_state[chan] == PREBUFFERING) return;
+
+	if (is_play_bounds_current(&play_bounds[chan][play_bounds_rd[chan]], chan)) return;
+
+	wr = play_bounds_rd[chan] ? 0 : 1;
+	pb = &play_bounds[chan][wr];
+
+	pb->anchor 		= play_bounds_anchor(chan);
+	pb->rev 		= i_param[chan][REV];
+	pb->samplenum 	= sample_num_now_playing[chan];
+	pb->banknum 	= sample_bank_now_playing[chan];
+	pb->length 		= f_param[chan][LENGTH];
+	pb->pitch 		= f_param[chan][PITCH];
+
+	s_sample 		= &samples[pb->banknum][pb->samplenum];
+	pb->stop_pos 	= calc_stop_point(pb->length, calc_play_rs(chan, s_sample), s_sample, pb->anchor);
+
+	//In reverse, the stop point is file_startpos and the anchor is file_endpos, so it's the same calculation
+	pb->play_time 	= (pb->stop_pos - pb->anchor) / (s_sample->blockAlign * s_sample->sampleRate * pb->pitch);
+
+	play_bounds_rd[chan] = wr;
+}
+
+//
+// Fade up/down ramps are FADE_FRAMES long whatever the block size is:
+// a fade up ramps over the start of the block and then holds the gain,
+// a fade down holds the gain and then ramps over the end of the block
+//
+static void apply_fade(int32_t *outL, int32_t *outR, int32_t g_start, int32_t g_end, uint8_t fade_at_end)
+{
+	uint32_t hold = HT16_CHAN_BUFF_LEN - FADE_FRAMES;
+
+	if (!hold || g_start == g_end)
+		apply_gain_ramp(outL, outR, HT16_CHAN_BUFF_LEN, g_start, g_end);
+
+	else if (fade_at_end)
+	{
+		apply_gain_ramp(outL, outR, hold, g_start, g_start);
+		apply_gain_ramp(outL + hold, outR ? (outR + hold) : 0, FADE_FRAMES, g_start, g_end);
+	}
+	else
+	{
+		apply_gain_ramp(outL, outR, FADE_FRAMES, g_start, g_end);
+		apply_gain_ramp(outL + FADE_FRAMES, outR ? (outR + FADE_FRAMES) : 0, hold, g_end, g_end);
+	}
+}
+
+//
+// Frames from the start of this audio block until a sync start (start_playing_at()) should be output.
+// HT16_CHAN_BUFF_LEN or more means it starts in a later block. 0 if there's no sync start, or it's late
+//
+static uint32_t calc_sync_start_offset(uint8_t chan)
+{
+	int32_t offset;
+
+	if (!voice[chan].start_sync || (play_state[chan] != PLAY_FADEUP && play_state[chan] != PLAYING_PERC))
+		return 0;
+
+	offset = (int32_t)(voice[chan].start_tmr - get_audio_block_tmr());
+
+	if (offset <= 0 || offset > TRIG_SYNC_MAX_WAIT)
+		offset = 0;
+
+	if (offset < HT16_CHAN_BUFF_LEN)
+		voice[chan].start_sync = 0;
+
+	return offset;
+}
+
+//Moves the block later by offset frames, with silence before it. The last offset frames are dropped (they were not rendered)
+static void delay_block_start(int32_t *outL, int32_t *outR, uint32_t offset)
+{
+	int32_t i;
+
+	for (i=HT16_CHAN_BUFF_LEN-1; i>=(int32_t)offset; i--)
+	{
+		outL[i] = outL[i-offset];
+		outR[i] = outR[i-offset];
+	}
+	for (; i>=0; i--)
+	{
+		outL[i] = 0;
+		outR[i] = 0;
+	}
+}
 
 void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 {
@@ -1011,13 +1559,20 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 	uint8_t t_flag;
 
 	//Resampling:
-	float rs;
+	float rs, rs_start, rs_step;
 	uint32_t resampled_buffer_size;
 	int32_t resampled_cache_size;
+	uint32_t ts_lookahead;
+	uint32_t start_offset, render_len;
 
 	float gain;
+	int32_t g_start, g_end;
+	int32_t *outR_env;
 	float play_time;
+	PlayBounds *pb;
 	int32_t dist_to_end;
+	uint32_t dist_to_wrap;
+	uint8_t at_end, at_loop_point;
 
 	//convenience variables
 	float length;
@@ -1026,8 +1581,12 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 
 	// DEBUG0_ON;
 
+	//A triggered sound may start part-way into this block, or in a later one
+	start_offset = calc_sync_start_offset(chan);
+	at_loop_point = 0;
+
 	// Fill buffer with silence
-	if (play_state[chan] == PREBUFFERING || play_state[chan] == SILENT)
+	if (play_state[chan] == PREBUFFERING || play_state[chan] == SILENT || start_offset >= HT16_CHAN_BUFF_LEN)
 	{
 		for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
 		{
@@ -1042,9 +1601,15 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 		s_sample = &(samples[banknum][samplenum]);
 
 		//Calculate our actual resampling rate, based on the sample rate of the file being played
+		//The rate ramps from rs_start to rs across the block, following the pitch CV (see update_pitch_cv())
 
-		if (s_sample->sampleRate == BASE_SAMPLE_RATE)	rs = f_param[chan][PITCH];
-		else											rs = f_param[chan][PITCH] * ((float)s_sample->sampleRate / f_BASE_SAMPLE_RATE);
+		rs 			= f_param[chan][PITCH];
+		rs_start 	= block_start_pitch[chan];
+		if (s_sample->sampleRate != BASE_SAMPLE_RATE)
+		{
+			rs 			*= (float)s_sample->sampleRate / f_BASE_SAMPLE_RATE;
+			rs_start 	*= (float)s_sample->sampleRate / f_BASE_SAMPLE_RATE;
+		}
 
 
 		// FixMe: Consider moving this to a new function that's called after play_audio_buffer()
@@ -1052,11 +1617,44 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 		//	
 		if (play_state[chan] == PLAYING || play_state[chan] == PLAY_FADEUP || play_state[chan] == PLAYING_PERC)
 		{
-			resampled_buffer_size = calc_resampled_buffer_size(chan, samplenum, banknum, rs);				// Amount play_buff[]->out changes with each audio block sent to the codec
+			resampled_buffer_size = calc_resampled_buffer_size(chan, samplenum, banknum, (rs > rs_start) ? rs : rs_start);				// Amount play_buff[]->out changes with each audio block sent to the codec
 			resampled_cache_size = calc_resampled_cache_size(samplenum, banknum, resampled_buffer_size);	// Amount an imaginary pointer in the sample file would move with each audio block sent to the codec			
-			dist_to_end = calc_dist_to_end(chan, samplenum, banknum);										// Amount in the sample file we have remaining before we hit sample_file_endpos
 
-			if (dist_to_end < resampled_cache_size*2)														//See if we are about to surpass the calculated position in the file where we should end our sample
+			//A streamed loop's next pass follows this one in the play_buff (see begin_loop_wrap()): play on into it
+			if (voice[chan].loop_wrap_pending)
+			{
+				dist_to_wrap = CB_distance_points(voice[chan].loop_wrap_addr, play_buff[chan][samplenum]->out, play_buff[chan][samplenum]->size, 0);
+				if (dist_to_wrap <= resampled_buffer_size)
+					voice[chan].loop_wrap_pending = 0;
+			}
+
+			//The next pass's start point can be after the splice, by the crossfade
+			if (voice[chan].loop_point_pending
+				&& CB_distance_points(voice[chan].loop_point_addr, play_buff[chan][samplenum]->out, play_buff[chan][samplenum]->size, 0) <= resampled_buffer_size)
+			{
+				voice[chan].loop_point_pending = 0;
+				at_loop_point = 1;
+			}
+
+			//Time-stretch grains read ahead of play_buff->out, so they must fade before the speed pointer reaches the end
+			if (global_mode[TIME_STRETCH])
+			{
+				ts_lookahead = time_stretch_lookahead((float)s_sample->sampleRate / f_BASE_SAMPLE_RATE, s_sample->numChannels * 2);
+				resampled_buffer_size += ts_lookahead;
+				resampled_cache_size += calc_resampled_cache_size(samplenum, banknum, ts_lookahead);
+			}
+
+			//See if we are about to surpass the calculated position in the file where we should end our sample
+			//If looping was turned off after the next pass of a streamed loop was buffered, the end is the wrap point
+			if (voice[chan].loop_wrap_pending)
+				at_end = !i_param[chan][LOOPING] && (dist_to_wrap < resampled_buffer_size*2);
+			else
+			{
+				dist_to_end = calc_dist_to_end(chan, samplenum, banknum);									// Amount in the sample file we have remaining before we hit file_endpos
+				at_end = (dist_to_end < resampled_cache_size*2);
+			}
+
+			if (at_end)
 			{	
 				if (flags[ChangePlaytoPerc1+chan]){		play_state[chan] = PLAY_FADEDOWN;					//If we just changed from PLAYING to PLAYING_PERC then, do a normal Fadedown or else we'll get annoying PAD_SILENCE
 														flags[ChangePlaytoPerc1+chan]=0;}
@@ -1067,9 +1665,9 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 			}
 			else {
 				//Check if we are about to hit buffer underrun
-				play_buff_bufferedamt[chan][samplenum] = CB_distance(play_buff[chan][samplenum], i_param[chan][REV]);
+				voice[chan].cache[samplenum].bufferedamt = CB_distance(play_buff[chan][samplenum], i_param[chan][REV]);
 
-				if (!is_buffered_to_file_end[chan][samplenum] && play_buff_bufferedamt[chan][samplenum] <= resampled_buffer_size)
+				if (!voice[chan].cache[samplenum].is_buffered_to_file_end && voice[chan].cache[samplenum].bufferedamt <= resampled_buffer_size)
 					{
 						g_error |= READ_BUFF1_UNDERRUN<<chan;
 						check_errors();
@@ -1080,85 +1678,113 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 
 		//
 		//Resample data read from the play_buff and store into out[]
+		//Only the frames after start_offset are read: delay_block_start() moves them into place after the envelope
 		//
+		render_len = HT16_CHAN_BUFF_LEN - start_offset;
 
-		if (global_mode[STEREO_MODE])
+		if (global_mode[TIME_STRETCH])
 		{
-			if ((rs*s_sample->numChannels)>MAX_RS)
-				rs = MAX_RS / (float)s_sample->numChannels;
+			if (rs>sdcard_speed.max_rs)
+				rs = sdcard_speed.max_rs;
+
+			if (flags[PlayBuff1_Discontinuity+chan])
+			{
+				flags[PlayBuff1_Discontinuity+chan] = 0;
+				reset_time_stretch(&voice[chan].ts, play_buff[chan][samplenum]);
+			}
+
+			time_stretch_read(&voice[chan].ts, play_buff[chan][samplenum], rs, (float)s_sample->sampleRate / f_BASE_SAMPLE_RATE,
+								s_sample->numChannels * 2, i_param[chan][REV], global_mode[STEREO_MODE], outL, outR, render_len);
+		}
+		else if (global_mode[STEREO_MODE])
+		{
+			if ((rs*s_sample->numChannels)>sdcard_speed.max_rs)
+				rs = sdcard_speed.max_rs / (float)s_sample->numChannels;
+			if ((rs_start*s_sample->numChannels)>sdcard_speed.max_rs)
+				rs_start = sdcard_speed.max_rs / (float)s_sample->numChannels;
+
+			rs_step = (rs - rs_start) / (float)render_len;
 
 			if (s_sample->numChannels == 2)
 			{
 				t_u32 = play_buff[chan][samplenum]->out;
 				t_flag = flags[PlayBuff1_Discontinuity+chan];
-				resample_read16_left(rs, play_buff[chan][samplenum], HT16_CHAN_BUFF_LEN, 4, chan, outL);
+				resample_read16_left(rs_start, rs_step, play_buff[chan][samplenum], render_len, 4, chan, outL);
 
 				play_buff[chan][samplenum]->out = t_u32;
 				flags[PlayBuff1_Discontinuity+chan] = t_flag;
-				resample_read16_right(rs, play_buff[chan][samplenum], HT16_CHAN_BUFF_LEN, 4, chan, outR);
+				resample_read16_right(rs_start, rs_step, play_buff[chan][samplenum], render_len, 4, chan, outR);
 			}
 			else	//MONO: read left channel and copy to right
 			{
-				resample_read16_left(rs, play_buff[chan][samplenum], HT16_CHAN_BUFF_LEN, 2, chan, outL);
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++) outR[i] = outL[i];
+				resample_read16_left(rs_start, rs_step, play_buff[chan][samplenum], render_len, 2, chan, outL);
+				for (i=0;i<render_len;i++) outR[i] = outL[i];
 			}
 		}
 		else //not STEREO_MODE:
 		{
-			if (rs>(MAX_RS))
-				rs = (MAX_RS);
+			if (rs>sdcard_speed.max_rs)
+				rs = sdcard_speed.max_rs;
+			if (rs_start>sdcard_speed.max_rs)
+				rs_start = sdcard_speed.max_rs;
+
+			rs_step = (rs - rs_start) / (float)render_len;
 
 			if (s_sample->numChannels == 2)
-				resample_read16_avg(rs, play_buff[chan][samplenum], HT16_CHAN_BUFF_LEN, 4, chan, outL);
+				resample_read16_avg(rs_start, rs_step, play_buff[chan][samplenum], render_len, 4, chan, outL);
 			else
-				resample_read16_left(rs, play_buff[chan][samplenum], HT16_CHAN_BUFF_LEN, 2, chan, outL);
+				resample_read16_left(rs_start, rs_step, play_buff[chan][samplenum], render_len, 2, chan, outL);
 
 		}
 
-		//Calculate length and where to stop playing
 		length = f_param[chan][LENGTH];
 		gain = s_sample->inst_gain * f_param[chan][VOLUME];
 
-		//Update the start/endpos based on the length parameter
-		//Update the play_time (used to calculate led flicker and END OUT pulse width
-		//ToDo: we should do this in update_params
+		//Update the start/endpos based on the length parameter, and the play_time (used to calculate led flicker and END OUT pulse width)
+		//These are calculated by update_play_bounds() in the param update IRQ, and only used here if they were calculated
+		//for what's playing now. Otherwise we keep the stop point that start_playing() or toggle_reverse() set.
 		//
-		if (i_param[chan][REV])
+		pb = &play_bounds[chan][play_bounds_rd[chan]];
+		if (is_play_bounds_current(pb, chan))
 		{
-			sample_file_startpos[chan] = calc_stop_point(length, rs, &samples[banknum][samplenum], sample_file_endpos[chan]);
-			play_time = (sample_file_startpos[chan] - sample_file_endpos[chan]) / (s_sample->blockAlign * s_sample->sampleRate * f_param[chan][PITCH]);
-		}else
+			if (i_param[chan][REV])		voice[chan].file_startpos = pb->stop_pos;
+			else						voice[chan].file_endpos = pb->stop_pos;
+			play_time = pb->play_time;
+		}
+		else
+			play_time = -1.0f; //not known: calculated when needed
+
+		//END OUT pulse each time a streamed loop reaches the start point of its next pass
+		if (at_loop_point)
 		{
-			sample_file_endpos[chan] = calc_stop_point(length, rs, &samples[banknum][samplenum], sample_file_startpos[chan]);
-			play_time = (sample_file_endpos[chan] - sample_file_startpos[chan]) / (s_sample->blockAlign * s_sample->sampleRate * f_param[chan][PITCH]);
+			if (play_time < 0.0f)	play_time = calc_play_time(chan, s_sample);
+			flicker_endout(chan, play_time);
+			play_led_state[chan] = 1;
 		}
-		
 
-		//We could make this code more readable by putting the switch() inside the for() loop, but that would waste a lot of processor cycles
+
+		//Envelopes are applied as a linear gain ramp from g_start to g_end (see apply_fade() for fades)
+		g_start = GAIN_Q16(gain);
+		g_end = g_start;
+		outR_env = global_mode[STEREO_MODE] ? outR : 0;
+
 		 switch (play_state[chan])
 		 {
 
 			 case (PLAY_FADEDOWN):
 			 case (RETRIG_FADEDOWN):
 			 	DEBUG1_ON;
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-				 	if (global_mode[FADEUPDOWN_ENVELOPE])	env = (float)(HT16_CHAN_BUFF_LEN-i) / (float)HT16_CHAN_BUFF_LEN;
-					else									env = 1.0;
-
-					outL[i] = (float)outL[i] * env * gain;
-					outR[i] = (float)outR[i] * env * gain;
+			 	if (global_mode[FADEUPDOWN_ENVELOPE])	g_end = 0;
 
-					outL[i] = _SSAT16(outL[i]);
-					outR[i] = _SSAT16(outR[i]);
-				}
+				apply_fade(outL, outR_env, g_start, g_end, FADE_AT_END);
 
+				if (play_time < 0.0f)	play_time = calc_play_time(chan, s_sample);
 				flicker_endout(chan, play_time);
 
 				//Start playing again if we're looking, or re-triggered
 				//Unless we faded down because of a play trigger
 				if ((play_state[chan]==RETRIG_FADEDOWN || i_param[chan][LOOPING]) && !flags[Play1TrigDelaying+chan])
-					flags[Play1But+chan] = 1;
+					post_event(EV_PLAY_BUT, chan);
 
 				play_state[chan] = SILENT;
 				DEBUG1_OFF;
@@ -1166,17 +1792,9 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 
 			 case (PLAY_FADEUP):
 			 DEBUG3_ON;
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-					if (global_mode[FADEUPDOWN_ENVELOPE])	env = (float)i / (float)HT16_CHAN_BUFF_LEN;
-					else									env = 1.0;
-
-					outL[i] = (float)outL[i] * env * gain;
-					outR[i] = (float)outR[i] * env * gain;
+				if (global_mode[FADEUPDOWN_ENVELOPE])	g_start = 0;
 
-					outL[i] = _SSAT16(outL[i]);
-					outR[i] = _SSAT16(outR[i]);
-				}
+				apply_fade(outL, outR_env, g_start, g_end, FADE_AT_START);
 
 				if (length>0.5)			play_state[chan]	= PLAYING;
 				else					play_state[chan] 	= PLAYING_PERC;
@@ -1185,14 +1803,8 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 		 	 break;
 
 			 case (PLAYING):
-				for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
-				{
-					outL[i] = (float)outL[i] * gain;
-					outR[i] = (float)outR[i] * gain;
+				apply_gain_ramp(outL, outR_env, HT16_CHAN_BUFF_LEN, g_start, g_end);
 
-					outL[i] = _SSAT16(outL[i]);
-					outR[i] = _SSAT16(outR[i]);
-				}
 				if (length<=0.5)	flags[ChangePlaytoPerc1+chan] = 1;
 
 		 	 break;
@@ -1203,26 +1815,28 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 			 	
 				decay_inc[chan] = 1.0f/((length)*PERC_ENV_FACTOR);
 
+				//Advance the decay envelope by a whole block (it's linear, so the ramp ends where the per-sample envelope would)
+				if (play_state[chan]!=PAD_SILENCE)
+				{
+					env = decay_amp_i[chan];
+
+					if (i_param[chan][REV])	decay_amp_i[chan] += HT16_CHAN_BUFF_LEN * decay_inc[chan];
+					else					decay_amp_i[chan] -= HT16_CHAN_BUFF_LEN * decay_inc[chan];
+
+					if (decay_amp_i[chan] < 0.0f) 		{decay_inc[chan] = 0.0; decay_amp_i[chan] = 0.0f;}
+					else if (decay_amp_i[chan] > 1.0f) 	{decay_inc[chan] = 0.0; decay_amp_i[chan] = 1.0f;}
+				}
+
 		 		if (play_state[chan]==PLAYING_PERC) 
 		 		{
 		 			DEBUG2_ON;
-					for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
+					if (global_mode[PERC_ENVELOPE])
 					{
-						if (i_param[chan][REV])	decay_amp_i[chan] += decay_inc[chan];
-						else					decay_amp_i[chan] -= decay_inc[chan];
-
-						if (decay_amp_i[chan] < 0.0f) 		{decay_inc[chan] = 0.0; decay_amp_i[chan] = 0.0f;}
-						else if (decay_amp_i[chan] > 1.0f) 	{decay_inc[chan] = 0.0; decay_amp_i[chan] = 1.0f;}
-
-						if (global_mode[PERC_ENVELOPE]) env = decay_amp_i[chan];
-						else env = 1.0;
-
-						outL[i] = ((float)outL[i]) * env * gain;
-						outR[i] = ((float)outR[i]) * env * gain;
-
-						outL[i] = _SSAT16(outL[i]);
-						outR[i] = _SSAT16(outR[i]);
+						g_start = GAIN_Q16(env * gain);
+						g_end 	= GAIN_Q16(decay_amp_i[chan] * gain);
 					}
+
+					apply_gain_ramp(outL, outR_env, HT16_CHAN_BUFF_LEN, g_start, g_end);
 					DEBUG2_OFF;
 				} else
 
@@ -1232,30 +1846,20 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 		 		if (play_state[chan]==PLAYING_PERC_FADEDOWN) 
 		 		{
 		 			DEBUG0_ON;
-					for (i=0;i<HT16_CHAN_BUFF_LEN;i++)
+					if (global_mode[FADEUPDOWN_ENVELOPE])
 					{
-						if (i_param[chan][REV])	decay_amp_i[chan] += decay_inc[chan];
-						else					decay_amp_i[chan] -= decay_inc[chan];
-
-						if (decay_amp_i[chan] < 0.0f) 		{decay_inc[chan] = 0.0; decay_amp_i[chan] = 0.0f;}
-						else if (decay_amp_i[chan] > 1.0f) 	{decay_inc[chan] = 0.0; decay_amp_i[chan] = 1.0f;}
-
-						if (global_mode[FADEUPDOWN_ENVELOPE])	env = decay_amp_i[chan] * (float)(HT16_CHAN_BUFF_LEN-i) / (float)HT16_CHAN_BUFF_LEN;
-						else									env = 1.0;
-
-						outL[i] = ((float)outL[i]) * env * gain;
-						outR[i] = ((float)outR[i]) * env * gain;
-
-						outL[i] = _SSAT16(outL[i]);
-						outR[i] = _SSAT16(outR[i]);
+						g_start = GAIN_Q16(env * gain);
+						g_end 	= 0;
 					}
+
+					apply_fade(outL, outR_env, g_start, g_end, FADE_AT_END);
 					DEBUG0_OFF;
 					//If the sample is very short, then pad it with silence so we get a consistant end out period
 					// if ( (sample->inst_end - sample->inst_start) < (READ_BLOCK_SIZE*2) )
 
 					// If the end point is the end of the sample data (which happens if the file is very short, or if we're at the end of it)
 					// Then pad it with silence so we keep a constant End Out period when looping
-					if ( sample_file_endpos[chan] == s_sample->inst_end )
+					if ( voice[chan].file_endpos == s_sample->inst_end )
 						play_state[chan]=PAD_SILENCE;
 					else
 						decay_amp_i[chan] = 0.0f; //force a sample ending
@@ -1289,7 +1893,7 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 
 					//Restart loop
 					if (i_param[chan][LOOPING] && !flags[Play1TrigDelaying+chan])
-						flags[Play1Trig+chan] = 1;
+						post_event(EV_PLAY_TRIG, chan);
 
 					play_state[chan] = SILENT;
 				}
@@ -1300,11 +1904,17 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 
 		 }//switch play_state
 
+		if (start_offset)
+			delay_block_start(outL, outR, start_offset);
+
 	} //if play_state
 
+	//Sounds handed off by a re-trigger, fading out
+	mix_tail_voices(chan, outL, outR);
+
 	// //FixMe: samplenum is not necessarily set at this point in the function
-	// if (	(play_state[0]==PLAYING && (play_buff_bufferedamt[0][samplenum] < 15000)) ||
-	// 		(play_state[1]==PLAYING && (play_buff_bufferedamt[1][samplenum] < 15000)) )
+	// if (	(play_state[0]==PLAYING && (voice[0].cache[samplenum].bufferedamt < 15000)) ||
+	// 		(play_state[1]==PLAYING && (voice[1].cache[samplenum].bufferedamt < 15000)) )
 
 	// 	play_load_triage = PRIORITIZE_PLAYING;
 	// else
@@ -1317,6 +1927,43 @@ void play_audio_from_buffer(int32_t *outL, int32_t *outR, uint8_t chan)
 
 
 
+//
+// Returns 1 if the sdcard can be used for something other than playback:
+// no read is pending, and every playing channel has at least twice its pre-buffer amount
+// (but no more than half the active buffer limit) buffered ahead
+//
+uint8_t is_storage_idle(void)
+{
+	uint8_t chan;
+	uint8_t samplenum, banknum;
+	Sample *s_sample;
+	uint32_t safe_buff_size;
+
+	if (flags[TimeToReadStorage]) return 0;
+
+	for (chan=0; chan<NUM_PLAY_CHAN; chan++)
+	{
+		if (play_state[chan] == PREBUFFERING) return 0;
+
+		if (play_state[chan] != SILENT && play_state[chan] != PLAY_FADEDOWN && play_state[chan] != RETRIG_FADEDOWN)
+		{
+			samplenum = sample_num_now_playing[chan];
+			banknum = sample_bank_now_playing[chan];
+			s_sample = &(samples[banknum][samplenum]);
+
+			if (voice[chan].cache[samplenum].is_buffered_to_file_end) continue;
+
+			safe_buff_size = calc_pre_buff_size(chan, s_sample) * 2;
+			if (safe_buff_size > ((play_buff[chan][samplenum]->size * 7) / 20))
+				safe_buff_size = ((play_buff[chan][samplenum]->size * 7) / 20);
+
+			if (CB_distance(play_buff[chan][samplenum], i_param[chan][REV]) < safe_buff_size) return 0;
+		}
+	}
+
+	return 1;
+}
+
 void SDIO_read_IRQHandler(void)
 {
 	if (TIM_GetITStatus(SDIO_read_TIM, TIM_IT_Update) != RESET) {
@@ -0,0 +1,174 @@
+/*
+ * sdcard_speed.c
+ *
+ * Measures the SD Card at boot (see sdcard_speed.h), timed with the DWT cycle counter:
+ * - Sequential read: SD_SPEED_SEQ_BLOCKS reads of READ_BLOCK_SIZE from the start of the FAT data area
+ * - Random read: SD_SPEED_RAND_READS reads of READ_BLOCK_SIZE from anywhere in the data area.
+ *   This is what read_storage_to_buffer() does when it streams several files at once
+ *
+ * The reads go straight to disk_read(), so nothing on the card is changed.
+ * (Writes aren't measured: nothing uses the number, and it isn't worth wearing the card at every boot.
+ * SDCARD_SPEED_FILE, left by firmware that did, is deleted)
+ * tmp_buff_u32[] (sampler.c) is used as the buffer: read_storage_to_buffer() doesn't run until after boot.
+ *
+ * From the random read times:
+ * - max_rs: the highest rate all the play channels can stream at together with the card's random read throughput.
+ *   It's only lowered below MAX_RS when the card can't keep up with every channel playing at MAX_RS
+ * - buffer_threshold: while a channel pre-buffers, it might wait for the other play channels and the recorder to read
+ *   before its own read is done. The pre-buffer covers twice that time, played at 1x speed
+ * MAX_RS and BASE_BUFFER_THRESHOLD are the defaults. max_rs is kept between SD_SPEED_MIN_MAX_RS and MAX_RS,
+ * and buffer_threshold between BASE_BUFFER_THRESHOLD and 4x that, so a card as fast as the defaults assume gets the defaults.
+ * calc_pre_buff_size() (sampler.c) limits the pre-buffer to what fits in the play_buff.
+ *
+ * The results are sent on ITM port SD_SPEED_ITM_PORT, and written to the CPU profile file (see profiler.c).
+ * This only runs at boot: reload_sdcard() is also called to recover from errors while recording,
+ * and that's no time for a test that takes 50-100ms.
+ */
+
+#include "globals.h"
+#include "ff.h"
+#include "diskio.h"
+#include "sampler.h"
+#include "sts_filesystem.h"
+#include "str_util.h"
+#include "stm32f4_discovery_sdio_sd.h"
+#include "sdcard_speed.h"
+#include "ITM.h"
+
+extern FATFS 		FatFs;
+extern uint32_t 	tmp_buff_u32[READ_BLOCK_SIZE>>2];
+
+SdCardSpeed sdcard_speed = {
+	.max_rs 			= MAX_RS,
+	.buffer_threshold 	= BASE_BUFFER_THRESHOLD,
+};
+
+#define READ_BLOCK_SECTORS		(READ_BLOCK_SIZE / 512)
+
+static uint32_t cycles_to_us(uint32_t cycles)
+{
+	return cycles / (SystemCoreClock / 1000000);
+}
+
+static uint32_t calc_kBps(uint32_t bytes, uint32_t us)
+{
+	if (!us) return 0;
+	return (uint32_t)(((uint64_t)bytes * 1000) / us);
+}
+
+static uint32_t next_rand(uint32_t *seed)
+{
+	*seed = (*seed * 1664525) + 1013904223;
+	return *seed;
+}
+
+static uint8_t measure_reads(void)
+{
+	uint32_t i, start, us, total_us;
+	DWORD data_sectors, sector;
+	uint32_t seed;
+	BYTE *buf = (BYTE *)tmp_buff_u32;
+
+	data_sectors = (FatFs.n_fatent - 2) * FatFs.csize;
+	if (data_sectors < (SD_SPEED_SEQ_BLOCKS * READ_BLOCK_SECTORS)) return(0);
+
+	start = DWT->CYCCNT;
+	for (i=0; i<SD_SPEED_SEQ_BLOCKS; i++)
+		if (disk_read(0, buf, FatFs.database + i*READ_BLOCK_SECTORS, READ_BLOCK_SECTORS) != RES_OK) return(0);
+
+	sdcard_speed.seq_read_kBps = calc_kBps(SD_SPEED_SEQ_BLOCKS * READ_BLOCK_SIZE, cycles_to_us(DWT->CYCCNT - start));
+
+	//Seeded from the cycle counter, so it's not the same sectors every boot
+	seed = DWT->CYCCNT;
+	total_us = 0;
+	sdcard_speed.max_rand_read_us = 0;
+
+	for (i=0; i<SD_SPEED_RAND_READS; i++)
+	{
+		sector = FatFs.database + (next_rand(&seed) % (data_sectors - READ_BLOCK_SECTORS));
+
+		start = DWT->CYCCNT;
+		if (disk_read(0, buf, sector, READ_BLOCK_SECTORS) != RES_OK) return(0);
+		us = cycles_to_us(DWT->CYCCNT - start);
+
+		total_us += us;
+		if (us > sdcard_speed.max_rand_read_us) sdcard_speed.max_rand_read_us = us;
+	}
+	sdcard_speed.rand_read_us = total_us / SD_SPEED_RAND_READS;
+
+	return(1);
+}
+
+//Firmware that measured the write speed left its test file in the system dir. f_unlink() only writes if it's there
+static void remove_write_test_file(void)
+{
+	char path[_MAX_LFN+1];
+
+	str_cat(path, SYS_DIR_SLASH, SDCARD_SPEED_FILE);
+	f_unlink(path);
+}
+
+static void set_streaming_limits(void)
+{
+	float rand_read_Bps, max_rs, wait_s;
+	uint32_t threshold;
+
+	if (!sdcard_speed.rand_read_us) return;
+
+	//16-bit frames, mono (in stereo mode, the rate is clamped to max_rs / numChannels).
+	//This is the rate at which the card would just keep up, so a card that can stream every channel at MAX_RS keeps it
+	rand_read_Bps 	= (float)READ_BLOCK_SIZE * 1000000.0f / (float)sdcard_speed.rand_read_us;
+	max_rs 			= rand_read_Bps / (float)(NUM_PLAY_CHAN * 2 * BASE_SAMPLE_RATE);
+
+	if (max_rs > MAX_RS) 				max_rs = MAX_RS;
+	if (max_rs < SD_SPEED_MIN_MAX_RS) 	max_rs = SD_SPEED_MIN_MAX_RS;
+	sdcard_speed.max_rs = max_rs;
+
+	wait_s 		= (float)((NUM_PLAY_CHAN + 1) * sdcard_speed.max_rand_read_us) / 1000000.0f;
+	threshold 	= (uint32_t)(2.0f * wait_s * f_BASE_SAMPLE_RATE);
+
+	if (threshold < BASE_BUFFER_THRESHOLD) 		threshold = BASE_BUFFER_THRESHOLD;
+	if (threshold > (BASE_BUFFER_THRESHOLD*4)) 	threshold = BASE_BUFFER_THRESHOLD*4;
+	sdcard_speed.buffer_threshold = threshold;
+}
+
+//
+// Sends 0x53440000 + the item number and its value:
+// 0: bus speed, 1: seq read kB/s, 3: avg random read us, 4: max random read us,
+// 5: max_rs x 100, 6: buffer_threshold
+//
+static void send_sdcard_speed(void)
+{
+	ITM_SendValue(SD_SPEED_ITM_PORT, 0x53440000);
+	ITM_SendValue(SD_SPEED_ITM_PORT, sdcard_speed.bus_speed);
+	ITM_SendValue(SD_SPEED_ITM_PORT, 0x53440001);
+	ITM_SendValue(SD_SPEED_ITM_PORT, sdcard_speed.seq_read_kBps);
+	ITM_SendValue(SD_SPEED_ITM_PORT, 0x53440003);
+	ITM_SendValue(SD_SPEED_ITM_PORT, sdcard_speed.rand_read_us);
+	ITM_SendValue(SD_SPEED_ITM_PORT, 0x53440004);
+	ITM_SendValue(SD_SPEED_ITM_PORT, sdcard_speed.max_rand_read_us);
+	ITM_SendValue(SD_SPEED_ITM_PORT, 0x53440005);
+	ITM_SendValue(SD_SPEED_ITM_PORT, (uint32_t)(sdcard_speed.max_rs * 100.0f));
+	ITM_SendValue(SD_SPEED_ITM_PORT, 0x53440006);
+	ITM_SendValue(SD_SPEED_ITM_PORT, sdcard_speed.buffer_threshold);
+}
+
+//Call after the SD Card is mounted. If it's not, nothing is measured and the limits stay as they are
+void measure_sdcard_speed(void)
+{
+	if (!FatFs.fs_type) return;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	if (!measure_reads()) return;
+
+	remove_write_test_file();
+
+	//A CRC error during the tests lowers the bus speed, so this is read after
+	sdcard_speed.bus_speed 	= SD_GetBusSpeed();
+	sdcard_speed.measured 	= 1;
+
+	set_streaming_limits();
+	send_sdcard_speed();
+}
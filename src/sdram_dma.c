@@ -0,0 +1,240 @@
+/*
+ * sdram_dma.c
+ *
+ * SDRAM fills and pattern tests with DMA (see sdram_dma.h)
+ *
+ * A fill reads one word from SRAM over and over (peripheral address not incremented),
+ * in transfers of up to SDRAM_DMA_FILL_BLOCK bytes, started one after the other from the DMA interrupt.
+ *
+ * A pattern test writes every 16-bit address with its own halfword index (the same pattern as RAM_test() always used,
+ * so a stuck or shorted address line shows up), then reads it all back and counts the halfwords that differ.
+ * The pattern for each SDRAM_DMA_TEST_BLOCK is made in test_buf[] and copied to the SDRAM,
+ * and for verifying, each block is copied back into test_buf[] and checked by the DMA interrupt.
+ *
+ */
+
+#include "globals.h"
+#include "sdram_driver.h"
+#include "sdram_dma.h"
+
+enum SdramDmaJobs {
+	SDRAM_DMA_IDLE,
+	SDRAM_DMA_FILL,
+	SDRAM_DMA_TEST_WRITE,
+	SDRAM_DMA_TEST_VERIFY
+};
+
+static volatile uint8_t	dma_job = SDRAM_DMA_IDLE;
+static uint32_t 		job_start, job_end;
+static uint32_t 		cur_addr, cur_size;
+static SdramDmaCallback job_done;
+static volatile uint32_t job_errors;
+
+//DMA can't read or write CCM, so these must stay in SRAM
+static uint32_t 		fill_word;
+static uint32_t 		test_buf[SDRAM_DMA_TEST_BLOCK/4];
+
+
+void init_sdram_dma(void)
+{
+	DMA_InitTypeDef DMA_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+
+	RCC_AHB1PeriphClockCmd(SDRAM_DMA_CLK, ENABLE);
+
+	DMA_DeInit(SDRAM_DMA_STREAM);
+	DMA_InitStructure.DMA_Channel = SDRAM_DMA_CHANNEL;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&fill_word; //source, set for each transfer
+	DMA_InitStructure.DMA_Memory0BaseAddr = SDRAM_BASE; //destination, set for each transfer
+	DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToMemory;
+	DMA_InitStructure.DMA_BufferSize = 1; //set for each transfer
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+	DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable; //direct mode is not allowed for memory-to-memory
+	DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_INC4;
+	DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+	DMA_Init(SDRAM_DMA_STREAM, &DMA_InitStructure);
+
+	DMA_ITConfig(SDRAM_DMA_STREAM, DMA_IT_TC | DMA_IT_TE, ENABLE);
+
+	NVIC_InitStructure.NVIC_IRQChannel = SDRAM_DMA_IRQ;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 3;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 2;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+}
+
+static void start_transfer(uint32_t src, uint32_t dst, uint32_t size, uint8_t src_inc)
+{
+	//The ADC de-init functions turn off the DMA2 clock
+	RCC_AHB1PeriphClockCmd(SDRAM_DMA_CLK, ENABLE);
+
+	DMA_Cmd(SDRAM_DMA_STREAM, DISABLE);
+	while (SDRAM_DMA_STREAM->CR & DMA_SxCR_EN) {;}
+
+	DMA_ClearFlag(SDRAM_DMA_STREAM, SDRAM_DMA_FLAGS_ALL);
+
+	if (src_inc)	SDRAM_DMA_STREAM->CR |= DMA_SxCR_PINC;
+	else			SDRAM_DMA_STREAM->CR &= ~DMA_SxCR_PINC;
+
+	SDRAM_DMA_STREAM->PAR 	= src;
+	SDRAM_DMA_STREAM->M0AR 	= dst;
+	SDRAM_DMA_STREAM->NDTR 	= size >> 2;
+
+	cur_addr = (dst == (uint32_t)test_buf) ? src : dst;
+	cur_size = size;
+
+	DMA_Cmd(SDRAM_DMA_STREAM, ENABLE);
+}
+
+//Expected halfword at a given SDRAM address: its halfword index, counting from SDRAM_BASE
+static inline uint16_t test_pattern(uint32_t addr)
+{
+	return (uint16_t)((addr - SDRAM_BASE) >> 1);
+}
+
+static void make_test_block(uint32_t addr)
+{
+	uint32_t i;
+	uint16_t lo;
+
+	for (i=0; i<SDRAM_DMA_TEST_BLOCK/4; i++)
+	{
+		lo = test_pattern(addr + i*4);
+		test_buf[i] = (uint32_t)lo | ((uint32_t)(uint16_t)(lo + 1) << 16);
+	}
+}
+
+static uint32_t check_test_block(uint32_t addr, uint32_t size)
+{
+	uint32_t i, errors = 0;
+	uint16_t *rd = (uint16_t *)test_buf;
+
+	for (i=0; i<size/2; i++)
+		if (rd[i] != test_pattern(addr + i*2)) errors++;
+
+	return errors;
+}
+
+static uint32_t block_len(uint32_t addr, uint32_t max)
+{
+	return ((job_end - addr) < max) ? (job_end - addr) : max;
+}
+
+static void start_test_write(uint32_t addr)
+{
+	make_test_block(addr);
+	start_transfer((uint32_t)test_buf, addr, block_len(addr, SDRAM_DMA_TEST_BLOCK), 1);
+}
+
+static void start_test_verify(uint32_t addr)
+{
+	start_transfer(addr, (uint32_t)test_buf, block_len(addr, SDRAM_DMA_TEST_BLOCK), 1);
+}
+
+//Returns 0 if a job is already running
+uint8_t sdram_dma_fill(uint32_t addr, uint32_t size, uint32_t value, SdramDmaCallback done)
+{
+	if (dma_job != SDRAM_DMA_IDLE || !size) return(0);
+
+	fill_word 	= value;
+	job_start 	= addr;
+	job_end 	= addr + size;
+	job_done 	= done;
+	job_errors 	= 0;
+	dma_job 	= SDRAM_DMA_FILL;
+
+	start_transfer((uint32_t)&fill_word, addr, block_len(addr, SDRAM_DMA_FILL_BLOCK), 0);
+	return(1);
+}
+
+//Returns 0 if a job is already running
+uint8_t sdram_dma_test(uint32_t addr, uint32_t size, SdramDmaCallback done)
+{
+	if (dma_job != SDRAM_DMA_IDLE || !size) return(0);
+
+	job_start 	= addr;
+	job_end 	= addr + size;
+	job_done 	= done;
+	job_errors 	= 0;
+	dma_job 	= SDRAM_DMA_TEST_WRITE;
+
+	start_test_write(addr);
+	return(1);
+}
+
+uint8_t sdram_dma_busy(void)
+{
+	return (dma_job != SDRAM_DMA_IDLE);
+}
+
+void sdram_dma_wait(void)
+{
+	while (dma_job != SDRAM_DMA_IDLE) {;}
+}
+
+//Errors found by the last test
+uint32_t sdram_dma_errors(void)
+{
+	return job_errors;
+}
+
+void SDRAM_DMA_IRQHandler(void)
+{
+	uint32_t next;
+
+	//A bus error ends the job, and the whole block counts as errors
+	if (DMA_GetFlagStatus(SDRAM_DMA_STREAM, SDRAM_DMA_FLAG_TE) != RESET)
+	{
+		DMA_ClearFlag(SDRAM_DMA_STREAM, SDRAM_DMA_FLAGS_ALL);
+		job_errors += cur_size >> 1;
+		dma_job = SDRAM_DMA_IDLE;
+		if (job_done) job_done(job_errors);
+		return;
+	}
+
+	if (DMA_GetFlagStatus(SDRAM_DMA_STREAM, SDRAM_DMA_FLAG_TC) == RESET) return;
+	DMA_ClearFlag(SDRAM_DMA_STREAM, SDRAM_DMA_FLAGS_ALL);
+
+	next = cur_addr + cur_size;
+
+	switch (dma_job)
+	{
+		case SDRAM_DMA_FILL:
+			if (next < job_end)
+			{
+				start_transfer((uint32_t)&fill_word, next, block_len(next, SDRAM_DMA_FILL_BLOCK), 0);
+				return;
+			}
+			break;
+
+		case SDRAM_DMA_TEST_WRITE:
+			if (next < job_end)		start_test_write(next);
+			else
+			{
+				dma_job = SDRAM_DMA_TEST_VERIFY;
+				start_test_verify(job_start);
+			}
+			return;
+
+		case SDRAM_DMA_TEST_VERIFY:
+			job_errors += check_test_block(cur_addr, cur_size);
+			if (next < job_end)
+			{
+				start_test_verify(next);
+				return;
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	dma_job = SDRAM_DMA_IDLE;
+	if (job_done) job_done(job_errors);
+}
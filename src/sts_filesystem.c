@@ -6,7 +6,7 @@
  * Look for missing files and new folders: ORANGE
  * --Or: No index found, create all new banks from folders: WHITE
  * Write index file: MAGENTA
- * Write html file: LAVENDER
+ * (html file is written later, from the main loop)
  * Done: OFF
  * 
  * 
@@ -25,6 +25,7 @@
 #include "bank.h"
 #include "sts_fs_index.h"
 #include "sts_fs_renaming_queue.h"
+#include "sts_fs_catalog.h"
 #include "res/LED_palette.h"
 
 extern Sample samples[MAX_NUM_BANKS][NUM_SAMPLES_PER_BANK];
@@ -79,6 +80,8 @@ FRESULT reload_sdcard(void)
 {
 	FRESULT res;
 
+	invalidate_sample_catalog();
+
 	res = f_mount(&FatFs, "", 1);
 	if (res != FR_OK)
 	{
@@ -734,7 +737,6 @@ uint8_t load_bank_from_disk(Sample *sample_bank, char *path_noslash)
 
 uint8_t load_all_banks(uint8_t force_reload)
 {
-	FRESULT res;
 	FRESULT queue_valid;
 
 	//Load the index file:
@@ -800,16 +802,9 @@ uint8_t load_all_banks(uint8_t force_reload)
 
 	// Write samples struct to index
 	// ... so sample info gets updated with latest .wav header content
-	// Buttons are red for index file, then orange for html file
-
-	res = index_write_wrapper(); //the wrapper sets flags[RewriteIndex] to ORANGE during html file write
-
-	// Done re-indexing (buttons are normal)
-	flags[RewriteIndex]=0;
-
-	// check if there was an error writing to index file
-	// ToDo: push this to error log
-	if (res) {g_error |= CANNOT_WRITE_INDEX; check_errors(); return 0;}
+	// The main loop writes it in the background, so playback can start right away (see bg_jobs.c)
+	// Buttons are magenta for index file (html file is written later)
+	flags[RewriteIndex]=MAGENTA;
 
 
 	//Verify the channels are set to enabled banks, and correct if necessary
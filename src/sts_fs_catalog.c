@@ -0,0 +1,213 @@
+/*
+ * sts_fs_catalog.c
+ *
+ * Catalog of all .wav files on the SD Card, with their headers already parsed.
+ *
+ * The catalog is built in the background from the main loop, one directory entry per call,
+ * in the same order that assignment mode used to crawl the filesystem:
+ * first the files in the root dir, then the files in each folder in the root dir.
+ *
+ * It's invalidated whenever the SD Card is re-mounted or a new file is recorded,
+ * and then rebuilt from scratch.
+ *
+ */
+
+#include "globals.h"
+#include "ff.h"
+#include "audio_sdram.h"
+#include "str_util.h"
+#include "file_util.h"
+#include "sampler.h"
+#include "sample_file.h"
+#include "sts_fs_catalog.h"
+
+#define MAX_CATALOG_ENTRIES 	(CATALOG_SIZE / sizeof(CatalogEntry))
+
+static CatalogEntry *catalog = (CatalogEntry *)CATALOG_START;
+
+static enum CatalogStates 	catalog_state = CATALOG_INVALID;
+static uint32_t 			catalog_num_entries = 0;
+static DIR 					catalog_root_dir;
+static DIR 					catalog_dir;
+static char 				catalog_folder[_MAX_LFN];
+
+
+void invalidate_sample_catalog(void)
+{
+	if (catalog_state == CATALOG_SCAN_ROOT || catalog_state == CATALOG_SCAN_FOLDER)
+		f_closedir(&catalog_dir);
+
+	if (catalog_state == CATALOG_NEXT_FOLDER || catalog_state == CATALOG_SCAN_FOLDER)
+		f_closedir(&catalog_root_dir);
+
+	catalog_state 		= CATALOG_INVALID;
+	catalog_num_entries = 0;
+}
+
+uint8_t is_sample_catalog_ready(void)
+{
+	return (catalog_state == CATALOG_READY);
+}
+
+uint32_t sample_catalog_size(void)
+{
+	return (catalog_num_entries);
+}
+
+CatalogEntry* sample_catalog_entry(uint32_t i)
+{
+	return (&catalog[i]);
+}
+
+//Returns 1 if the entry's file is directly inside folder (folder has no trailing slash, "" = root)
+uint8_t is_catalog_entry_in_folder(CatalogEntry *entry, char *folder)
+{
+	uint32_t i;
+
+	if (str_len(folder) != entry->folder_len) return (0);
+
+	for (i=0; i<entry->folder_len; i++)
+		if (entry->filename[i] != folder[i]) return (0);
+
+	return (1);
+}
+
+//Returns 1 if folder was scanned into the catalog
+//(only the root dir and the folders in root are scanned)
+uint8_t sample_catalog_has_folder(char *folder)
+{
+	uint32_t i;
+
+	if (folder[0]=='\0') return (1);
+
+	for (i=0; i<str_len(folder); i++)
+		if (folder[i]=='/') return (0);
+
+	return (1);
+}
+
+void catalog_entry_to_sample(CatalogEntry *entry, Sample *s_sample)
+{
+	str_cpy(s_sample->filename, entry->filename);
+
+	s_sample->sampleSize 		= entry->sampleSize;
+	s_sample->startOfData 		= entry->startOfData;
+	s_sample->sampleRate 		= entry->sampleRate;
+	s_sample->PCM 				= entry->PCM;
+	s_sample->sampleByteSize 	= entry->sampleByteSize;
+	s_sample->numChannels 		= entry->numChannels;
+	s_sample->blockAlign 		= entry->blockAlign;
+
+	s_sample->file_found 		= 1;
+	s_sample->file_size 		= entry->file_size;
+	s_sample->file_datetime 	= entry->file_datetime;
+	s_sample->hdr_verified 		= 1;
+
+	s_sample->inst_start 		= 0;
+	s_sample->inst_end 			= s_sample->sampleSize;
+	s_sample->inst_size 		= s_sample->sampleSize;
+	s_sample->inst_gain 		= 1.0;
+}
+
+//
+// Adds a file to the catalog if it's a valid .wav file
+//
+static void add_catalog_entry(char *folder, FILINFO *fno)
+{
+	CatalogEntry 	*entry;
+	Sample 			tmp;
+	FIL 			temp_file;
+	uint32_t 		folder_len;
+	FRESULT 		res;
+
+	if (catalog_num_entries >= MAX_CATALOG_ENTRIES) return;
+
+	if (fno->fname[0]=='.') return;
+	if (!is_wav(fno->fname)) return;
+
+	// Ignore files with paths that are too long
+	folder_len = str_len(folder);
+	if ((str_len(fno->fname) + folder_len + 1) >= _MAX_LFN) return;
+
+	// Build the path the same way assignment mode does: folder + '/' + filename
+	str_cpy(tmp.filename, folder);
+	tmp.filename[folder_len] = '/';
+	str_cpy(&(tmp.filename[folder_len+1]), fno->fname);
+
+	res = f_open(&temp_file, tmp.filename, FA_READ);
+	if (res!=FR_OK) return;
+
+	res = load_sample_header(&tmp, &temp_file);
+	f_close(&temp_file);
+	if (res!=FR_OK) return;
+
+	entry = &catalog[catalog_num_entries++];
+
+	str_cpy(entry->filename, tmp.filename);
+	entry->folder_len 		= folder_len;
+	entry->sampleSize 		= tmp.sampleSize;
+	entry->startOfData 		= tmp.startOfData;
+	entry->sampleRate 		= tmp.sampleRate;
+	entry->PCM 				= tmp.PCM;
+	entry->sampleByteSize 	= tmp.sampleByteSize;
+	entry->numChannels 		= tmp.numChannels;
+	entry->blockAlign 		= tmp.blockAlign;
+	entry->file_size 		= fno->fsize;
+	entry->file_datetime 	= (((uint32_t)fno->fdate)<<16) | fno->ftime;
+}
+
+//
+// Advances the catalog scan by one directory entry
+// Called from the main loop
+//
+void build_sample_catalog_idle(void)
+{
+	FILINFO fno;
+	FRESULT res;
+
+	if (catalog_state == CATALOG_READY) return;
+	if (!is_storage_idle()) return;
+
+	switch (catalog_state)
+	{
+		case (CATALOG_INVALID):
+			catalog_num_entries = 0;
+			catalog_folder[0] 	= '\0';
+
+			res = f_opendir(&catalog_dir, "");
+			if (res==FR_OK) catalog_state = CATALOG_SCAN_ROOT;
+		break;
+
+		case (CATALOG_SCAN_ROOT):
+		case (CATALOG_SCAN_FOLDER):
+			res = f_readdir(&catalog_dir, &fno);
+
+			if (res!=FR_OK || fno.fname[0]==0) //end of folder (or error): go to the next folder
+			{
+				f_closedir(&catalog_dir);
+
+				if (catalog_state == CATALOG_SCAN_ROOT)
+					catalog_root_dir.obj.fs = 0; //reset for get_next_dir()
+
+				catalog_state = CATALOG_NEXT_FOLDER;
+			}
+			else if (!(fno.fattrib & AM_DIR))
+				add_catalog_entry(catalog_folder, &fno);
+		break;
+
+		case (CATALOG_NEXT_FOLDER):
+			res = get_next_dir(&catalog_root_dir, "", catalog_folder);
+
+			if (res!=FR_OK) //no more folders
+			{
+				f_closedir(&catalog_root_dir);
+				catalog_state = CATALOG_READY;
+			}
+			else if (f_opendir(&catalog_dir, catalog_folder) == FR_OK)
+				catalog_state = CATALOG_SCAN_FOLDER;
+		break;
+
+		case (CATALOG_READY):
+		break;
+	}
+}
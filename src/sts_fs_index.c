@@ -12,6 +12,7 @@
 #include "bank.h"
 #include "dig_pins.h"
 #include "res/LED_palette.h"
+#include "audio_sdram.h"
 
 
 Sample						samples[MAX_NUM_BANKS][NUM_SAMPLES_PER_BANK];
@@ -29,246 +30,547 @@ extern uint8_t				flags[NUM_FLAGS];
 
 
 
-FRESULT write_sampleindex_file(void)
+//
+// Buffered file output
+// Text is collected in index_out_buff and written in blocks of INDEX_OUT_BUFF_SIZE bytes,
+// so the file is written in whole sectors with a single f_sync() at the end.
+// The buffer is in SRAM because the SD Card DMA can't read from CCM.
+//
+#define INDEX_OUT_BUFF_SIZE 2048
+
+static uint32_t	index_out_buff[INDEX_OUT_BUFF_SIZE/4];
+static uint32_t	index_out_len;
+static FIL		*index_out_fil;
+static FRESULT	index_out_res;
+
+static void out_open(FIL *fil)
 {
-	FIL		temp_file;
-	FRESULT	res, res_sysdir;
-	//uint32_t	sz, bw;
-	uint8_t	i, j;
+	index_out_fil	= fil;
+	index_out_len	= 0;
+	index_out_res	= FR_OK;
+}
+
+static void out_flush(void)
+{
+	uint32_t bw;
+
+	if (index_out_len && index_out_res==FR_OK)
+	{
+		index_out_res = f_write(index_out_fil, index_out_buff, index_out_len, &bw);
+		if (index_out_res==FR_OK && bw!=index_out_len) index_out_res = FR_DISK_ERR;
+	}
+	index_out_len = 0;
+}
+
+static void out_write(char *data, uint32_t len)
+{
+	char *out = (char *)index_out_buff;
+
+	while (len--)
+	{
+		out[index_out_len++] = *data++;
+		if (index_out_len == INDEX_OUT_BUFF_SIZE) out_flush();
+	}
+}
+
+static void out_puts(char *str)
+{
+	out_write(str, str_len(str));
+}
+
+static void out_putint(uint32_t x, uint32_t digits)
+{
+	char		num[11];
+	uint32_t	len;
+
+	len = intToStr(x, num, digits);
+	while (len < digits) num[len++] = '0';	//intToStr() doesn't pad 0
+
+	out_write(num, len);
+}
+
+// Flushes the buffer, syncs and closes the file
+static FRESULT out_close(void)
+{
+	out_flush();
+	if (index_out_res==FR_OK) index_out_res = f_sync(index_out_fil);
+	f_close(index_out_fil);
+	return (index_out_res);
+}
+
+
+//
+// Serialized banks
+// Each bank's text for the index file is kept in SDRAM (INDEX_TEXT_START), along with
+// a hash of the samples[][] data it was made from. When writing the index, only banks whose
+// hash has changed (dirty banks) are serialized again.
+//
+static uint32_t	bank_text_len[MAX_NUM_BANKS];	// 0 = not serialized yet
+static uint32_t	bank_text_hash[MAX_NUM_BANKS];
+
+#define BANK_TEXT(b)	((char *)(INDEX_TEXT_START + (b)*INDEX_TEXT_BANK_SIZE))
+
+static uint32_t hash_add(uint32_t h, uint32_t x)
+{
+	h ^= x;
+	h *= 16777619;	//FNV prime
+	return h;
+}
+
+static uint32_t calc_bank_hash(uint8_t bank)
+{
+	uint32_t	h = 2166136261;
+	uint8_t		j;
+	char		*c;
+	Sample		*s;
+
+	for (j=0; j<NUM_SAMPLES_PER_BANK; j++)
+	{
+		s = &samples[bank][j];
+
+		for (c = s->filename; *c; c++)
+			h = hash_add(h, *c);
+
+		h = hash_add(h, 0);
+		if (s->filename[0])
+		{
+			h = hash_add(h, s->numChannels);
+			h = hash_add(h, s->sampleRate);
+			h = hash_add(h, s->sampleByteSize);
+			h = hash_add(h, s->sampleSize);
+			h = hash_add(h, s->inst_start);
+			h = hash_add(h, s->inst_size);
+			h = hash_add(h, (int)(100 * s->inst_gain));
+		}
+	}
+	return h;
+}
+
+// Set by text_puts() if a bank's text doesn't fit in INDEX_TEXT_BANK_SIZE
+static uint8_t	bank_text_overflow;
+
+// Appends str to the bank text at *pos, without overflowing the bank's space
+static void text_puts(char *text, uint32_t *pos, char *str)
+{
+	while (*str && *pos < (INDEX_TEXT_BANK_SIZE-1))
+		text[(*pos)++] = *str++;
+
+	if (*str) bank_text_overflow = 1;
+}
+
+static void text_putint(char *text, uint32_t *pos, uint32_t x)
+{
+	char	num[11];
+
+	intToStr(x, num, 0);
+	text_puts(text, pos, num);
+}
+
+//Returns 1 if the bank's text didn't fit: it's not kept, so the bank will be serialized again next time
+static uint8_t serialize_bank(uint8_t bank)
+{
+	char		*text = BANK_TEXT(bank);
+	uint32_t	pos = 0;
+	uint8_t		j;
+	uint8_t		path_written = 0;
 	char		b_color[11];
 	char		bank_path[_MAX_LFN+1];
 	char		filename_ptr[_MAX_LFN+1];
-	char		path[_MAX_LFN+1], bootbakpath[_MAX_LFN+1];
+	char		path[_MAX_LFN+1];
+	Sample		*s;
 
-	// CREATE INDEX FILE
-	// previous index files are replaced
-	// f_open, f_sync and f_rpintf are functions from
-	// ...the module application interface
-	// ...for the Generic FAT file system module  (ff.h)
+	bank_text_overflow = 0;
 
-	// Check for system dir
-	res_sysdir = check_sys_dir();
-	if (res_sysdir!=FR_OK)	return(res_sysdir);
+	// Print bank Color to index file
+	bank_to_color(bank, b_color);
+	text_puts(text, &pos, "--------------------\n");
+	text_puts(text, &pos, b_color);
+	text_puts(text, &pos, "\n--------------------\n");
+
+	for (j=0; j<NUM_SAMPLES_PER_BANK; j++)													// For each sample in bank
+	{
+		s = &samples[bank][j];
 
-	// WRITE SAMPLES DATA TO INDEX FILE
-	else {
+		//FixMe: if samples[i][j] contains a filename with no slashes (example: "ChordHits1.wav")
+		//then the next line will return filename_ptr as null, and so the sample entry will not be written to the index,
+		//but the sample will play and be written to the HTML file
+		//Perhaps we could add a slash to the beginning of samples[][].filename if no slash is found?
 
-		// file index path
-		str_cat(path, SYS_DIR_SLASH,SAMPLE_INDEX_FILE);
+		str_split(s->filename, '/', path, filename_ptr);									// split path and filename
+		if (filename_ptr[0]=='\0') continue;												// Skip empty slots
 
-		// backup index at boot
-		if (flags[BootBak])
+		// Print bank path before the first sample
+		if (!path_written)
 		{
-			str_cat(bootbakpath, SYS_DIR_SLASH, SAMPLE_BOOTBAK_FILE);								// compute path to boot backups
-			f_unlink(bootbakpath);																	// delete existing boot backups
-			f_rename(path,bootbakpath);																// set boot backup to sample index, as found on the SD card
-			flags[BootBak]=0;																		// do not update boot backup file until next boot
+			str_cpy(bank_path, path);
+			text_puts(text, &pos, "path: ");
+			text_puts(text, &pos, path);
+			text_puts(text, &pos, "\n\n");
+			path_written = 1;
 		}
 
-		res = f_open(&temp_file, path, FA_WRITE | FA_CREATE_ALWAYS);								// (re)create sample.index file and its pointer &temp_file
-		if (res != FR_OK) return(res);
+		// Print sample name to index file
+		if (str_cmp(path, bank_path))	text_puts(text, &pos, filename_ptr);
+		else							text_puts(text, &pos, s->filename);
+		text_puts(text, &pos, "\n");
 
-		// write firmware version
-		f_printf(&temp_file, "Firmware Version: %d.%d\n\n",FW_MAJOR_VERSION, FW_MINOR_VERSION);
-		//f_sync(&temp_file);
-
-		// write banks/sample to index file
-		for (i=0; i<MAX_NUM_BANKS; i++)																// For each bank
+		// write sample header info to index file
+		if (s->numChannels==1 || s->numChannels==2)
 		{
-			// Print bank Color to index file
-			bank_to_color(i, b_color);
-			f_printf(&temp_file, "--------------------\n%s\n--------------------\n", b_color);
-			// f_sync(&temp_file);
+			text_puts(text, &pos, "sample info: ");
+			text_putint(text, &pos, s->sampleRate);
+			text_puts(text, &pos, "Hz, ");
+			text_putint(text, &pos, s->sampleByteSize*8);
+			text_puts(text, &pos, (s->numChannels==1) ? "-bit, mono,   " : "-bit, stereo, ");
+			text_putint(text, &pos, s->sampleSize);
+			text_puts(text, &pos, " samples\n");
+		}
 
-			for (j=0; j<NUM_SAMPLES_PER_BANK; j++)													// For each sample in bank
-			{
+		// write play data to index file
+		text_puts(text, &pos, PLAYDATTAG_SLOT ": ");		text_putint(text, &pos, j+1);
+		text_puts(text, &pos, "\n" PLAYDATTAG_START ": ");	text_putint(text, &pos, s->inst_start);
+		text_puts(text, &pos, "\n" PLAYDATTAG_SIZE ": ");	text_putint(text, &pos, s->inst_size);
+		text_puts(text, &pos, "\n" PLAYDATTAG_GAIN "(%): ");	text_putint(text, &pos, (int)(100 * s->inst_gain));
+		text_puts(text, &pos, "\n\n");
+	}
+	text_puts(text, &pos, "\n");
 
-				//FixMe: if samples[i][j] contains a filename with no slashes (example: "ChordHits1.wav")
-				//then the next line will return filename_ptr as null, and so the sample entry will not be written to the index,
-				//but the sample will play and be written to the HTML file
-				//Perhaps we could add a slash to the beginning of samples[][].filename if no slash is found?
+	bank_text_len[bank] = bank_text_overflow ? 0 : pos;
+	return (bank_text_overflow);
+}
 
-				str_split(samples[i][j].filename, '/', path, filename_ptr);							// split path and filename
-				if (filename_ptr[0]!='\0')															// Skip empty slots
-				{
-					// Print bank path to index file
-					if(j==0)
-					{
-						str_cpy(bank_path, path);
-						f_printf(&temp_file, "path: %s\n\n", path);
-						// f_sync(&temp_file);
-					}
 
-					// Print sample name to index file
-					if (str_cmp(path, bank_path)) f_printf(&temp_file, "%s\n",filename_ptr);
-					else f_printf(&temp_file, "%s\n", samples[i][j].filename);
-					// f_sync(&temp_file);
+//
+// Index file writing
+// write_sampleindex_step() does a small piece of the work each time it's called,
+// so writing can be spread over several main loop passes (see bg_jobs.c)
+//
+enum IndexWriteSteps {
+	IDXW_SERIALIZE,
+	IDXW_OPEN,
+	IDXW_WRITE_BANKS,
+	IDXW_CLOSE,
+	IDXW_HDRCACHE,
+	IDXW_DONE
+};
+
+static FIL		idxw_file;
+static uint8_t	idxw_step = IDXW_DONE;
+static uint8_t	idxw_bank;
+static FRESULT	idxw_res;
+
+void write_sampleindex_begin(void)
+{
+	idxw_step	= IDXW_SERIALIZE;
+	idxw_bank	= 0;
+	idxw_res	= FR_OK;
+}
 
-					// write sample header info to index file
-					switch (samples[i][j].numChannels)
-					{
-						case 1:
-							f_printf(&temp_file, "sample info: %dHz, %d-bit, mono,   %d samples\n", samples[i][j].sampleRate, samples[i][j].sampleByteSize*8, samples[i][j].sampleSize);
-							// f_sync(&temp_file);
-						break;
-						case 2:
-							f_printf(&temp_file, "sample info: %dHz, %d-bit, stereo, %d samples\n", samples[i][j].sampleRate, samples[i][j].sampleByteSize*8, samples[i][j].sampleSize);
-							// f_sync(&temp_file);
-						break;
-					}
+FRESULT write_sampleindex_result(void)
+{
+	return (idxw_res);
+}
 
-					// write play data to index file
-					f_printf(&temp_file, "%s: %d\n%s: %d\n%s: %d\n%s(%%): %d\n\n", PLAYDATTAG_SLOT, j+1, PLAYDATTAG_START, samples[i][j].inst_start, PLAYDATTAG_SIZE, samples[i][j].inst_size, PLAYDATTAG_GAIN, (int)(100 * samples[i][j].inst_gain));
-					// f_sync(&temp_file);
-				}
+//Returns 1 when the index file is written (or failed), see write_sampleindex_result()
+uint8_t write_sampleindex_step(void)
+{
+	uint32_t	h;
+	char		path[_MAX_LFN+1], bootbakpath[_MAX_LFN+1];
+
+	switch (idxw_step)
+	{
+		// Re-serialize the bank if it changed since the last write
+		case (IDXW_SERIALIZE):
+			h = calc_bank_hash(idxw_bank);
+			if (!bank_text_len[idxw_bank] || h!=bank_text_hash[idxw_bank])
+			{
+				//A truncated bank would lose samples from the index file, so don't write it at all
+				if (serialize_bank(idxw_bank)) {idxw_res = FR_INT_ERR; idxw_step = IDXW_DONE; break;}
+				bank_text_hash[idxw_bank] = h;
 			}
-			f_printf(&temp_file, "\n");
-			// f_sync(&temp_file);
-		}
 
-		// Write global info to file
-		f_printf(&temp_file, "Timestamp: %d\n", get_fattime());		// timestamp
-		f_printf(&temp_file, EOF_TAG);								// end of file tag
-		f_printf(&temp_file, "\n");								//text editors report an error if file does not end in newline
+			if (++idxw_bank >= MAX_NUM_BANKS)
+			{
+				idxw_bank = 0;
+				idxw_step = IDXW_OPEN;
+			}
+		break;
 
-		// CLOSE INDEX FILE
-		f_sync(&temp_file);
-		f_close(&temp_file);
-		return(FR_OK);
-	}
-}
+		// CREATE INDEX FILE
+		// previous index files are replaced
+		case (IDXW_OPEN):
+			// Check for system dir
+			idxw_res = check_sys_dir();
+			if (idxw_res!=FR_OK) {idxw_step = IDXW_DONE; break;}
+
+			// file index path
+			str_cat(path, SYS_DIR_SLASH,SAMPLE_INDEX_FILE);
 
-uint8_t index_write_wrapper(void){
+			// backup index at boot
+			if (flags[BootBak])
+			{
+				str_cat(bootbakpath, SYS_DIR_SLASH, SAMPLE_BOOTBAK_FILE);								// compute path to boot backups
+				f_unlink(bootbakpath);																	// delete existing boot backups
+				f_rename(path,bootbakpath);																// set boot backup to sample index, as found on the SD card
+				flags[BootBak]=0;																		// do not update boot backup file until next boot
+			}
 
-	FRESULT res;
-	uint8_t	html_res;
+			idxw_res = f_open(&idxw_file, path, FA_WRITE | FA_CREATE_ALWAYS);							// (re)create sample.index file
+			if (idxw_res!=FR_OK) {idxw_step = IDXW_DONE; break;}
 
-	// WRITE INDEX FILE
-	flags[RewriteIndex]=MAGENTA;
-	res = write_sampleindex_file();
-	if (res!=FR_OK) return(1);
+			out_open(&idxw_file);
 
-	// WRITE SAMPLE LIST HTML FILE
-	flags[RewriteIndex]=LAVENDER;
-	html_res = write_samplelist();
-	return (html_res);
+			// write firmware version
+			out_puts("Firmware Version: ");
+			out_putint(FW_MAJOR_VERSION, 0);
+			out_puts(".");
+			out_putint(FW_MINOR_VERSION, 0);
+			out_puts("\n\n");
+
+			idxw_step = IDXW_WRITE_BANKS;
+		break;
+
+		// write banks/sample to index file
+		case (IDXW_WRITE_BANKS):
+			out_write(BANK_TEXT(idxw_bank), bank_text_len[idxw_bank]);
+
+			if (++idxw_bank >= MAX_NUM_BANKS)
+				idxw_step = IDXW_CLOSE;
+		break;
+
+		case (IDXW_CLOSE):
+			// Write global info to file
+			out_puts("Timestamp: ");
+			out_putint(get_fattime(), 0);	// timestamp
+			out_puts("\n");
+			out_puts(EOF_TAG);				// end of file tag
+			out_puts("\n");					//text editors report an error if file does not end in newline
+
+			// CLOSE INDEX FILE
+			idxw_res = out_close();
+			if (idxw_res!=FR_OK) {idxw_step = IDXW_DONE; break;}
+
+			// Save the sample headers so the next boot doesn't have to parse every file
+			write_sample_header_cache_begin();
+			idxw_step = IDXW_HDRCACHE;
+		break;
+
+		// (a missing or stale header cache is not an error: headers are read from the files instead)
+		case (IDXW_HDRCACHE):
+			if (write_sample_header_cache_step())
+				idxw_step = IDXW_DONE;
+		break;
+
+		case (IDXW_DONE):
+		break;
+	}
+
+	return (idxw_step == IDXW_DONE);
 }
 
+FRESULT write_sampleindex_file(void)
+{
+	write_sampleindex_begin();
+
+	while (!write_sampleindex_step()) {;}
 
+	return (write_sampleindex_result());
+}
+
+//
 // WRITE SAMPLE LIST HTML
 // previous files are replaced
-uint8_t write_samplelist(void)
+// write_samplelist_step() writes one bank each time it's called
+//
+enum SampleListSteps {
+	HTML_OPEN,
+	HTML_WRITE_BANKS,
+	HTML_CLOSE,
+	HTML_DONE
+};
+
+static FIL		html_file;
+static uint8_t	html_step = HTML_DONE;
+static uint8_t	html_bank;
+static FRESULT	html_res;
+
+void write_samplelist_begin(void)
 {
+	html_step	= HTML_OPEN;
+	html_bank	= 0;
+	html_res	= FR_OK;
+}
 
-	FIL		temp_file;
-	FRESULT	res;
-	uint8_t	i, j;
+//Returns 1 when the file is written (or failed)
+uint8_t write_samplelist_step(void)
+{
+	uint8_t		i, j;
 	uint32_t	minutes, seconds;
 	uint8_t		bank_is_empty;
 	char		b_color[11]; //Lavender-5\0
 
+	if (html_step == HTML_DONE) return(1);
+
 	// create file
-	res = f_open(&temp_file, SAMPLELIST_FILE , FA_WRITE | FA_CREATE_ALWAYS);
-	if (res != FR_OK) return(1);
-	f_sync(&temp_file);
+	if (html_step == HTML_OPEN)
+	{
+		html_res = f_open(&html_file, SAMPLELIST_FILE , FA_WRITE | FA_CREATE_ALWAYS);
+		if (html_res != FR_OK) {html_step = HTML_DONE; return(1);}
 
-	// WRITE 'SAMPLES' INFO TO SAMPLE LIST
-	// f_printf(&temp_file, "<!DOCTYPE html>\n<html>\n<body style=\"padding-left: 100px; background-color:#F8F9FD;\">\n<br>Firmware Version: %d.%d<br>\n<h1>SAMPLE LIST</h1><br>\n",FW_MAJOR_VERSION,FW_MINOR_VERSION);
-	f_printf(&temp_file, "<!DOCTYPE html>\n<html>\n\
+		out_open(&html_file);
+
+		// WRITE 'SAMPLES' INFO TO SAMPLE LIST
+		out_puts("<!DOCTYPE html>\n<html>\n\
 <head>\n<style type=\"text/css\">\n@media print\n{\n   div{page-break-inside: avoid;}\n   body {font-size:7pt;}\n   h2 {font-size:11pt;}\n   h1 {font-size:13pt;}\n}\n</style>\n</head>\n\
-<body style=\"padding-left: 100px; background-color:#F8F9FD;\">\n<br>Firmware Version: %d.%d<br>\n<h1>SAMPLE LIST</h1><br>\n",FW_MAJOR_VERSION,FW_MINOR_VERSION);
-	f_sync(&temp_file);
+<body style=\"padding-left: 100px; background-color:#F8F9FD;\">\n<br>Firmware Version: ");
+		out_putint(FW_MAJOR_VERSION, 0);
+		out_puts(".");
+		out_putint(FW_MINOR_VERSION, 0);
+		out_puts("<br>\n<h1>SAMPLE LIST</h1><br>\n");
+
+		html_step = HTML_WRITE_BANKS;
+		return(0);
+	}
 
-	// For each bank
-	for (i=0; i<MAX_NUM_BANKS; i++){
+	// CLOSE FILE
+	if (html_step == HTML_CLOSE)
+	{
+		out_puts("</body>\n</html>");
+		html_res = out_close();
+		html_step = HTML_DONE;
+		return(1);
+	}
 
-		// check if bank is empty
-		bank_is_empty=1; j=0;
-		while(j<NUM_SAMPLES_PER_BANK){
-			if (samples[i][j].filename[0]!=0) {bank_is_empty=0; break;}
-			j++;
-		}
+	i = html_bank++;
+	if (html_bank >= MAX_NUM_BANKS) html_step = HTML_CLOSE;
 
-		// if bank isn't empty
-		if(!bank_is_empty){
+	// check if bank is empty
+	bank_is_empty=1; j=0;
+	while(j<NUM_SAMPLES_PER_BANK){
+		if (samples[i][j].filename[0]!=0) {bank_is_empty=0; break;}
+		j++;
+	}
 
-			// Print bank name to file
-			bank_to_color(i, b_color);
-			if (i>0) {f_printf(&temp_file, "<br>\n");f_sync(&temp_file);}
-			f_printf(&temp_file, "\n<div>\n<h2>%s</h2>\n<table>\n", b_color);
-			f_sync(&temp_file);
+	// if bank isn't empty
+	if(!bank_is_empty){
 
-			// Print sample name to sample list, for each sample in bank
-			for (j=0; j<NUM_SAMPLES_PER_BANK; j++)
+		// Print bank name to file
+		bank_to_color(i, b_color);
+		if (i>0) out_puts("<br>\n");
+		out_puts("\n<div>\n<h2>");
+		out_puts(b_color);
+		out_puts("</h2>\n<table>\n");
+
+		// Print sample name to sample list, for each sample in bank
+		for (j=0; j<NUM_SAMPLES_PER_BANK; j++)
+		{
+			if(samples[i][j].filename[0]!=0)
 			{
 				seconds = (samples[i][j].sampleSize/samples[i][j].blockAlign) / samples[i][j].sampleRate;
 				minutes = seconds / 60;
 				seconds-= minutes * 60;
 				if (!minutes && !seconds) seconds =1;
-				if(samples[i][j].filename[0]!=0)	f_printf(&temp_file, "<tr>\n<td>%d]  %s</td>\n<td>........... [%02d:%02d]</td>\n</tr>\n", j+1, samples[i][j].filename, minutes, seconds);
-				else								f_printf(&temp_file, "<tr>\n<td>%d]&nbsp;&nbsp;(empty slot)</td>\n<td>&nbsp;</td>\n</tr>\n", j+1);
-				f_sync(&temp_file);
-			}
 
-			f_printf(&temp_file, "</table><br>\n</div>\n");
-			f_sync(&temp_file);
+				out_puts("<tr>\n<td>");
+				out_putint(j+1, 0);
+				out_puts("]  ");
+				out_puts(samples[i][j].filename);
+				out_puts("</td>\n<td>........... [");
+				out_putint(minutes, 2);
+				out_puts(":");
+				out_putint(seconds, 2);
+				out_puts("]</td>\n</tr>\n");
+			}
+			else
+			{
+				out_puts("<tr>\n<td>");
+				out_putint(j+1, 0);
+				out_puts("]&nbsp;&nbsp;(empty slot)</td>\n<td>&nbsp;</td>\n</tr>\n");
+			}
 		}
-	}
-	f_printf(&temp_file, "</body>\n</html>");
-	f_sync(&temp_file);
 
-	// CLOSE FILE
-	f_close(&temp_file);
+		out_puts("</table><br>\n</div>\n");
+	}
 	return(0);
 }
 
-
-FRESULT backup_sampleindex_file(void)
+uint8_t write_samplelist(void)
 {
-	// ToDo: could just duplicate data and open resulting pointer
-	// ... if dup is not available
-	// FILE *fp2 = fdopen (dup (fileno (fp)), "r");
+	write_samplelist_begin();
 
-	FIL		indexfile, backupindex;
-	FRESULT		res_index, res_bak;
-	char		read_buff[512];
-	uint32_t	bytes_read, bytes_written;
+	while (!write_samplelist_step()) {;}
+
+	return (html_res==FR_OK ? 0 : 1);
+}
+
+
+//
+// Copies the index file to the backup file
+// backup_sampleindex_step() copies one 512-byte block each time it's called (see bg_jobs.c)
+//
+static FIL		bak_index_file, bak_backup_file;
+static uint8_t	bak_open = 0;
+static FRESULT	bak_res;
+
+FRESULT backup_sampleindex_begin(void)
+{
 	char		idx_full_path[_MAX_LFN+1];
 	char		bak_full_path[_MAX_LFN+1];
 
+	bak_open = 0;
+
 	// Open index
 	str_cat(idx_full_path, SYS_DIR_SLASH, SAMPLE_INDEX_FILE);
-	res_index  = f_open(&indexfile, idx_full_path, FA_READ);
-	if(res_index!=FR_OK) {f_close(&indexfile);   return (res_index);}
+	bak_res  = f_open(&bak_index_file, idx_full_path, FA_READ);
+	if(bak_res!=FR_OK) {f_close(&bak_index_file); return (bak_res);}
 
 	// Open Backup file
 	str_cat(bak_full_path, SYS_DIR_SLASH, SAMPLE_BAK_FILE);
-	res_bak = f_open(&backupindex, bak_full_path, FA_WRITE | FA_CREATE_ALWAYS);
-	if(res_bak!=FR_OK) {f_close(&indexfile);f_close(&backupindex); return (res_bak);}
+	bak_res = f_open(&bak_backup_file, bak_full_path, FA_WRITE | FA_CREATE_ALWAYS);
+	if(bak_res!=FR_OK) {f_close(&bak_index_file);f_close(&bak_backup_file); return (bak_res);}
 
-	while(1)
-	{
-		// Read index file
-		f_read(&indexfile, read_buff, 512, &bytes_read);
+	bak_open = 1;
+	return (FR_OK);
+}
 
-		// Write into backup file
-		f_write(&backupindex, read_buff, bytes_read, &bytes_written);
-		f_sync(&backupindex);
+//Returns 1 when the backup is written (or failed), see backup_sampleindex_result()
+uint8_t backup_sampleindex_step(void)
+{
+	char		read_buff[512];
+	uint32_t	bytes_read, bytes_written;
 
-		if (bytes_written!=bytes_read)	//error
-		{
-			f_close(&indexfile);
-			f_close(&backupindex);
-			return (FR_INT_ERR);		// ToDo: there should be a way to report this error more accurately
-		}
+	if (!bak_open) return(1);
 
-		if (f_eof(&indexfile))
-		{
-			f_close(&indexfile);
-			f_close(&backupindex);
-			return (FR_OK);
-		}
-	}
+	// Read index file
+	f_read(&bak_index_file, read_buff, 512, &bytes_read);
+
+	// Write into backup file
+	f_write(&bak_backup_file, read_buff, bytes_read, &bytes_written);
+
+	if (bytes_written!=bytes_read)	//error
+		bak_res = FR_INT_ERR;		// ToDo: there should be a way to report this error more accurately
+
+	else if (!f_eof(&bak_index_file))
+		return(0);
+
+	f_close(&bak_index_file);
+	f_close(&bak_backup_file);
+	bak_open = 0;
+	return(1);
+}
+
+FRESULT backup_sampleindex_result(void)
+{
+	return (bak_res);
+}
+
+FRESULT backup_sampleindex_file(void)
+{
+	if (backup_sampleindex_begin()!=FR_OK) return (bak_res);
+
+	while (!backup_sampleindex_step()) {;}
+
+	return (bak_res);
 }
 
 //Returns 0 if invalid file (file can't be opened/read, or no EOF_TAG at end of file)
@@ -308,6 +610,32 @@ uint8_t check_sampleindex_valid(char *indexfilename)
 }
 
 
+//
+// Index loading
+// The index file is parsed one line at a time by load_sampleindex_step(), so the loading
+// can be spread over several main loop passes (see bg_jobs.c).
+// load_sampleindex_file() does the whole thing at once.
+//
+static struct IndexLoader {
+	FIL			temp_file;
+	FIL			hdrcache_file;
+	FIL			*hdrcache;
+	char		folder_path[_MAX_LFN+2];
+	char		file_name[_MAX_LFN+1];
+	char		full_path[_MAX_LFN+1];
+	uint8_t		banks;
+	uint8_t		cur_bank;
+	uint8_t		cur_sample;
+	uint8_t		arm_bank;
+	uint8_t		load_data;
+	uint8_t		loaded_header;
+	uint8_t		read_name;
+	uint8_t		force_reload;
+	uint8_t		skip_cur_bank;
+	uint8_t		invalid_banknum;
+	uint32_t	num_buff;
+} ld;
+
 //Loads a sample index file
 //Sets samples[][] for all banks, or just one bank (specified with banks=bank# or banks=MAX_NUM_BANKS --> all banks)
 //
@@ -317,320 +645,344 @@ uint8_t check_sampleindex_valid(char *indexfilename)
 //
 uint8_t load_sampleindex_file(uint8_t use_backup, uint8_t banks)
 {
-	FIL		temp_file, temp_wav_file;
+	if (load_sampleindex_begin(use_backup, banks)) return(1);
+
+	while (!load_sampleindex_step()) {;}
+
+	return (load_sampleindex_end());
+}
+
+//Opens the index file (or its backup) for load_sampleindex_step()
+//Returns 0 if the file is opened, 1 if there's no valid file
+uint8_t load_sampleindex_begin(uint8_t use_backup, uint8_t banks)
+{
 	FRESULT	res;
-	uint8_t		head_load;
-	char		read_buffer[_MAX_LFN+1], folder_path[_MAX_LFN+2], file_name[_MAX_LFN+1], full_path[_MAX_LFN+1];
-	uint8_t		cur_bank=0, cur_sample=0, arm_bank=0, load_data=0, loaded_header=0, read_name=0;
-	uint32_t	num_buff=UINT32_MAX;
-	char		token[_MAX_LFN+1];
-	uint8_t		l;
-	uint8_t	force_reload  = 2;
-	uint8_t		skip_cur_bank = 0;
-	uint8_t	separator=0;
-	uint8_t	invalid_banknum=0;
 
+	ld.banks			= banks;
+	ld.cur_bank			= 0;
+	ld.cur_sample		= 0;
+	ld.arm_bank			= 0;
+	ld.load_data		= 0;
+	ld.loaded_header	= 0;
+	ld.read_name		= 0;
+	ld.num_buff			= UINT32_MAX;
+	ld.force_reload		= 2;
+	ld.skip_cur_bank	= 0;
+	ld.invalid_banknum	= 0;
 
 	// handle backup vs normal index file, and open
 	if (use_backup==USE_INDEX_FILE) {if (!check_sampleindex_valid(SAMPLE_INDEX_FILE)) use_backup=USE_BACKUP_FILE;}	//If normal non-backup file requested but isn't a valid file, use the backup file instead
 	if (use_backup==USE_BACKUP_FILE){if (!check_sampleindex_valid(SAMPLE_BAK_FILE)) return(1); }					// If we requested the backup file (or if we requested the normal file, and it was invalid, Then see if the backup file is valid. If not, then we exit with an error
-	if (use_backup){str_cat(full_path, SYS_DIR_SLASH, SAMPLE_BAK_FILE);}
-	else{str_cat(full_path, SYS_DIR_SLASH, SAMPLE_INDEX_FILE);}
-	res = f_open(&temp_file,full_path, FA_READ);
+	if (use_backup){str_cat(ld.full_path, SYS_DIR_SLASH, SAMPLE_BAK_FILE);}
+	else{str_cat(ld.full_path, SYS_DIR_SLASH, SAMPLE_INDEX_FILE);}
+	res = f_open(&ld.temp_file, ld.full_path, FA_READ);
 	if (res != FR_OK) return(1);																					//file not found
 
-	// Read File
-	while (!f_eof(&temp_file))																						// until we reach the eof
+	// Sample headers are taken from the header cache when the file size/timestamp match, and verified later
+	if (open_sample_header_cache(&ld.hdrcache_file))	ld.hdrcache = &ld.hdrcache_file;
+	else												ld.hdrcache = 0;
+
+	return(0);
+}
+
+//Reads and parses the next line of the index file
+//Returns 1 when the end of the file is reached
+uint8_t load_sampleindex_step(void)
+{
+	FILINFO	wav_info;
+	FRESULT	res;
+	uint8_t		head_load;
+	char		read_buffer[_MAX_LFN+1];
+	char		token[_MAX_LFN+1];
+	uint8_t		l;
+	uint8_t	separator=0;
+
+	if (f_eof(&ld.temp_file)) return(1);																			// until we reach the eof
+
+	f_gets(read_buffer, _MAX_LFN+1, &ld.temp_file);																// Read next line
+	if(read_buffer[str_len(read_buffer)-1] == '\n') read_buffer[str_len(read_buffer)-1]=0;						// Remove \n from buffer (mac)
+	if(read_buffer[str_len(read_buffer)-1] == '\r')	read_buffer[str_len(read_buffer)-1]=0;						// Remove \r from end of buffer as needed (PC)
+	if (str_found(read_buffer, EOF_TAG))	return(1);																// Check if it's the end of the file
+	if((ld.read_name<1) && (ld.load_data==0)) str_tok(read_buffer,' ', token);										// tokenize at space if we're not trying to read_name which is both [reading name] and [reading play  data] cases
+	else str_cpy(token, read_buffer);																			// otherwise, copy read buffer into token
+	separator = str_cmp(token,"--------------------");															// set separator value
+
+	// Read full line from file
+	while(token[0]!='\0')																						// While we're not finished reading line
 	{
-		f_gets(read_buffer, _MAX_LFN+1, &temp_file);																// Read next line
-		if(read_buffer[str_len(read_buffer)-1] == '\n') read_buffer[str_len(read_buffer)-1]=0;						// Remove \n from buffer (mac)
-		if(read_buffer[str_len(read_buffer)-1] == '\r')	read_buffer[str_len(read_buffer)-1]=0;						// Remove \r from end of buffer as needed (PC)
-		if (str_found(read_buffer, EOF_TAG))	break;																// Check if it's the end of the file
-		if((read_name<1) && (load_data==0)) str_tok(read_buffer,' ', token);										// tokenize at space if we're not trying to read_name which is both [reading name] and [reading play  data] cases
-		else str_cpy(token, read_buffer);																			// otherwise, copy read buffer into token
-		separator = str_cmp(token,"--------------------");															// set separator value
-
-		// Read full line from file
-		while(token[0]!='\0')																						// While we're not finished reading line
+		// Load bank data
+		if ((!ld.loaded_header) && (!ld.skip_cur_bank))
 		{
-			// Load bank data
-			if ((!loaded_header) && (!skip_cur_bank))
-			{
-				// Bank name start: "--------------------"
-				if ( separator && !arm_bank) {arm_bank++; invalid_banknum=0; str_tok(read_buffer,' ', token);}
+			// Bank name start: "--------------------"
+			if ( separator && !ld.arm_bank) {ld.arm_bank++; ld.invalid_banknum=0; str_tok(read_buffer,' ', token);}
 
-				// Bank number
-				else if	(!separator &&  arm_bank)
-				{
-					cur_bank=color_to_bank(token);																	// define bank number
-					if (banks != MAX_NUM_BANKS){if (banks !=  cur_bank) skip_cur_bank = 1;}						// request bank to be skipped if it is not to be loaded
-					if(cur_bank>=MAX_NUM_BANKS){invalid_banknum=1;}													// if bank number invalid, mark as such
-					str_tok(read_buffer,' ', token);
-				}
-				// Bank name end: "--------------------"
-				else if ( separator &&  arm_bank) {arm_bank=0; str_tok(read_buffer,' ', token);}
-
-				// Folder path
-				else if (str_cmp(token, "path:"))
-				{
-					str_cpy(folder_path, read_buffer);
-					loaded_header = 1;
-					cur_sample = 0;
-					token[0]='\0';
-					read_name = 1;
-				}
+			// Bank number
+			else if	(!separator &&  ld.arm_bank)
+			{
+				ld.cur_bank=color_to_bank(token);																	// define bank number
+				if (ld.banks != MAX_NUM_BANKS){if (ld.banks !=  ld.cur_bank) ld.skip_cur_bank = 1;}						// request bank to be skipped if it is not to be loaded
+				if(ld.cur_bank>=MAX_NUM_BANKS){ld.invalid_banknum=1;}													// if bank number invalid, mark as such
+				str_tok(read_buffer,' ', token);
 			}
+			// Bank name end: "--------------------"
+			else if ( separator &&  ld.arm_bank) {ld.arm_bank=0; str_tok(read_buffer,' ', token);}
 
-			// Load file name
-			else if ((!separator&&(read_name==1)) && (!skip_cur_bank))
+			// Folder path
+			else if (str_cmp(token, "path:"))
 			{
+				str_cpy(ld.folder_path, read_buffer);
+				ld.loaded_header = 1;
+				ld.cur_sample = 0;
+				token[0]='\0';
+				ld.read_name = 1;
+			}
+		}
 
-				// save file name
-				str_cpy(file_name, token);
+		// Load file name
+		else if ((!separator&&(ld.read_name==1)) && (!ld.skip_cur_bank))
+		{
 
-				// move on to reading data only if file name is valid
-				if (file_name[0]!='-') {read_name++;}
+			// save file name
+			str_cpy(ld.file_name, token);
 
-				token[0] = '\0';
-			}
+			// move on to reading data only if file name is valid
+			if (ld.file_name[0]!='-') {ld.read_name++;}
 
-			// Load .wav header data information and play data
-			else if (((!separator)&&(read_name>1)) && (!skip_cur_bank))
-			{
+			token[0] = '\0';
+		}
 
-				// HANDLE MISSING PLAY DATA
-				if(is_wav(read_buffer))																															// check if read buffer is a filename.
+		// Load .wav header data information and play data
+		else if (((!separator)&&(ld.read_name>1)) && (!ld.skip_cur_bank))
+		{
+
+			// HANDLE MISSING PLAY DATA
+			if(is_wav(read_buffer))																															// check if read buffer is a filename.
+			{
+				// load missing play data on current file
+				if (!ld.load_data || ld.load_data==SAMPLE_SLOT)																										// if no slot for previous sample
 				{
-					// load missing play data on current file
-					if (!load_data || load_data==SAMPLE_SLOT)																										// if no slot for previous sample
+					// load previous sample in next available slot (will be overwitten if a following file specifically assigned there)
+					while(samples[ld.cur_bank][ld.cur_sample].file_found)																								// until empty slot found
+					{
+						if(ld.cur_sample<NUM_SAMPLES_PER_BANK-1){ld.cur_sample++;}																					// move to next sample slot
+						else{ld.load_data=0; ld.read_name = 1; break;}																								// exit if cur_sample==NUM_SAMPLES_PER_BANK
+					}
+					if (!samples[ld.cur_bank][ld.cur_sample].file_found)  																							// if empty slot found
 					{
-						// load previous sample in next available slot (will be overwitten if a following file specifically assigned there)
-						while(samples[cur_bank][cur_sample].file_found)																								// until empty slot found
+						// TRY AND OPEN FILE
+						res = FR_INT_ERR;
+						if (str_pos('/', ld.file_name) != 0xFFFFFFFF)
 						{
-							if(cur_sample<NUM_SAMPLES_PER_BANK-1){cur_sample++;}																					// move to next sample slot
-							else{load_data=0; read_name = 1; break;}																								// exit if cur_sample==NUM_SAMPLES_PER_BANK
+							str_cpy(ld.full_path, ld.file_name);
+							res = f_stat(ld.full_path, &wav_info);
 						}
-						if (!samples[cur_bank][cur_sample].file_found)  																							// if empty slot found
+						if (res!=FR_OK)																															// if file wasn't found
 						{
-							// TRY AND OPEN FILE
-							res = FR_INT_ERR;
-							if (str_pos('/', file_name) != 0xFFFFFFFF)
-							{
-								str_cpy(full_path, file_name);
-								// DEBUG0_ON;
-								res = f_open(&temp_wav_file, full_path, FA_READ);
-								// DEBUG0_OFF;
+							l = str_len(ld.folder_path);																											//add a slash to folder_path if it doesn't have one, and file_name doesn't start with one
+							if (ld.folder_path[l-1] !='/' && ld.file_name[0]!='/'){
+								ld.folder_path[l] = '/';
+								ld.folder_path[l+1] = '\0';
 							}
-							if (res!=FR_OK)																															// if file wasn't found
-							{
-								l = str_len(folder_path);																											//add a slash to folder_path if it doesn't have one, and file_name doesn't start with one
-								if (folder_path[l-1] !='/' && file_name[0]!='/'){
-									folder_path[l] = '/';
-									folder_path[l+1] = '\0';
-								}
-								str_cat(full_path, folder_path, file_name);
-								// DEBUG0_ON;
-								res = f_open(&temp_wav_file, full_path, FA_READ);																					//try to open folder_path/file_name
-								// DEBUG0_OFF;
-							}
-							if (res==FR_OK)																															// file found
-							{
-								if (!invalid_banknum)																												// Sanity check: cur_bank must be within range
-								{
-									str_cpy(samples[cur_bank][cur_sample].filename, full_path);																	// open file_name (not read_buffer)
-									force_reload = 0;																												// At least a sample was loaded
-									head_load = load_sample_header(&samples[cur_bank][cur_sample], &temp_wav_file);												// load sample information from .wav header
-									f_close(&temp_wav_file);																										// close wav file
-									if (head_load!=FR_OK){load_data=0; read_name = 1; break;}																		// if header information couldn't load, treat file as if it couldn'tbe found
-									else{samples[cur_bank][cur_sample].file_found = 1; load_data=PLAY_START;}														// othewise set file as found and move on to next play data
-								}
-								else {f_close(&temp_wav_file); load_data=0; read_name = 1; break;}																	// exit if cur_bank out of range
-							}
-							else if (res!=FR_OK)																													// file not found
+							str_cat(ld.full_path, ld.folder_path, ld.file_name);
+							res = f_stat(ld.full_path, &wav_info);																									//try to find folder_path/file_name
+						}
+						if (res==FR_OK)																															// file found
+						{
+							if (!ld.invalid_banknum)																												// Sanity check: cur_bank must be within range
 							{
-								if (!invalid_banknum)
-								{
-									str_cpy(samples[cur_bank][cur_sample].filename, full_path);																		// Copy the file name into the sample struct element - This is used to find the missing file, or other files in its folder
-									samples[cur_bank][cur_sample].file_found = 0;																					// Mark file as not found
-								}
-								else {f_close(&temp_wav_file); load_data=0; read_name = 1; break;}																	// exit if cur_bank out of range
-								load_data=0; read_name = 1; break;																									// skip loading sample play information
+								str_cpy(samples[ld.cur_bank][ld.cur_sample].filename, ld.full_path);																	// open file_name (not read_buffer)
+								ld.force_reload = 0;																												// At least a sample was loaded
+								head_load = load_sample_header_cached(&samples[ld.cur_bank][ld.cur_sample], &wav_info, ld.hdrcache, ld.cur_bank, ld.cur_sample);			// load sample information from header cache or .wav header
+								if (head_load!=FR_OK){ld.load_data=0; ld.read_name = 1; break;}																		// if header information couldn't load, treat file as if it couldn'tbe found
+								else{samples[ld.cur_bank][ld.cur_sample].file_found = 1; ld.load_data=PLAY_START;}														// othewise set file as found and move on to next play data
 							}
+							else {ld.load_data=0; ld.read_name = 1; break;}																							// exit if cur_bank out of range
 						}
-						else																																		// otherwise, if no empty slot available
+						else if (res!=FR_OK)																													// file not found
 						{
-							samples[cur_bank][cur_sample].file_found = 0;																							// mark file as not found
-							load_data=0; read_name = 1; break;																										// skip loading sample play information
+							if (!ld.invalid_banknum)
+							{
+								str_cpy(samples[ld.cur_bank][ld.cur_sample].filename, ld.full_path);																		// Copy the file name into the sample struct element - This is used to find the missing file, or other files in its folder
+								samples[ld.cur_bank][ld.cur_sample].file_found = 0;																					// Mark file as not found
+							}
+							else {ld.load_data=0; ld.read_name = 1; break;}																							// exit if cur_bank out of range
+							ld.load_data=0; ld.read_name = 1; break;																									// skip loading sample play information
 						}
 					}
-																																									// Set default values for start/end/size/gain
-					if (load_data == PLAY_START){samples[cur_bank][cur_sample].inst_start = 0;											load_data++;}
-					if (load_data == PLAY_SIZE ){samples[cur_bank][cur_sample].inst_size  = samples[cur_bank][cur_sample].sampleSize;
-												 samples[cur_bank][cur_sample].inst_end  = samples[cur_bank][cur_sample].sampleSize;	load_data++;}
-					if (load_data == PLAY_GAIN ){samples[cur_bank][cur_sample].inst_gain  =1;											load_data=0; read_name = 1; str_cpy(token, read_buffer); continue;}	// use read_buffer to load next file name
+					else																																		// otherwise, if no empty slot available
+					{
+						samples[ld.cur_bank][ld.cur_sample].file_found = 0;																							// mark file as not found
+						ld.load_data=0; ld.read_name = 1; break;																										// skip loading sample play information
+					}
 				}
+																																								// Set default values for start/end/size/gain
+				if (ld.load_data == PLAY_START){samples[ld.cur_bank][ld.cur_sample].inst_start = 0;											ld.load_data++;}
+				if (ld.load_data == PLAY_SIZE ){samples[ld.cur_bank][ld.cur_sample].inst_size  = samples[ld.cur_bank][ld.cur_sample].sampleSize;
+											 samples[ld.cur_bank][ld.cur_sample].inst_end  = samples[ld.cur_bank][ld.cur_sample].sampleSize;	ld.load_data++;}
+				if (ld.load_data == PLAY_GAIN ){samples[ld.cur_bank][ld.cur_sample].inst_gain  =1;											ld.load_data=0; ld.read_name = 1; str_cpy(token, read_buffer); continue;}	// use read_buffer to load next file name
+			}
 
-				// HANDLE DEFINED PLAY DATA
-				else if (read_buffer[0]=='-')
+			// HANDLE DEFINED PLAY DATA
+			else if (read_buffer[0]=='-')
+			{
+				ld.num_buff = str_xt_int(read_buffer);
+				if (!ld.load_data)
 				{
-					num_buff = str_xt_int(read_buffer);
-					if (!load_data)
-					{
-						if(str_startswith_nocase(read_buffer, PLAYDATTAG_SLOT)){load_data=SAMPLE_SLOT;}
+					if(str_startswith_nocase(read_buffer, PLAYDATTAG_SLOT)){ld.load_data=SAMPLE_SLOT;}
 
-						// HANDLE MISSING SLOT ENTRY
-						else
+					// HANDLE MISSING SLOT ENTRY
+					else
+					{
+						// find next available slot
+						while(samples[ld.cur_bank][ld.cur_sample].file_found)																	// until empty slot found
 						{
-							// find next available slot
-							while(samples[cur_bank][cur_sample].file_found)																	// until empty slot found
-							{
-								if(cur_sample<NUM_SAMPLES_PER_BANK-1){cur_sample++;}														// move to next sample slot
-								else{break;}																								// exit if cur_sample==NUM_SAMPLES_PER_BANK
-							}
-							if (samples[cur_bank][cur_sample].file_found)  																// if no empty slot
-							{
-								str_cpy(samples[cur_bank][cur_sample].filename, full_path);													// keep track of unused file
-								samples[cur_bank][cur_sample].file_found = 0;																// Mark file as not found
-								load_data=0; token[0] = '\0'; read_name = 1; break;															// skip loading sample play information
-							}
-							else{num_buff = cur_sample+1; load_data=SAMPLE_SLOT;}															// keep on loading play data
+							if(ld.cur_sample<NUM_SAMPLES_PER_BANK-1){ld.cur_sample++;}														// move to next sample slot
+							else{break;}																								// exit if cur_sample==NUM_SAMPLES_PER_BANK
 						}
+						if (samples[ld.cur_bank][ld.cur_sample].file_found)  																// if no empty slot
+						{
+							str_cpy(samples[ld.cur_bank][ld.cur_sample].filename, ld.full_path);													// keep track of unused file
+							samples[ld.cur_bank][ld.cur_sample].file_found = 0;																// Mark file as not found
+							ld.load_data=0; token[0] = '\0'; ld.read_name = 1; break;															// skip loading sample play information
+						}
+						else{ld.num_buff = ld.cur_sample+1; ld.load_data=SAMPLE_SLOT;}															// keep on loading play data
 					}
+				}
 
-					if  (load_data == SAMPLE_SLOT)																							// if the data loading has just been armed
-					{
-						if (num_buff == UINT32_MAX){																						// if no slot number not indicated
-							samples[cur_bank][cur_sample].file_found = 0;																	// mark file as not found
-							load_data=0; token[0] = '\0'; read_name = 1; break;																// skip loading sample play information
-						}
+				if  (ld.load_data == SAMPLE_SLOT)																							// if the data loading has just been armed
+				{
+					if (ld.num_buff == UINT32_MAX){																						// if no slot number not indicated
+						samples[ld.cur_bank][ld.cur_sample].file_found = 0;																	// mark file as not found
+						ld.load_data=0; token[0] = '\0'; ld.read_name = 1; break;																// skip loading sample play information
+					}
 
-						// Update sample bank number
-						cur_sample=num_buff-1;
+					// Update sample bank number
+					ld.cur_sample=ld.num_buff-1;
 
-						// ToDo (H) Move slot number check here
-						// ToDo (H) check requested slot number against what's already used and update accordingly
+					// ToDo (H) Move slot number check here
+					// ToDo (H) check requested slot number against what's already used and update accordingly
 
-						//If filename contains a slash, then try the filename as written
-						//--- if it doesn't contain a slash, then it's not a path, so don't assume it's in root
-						res = FR_INT_ERR; //not FR_OK
-						if (str_pos('/', file_name) != 0xFFFFFFFF)
-						{
-							str_cpy(full_path, file_name);
-							// DEBUG1_ON;
-							res = f_open(&temp_wav_file, full_path, FA_READ);
-							// DEBUG1_OFF;
+					//If filename contains a slash, then try the filename as written
+					//--- if it doesn't contain a slash, then it's not a path, so don't assume it's in root
+					res = FR_INT_ERR; //not FR_OK
+					if (str_pos('/', ld.file_name) != 0xFFFFFFFF)
+					{
+						str_cpy(ld.full_path, ld.file_name);
+						res = f_stat(ld.full_path, &wav_info);
+					}
+					if (res!=FR_OK)
+					{
+						//add a slash to folder_path if it doesn't have one, and file_name doesn't start with one
+						l = str_len(ld.folder_path);
+						if (ld.folder_path[l-1] !='/' && ld.file_name[0]!='/'){
+							ld.folder_path[l] = '/';
+							ld.folder_path[l+1] = '\0';
 						}
-						if (res!=FR_OK)
-						{
-							//add a slash to folder_path if it doesn't have one, and file_name doesn't start with one
-							l = str_len(folder_path);
-							if (folder_path[l-1] !='/' && file_name[0]!='/'){
-								folder_path[l] = '/';
-								folder_path[l+1] = '\0';
-							}
 
-							//try to open folder_path/file_name
-							str_cat(full_path, folder_path, file_name);
-							// DEBUG1_ON;
-							res = f_open(&temp_wav_file, full_path, FA_READ);
-							// DEBUG1_OFF;
-						}
+						//try to find folder_path/file_name
+						str_cat(ld.full_path, ld.folder_path, ld.file_name);
+						res = f_stat(ld.full_path, &wav_info);
+					}
 
-						if (res==FR_OK)																											//file found
+					if (res==FR_OK)																											//file found
+					{
+						//Sanity check: cur_bank and cur_sample must be in range, or we risk memory corruption
+						if (!ld.invalid_banknum && ld.cur_sample<NUM_SAMPLES_PER_BANK)
 						{
-							//Sanity check: cur_bank and cur_sample must be in range, or we risk memory corruption
-							if (!invalid_banknum && cur_sample<NUM_SAMPLES_PER_BANK)
-							{
-								str_cpy(samples[cur_bank][cur_sample].filename, full_path);													//use whatever file_name was opened
-								samples[cur_bank][cur_sample].file_found = 1;
-								force_reload = 0;																								// At least a sample was loaded
-								head_load = load_sample_header(&samples[cur_bank][cur_sample], &temp_wav_file);								// load sample information from .wav header
-								f_close(&temp_wav_file);																						// close wav file
-							}
-							else {f_close(&temp_wav_file); load_data=0; token[0] = '\0'; read_name = 1; break;}									//exit if cur_bank and/or cur_sample are out of range
-
-							// if header information couldn't load, treat file as if it couldn'tbe found
-							if (head_load!=FR_OK)
-							{
-								if (!invalid_banknum && cur_sample<NUM_SAMPLES_PER_BANK){samples[cur_bank][cur_sample].file_found = 0;}
-								load_data=0; token[0] = '\0'; read_name = 1; break;																// skip loading sample play information, and read next file
-							}
-							load_data++; token[0] = '\0';																						// read next line
+							str_cpy(samples[ld.cur_bank][ld.cur_sample].filename, ld.full_path);													//use whatever file_name was opened
+							samples[ld.cur_bank][ld.cur_sample].file_found = 1;
+							ld.force_reload = 0;																								// At least a sample was loaded
+							head_load = load_sample_header_cached(&samples[ld.cur_bank][ld.cur_sample], &wav_info, ld.hdrcache, ld.cur_bank, ld.cur_sample);	// load sample information from header cache or .wav header
 						}
+						else {ld.load_data=0; token[0] = '\0'; ld.read_name = 1; break;}									//exit if cur_bank and/or cur_sample are out of range
 
-						else if (res!=FR_OK)																									//file not found
+						// if header information couldn't load, treat file as if it couldn'tbe found
+						if (head_load!=FR_OK)
 						{
-							if (!invalid_banknum && cur_sample<NUM_SAMPLES_PER_BANK)
-							{
-								str_cpy(samples[cur_bank][cur_sample].filename, full_path);														// Copy the file name into the sample struct element
-								samples[cur_bank][cur_sample].file_found = 0;																	// Mark file as not found, later used to find missing file, or other files in its folder
-							}
-							load_data=0; token[0] = '\0'; read_name = 1; break;																	// skip loading sample play information
+							if (!ld.invalid_banknum && ld.cur_sample<NUM_SAMPLES_PER_BANK){samples[ld.cur_bank][ld.cur_sample].file_found = 0;}
+							ld.load_data=0; token[0] = '\0'; ld.read_name = 1; break;																// skip loading sample play information, and read next file
 						}
+						ld.load_data++; token[0] = '\0';																						// read next line
 					}
 
-					else if (load_data == PLAY_START)
+					else if (res!=FR_OK)																									//file not found
 					{
-						if (num_buff > samples[cur_bank][cur_sample].sampleSize)		samples[cur_bank][cur_sample].inst_start = 0;			// bound check on start pos. set it to the default value of 0 if greater than the allowed sampleSize
-						else															samples[cur_bank][cur_sample].inst_start = num_buff;
-						load_data++; token[0] = '\0'; break;																					// read next line
+						if (!ld.invalid_banknum && ld.cur_sample<NUM_SAMPLES_PER_BANK)
+						{
+							str_cpy(samples[ld.cur_bank][ld.cur_sample].filename, ld.full_path);														// Copy the file name into the sample struct element
+							samples[ld.cur_bank][ld.cur_sample].file_found = 0;																	// Mark file as not found, later used to find missing file, or other files in its folder
+						}
+						ld.load_data=0; token[0] = '\0'; ld.read_name = 1; break;																	// skip loading sample play information
 					}
+				}
 
-					else if (load_data == PLAY_SIZE)
-					{
-						if ( (num_buff < 88) || (num_buff > samples[cur_bank][cur_sample].sampleSize))	samples[cur_bank][cur_sample].inst_size = samples[cur_bank][cur_sample].sampleSize;	// bound check on play size/ is too short (<2ms @ 44kHz) or too long, set it to the default value of sampleSize
-						else																			samples[cur_bank][cur_sample].inst_size = num_buff;
+				else if (ld.load_data == PLAY_START)
+				{
+					if (ld.num_buff > samples[ld.cur_bank][ld.cur_sample].sampleSize)		samples[ld.cur_bank][ld.cur_sample].inst_start = 0;			// bound check on start pos. set it to the default value of 0 if greater than the allowed sampleSize
+					else															samples[ld.cur_bank][ld.cur_sample].inst_start = ld.num_buff;
+					ld.load_data++; token[0] = '\0'; break;																					// read next line
+				}
 
-						samples[cur_bank][cur_sample].inst_end  = samples[cur_bank][cur_sample].inst_size + samples[cur_bank][cur_sample].inst_start;	//Set the inst_end based on start and size
+				else if (ld.load_data == PLAY_SIZE)
+				{
+					if ( (ld.num_buff < 88) || (ld.num_buff > samples[ld.cur_bank][ld.cur_sample].sampleSize))	samples[ld.cur_bank][ld.cur_sample].inst_size = samples[ld.cur_bank][ld.cur_sample].sampleSize;	// bound check on play size/ is too short (<2ms @ 44kHz) or too long, set it to the default value of sampleSize
+					else																			samples[ld.cur_bank][ld.cur_sample].inst_size = ld.num_buff;
 
-						if (samples[cur_bank][cur_sample].inst_end > samples[cur_bank][cur_sample].sampleSize || samples[cur_bank][cur_sample].inst_end < 88) //Boundary check the inst_end
-							samples[cur_bank][cur_sample].inst_end = samples[cur_bank][cur_sample].sampleSize;
+					samples[ld.cur_bank][ld.cur_sample].inst_end  = samples[ld.cur_bank][ld.cur_sample].inst_size + samples[ld.cur_bank][ld.cur_sample].inst_start;	//Set the inst_end based on start and size
 
-						load_data++; token[0] = '\0'; break;																					// read next line
-					}
+					if (samples[ld.cur_bank][ld.cur_sample].inst_end > samples[ld.cur_bank][ld.cur_sample].sampleSize || samples[ld.cur_bank][ld.cur_sample].inst_end < 88) //Boundary check the inst_end
+						samples[ld.cur_bank][ld.cur_sample].inst_end = samples[ld.cur_bank][ld.cur_sample].sampleSize;
 
-					else if (load_data == PLAY_GAIN)
-					{
-						if(num_buff<10 || num_buff>500){num_buff = 100;}																		// bound check on gain
-						samples[cur_bank][cur_sample].inst_gain=num_buff/100.0f;
-						load_data=0; token[0] = '\0'; read_name = 1; break;																		// read next line, and look for for sample name
-					}
+					ld.load_data++; token[0] = '\0'; break;																					// read next line
 				}
-				else	{ token[0] = '\0'; break;}																								// read next line
-			}
 
-			// Move to next bank
-			else if (separator)
-			{
-				skip_cur_bank   = 0;
-				read_name		= 0;
-				loaded_header	= 0;
-				read_buffer[0]  = '\0';
+				else if (ld.load_data == PLAY_GAIN)
+				{
+					if(ld.num_buff<10 || ld.num_buff>500){ld.num_buff = 100;}																		// bound check on gain
+					samples[ld.cur_bank][ld.cur_sample].inst_gain=ld.num_buff/100.0f;
+					ld.load_data=0; token[0] = '\0'; ld.read_name = 1; break;																		// read next line, and look for for sample name
+				}
 			}
+			else	{ token[0] = '\0'; break;}																								// read next line
+		}
 
-			// If nothing is recognized, read new line
-			if  (
-					(
-						(!loaded_header &&
-							!(  (separator && !arm_bank)	||
-								(!separator &&  arm_bank)	||
-								(separator &&  arm_bank)	||
-								(str_cmp(token, "path:"))
-							)
+		// Move to next bank
+		else if (separator)
+		{
+			ld.skip_cur_bank   = 0;
+			ld.read_name		= 0;
+			ld.loaded_header	= 0;
+			read_buffer[0]  = '\0';
+		}
+
+		// If nothing is recognized, read new line
+		if  (
+				(
+					(!ld.loaded_header &&
+						!(  (separator && !ld.arm_bank)	||
+							(!separator &&  ld.arm_bank)	||
+							(separator &&  ld.arm_bank)	||
+							(str_cmp(token, "path:"))
 						)
-						|| skip_cur_bank
 					)
+					|| ld.skip_cur_bank
 				)
-			{
-				token[0]='\0';
-			}
+			)
+		{
+			token[0]='\0';
 		}
 	}
+	return(0);
+}
 
+//Closes the index file
+//Returns 0 if at least one sample was loaded
+uint8_t load_sampleindex_end(void)
+{
 	// close sample index file
-	f_close(&temp_file);
-
+	f_close(&ld.temp_file);
+	if (ld.hdrcache) f_close(ld.hdrcache);
 
 	// Assign samples in SD card to (previously empty) sample index
-	return(force_reload);	// OK if at least a sample was loaded
+	return(ld.force_reload);	// OK if at least a sample was loaded
 }
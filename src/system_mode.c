@@ -140,6 +140,13 @@ void update_system_mode(void)
 			else						 									global_mode[PERC_ENVELOPE] = 1; 
 		}
 
+#ifdef CPU_PROFILER
+		//RecBank : Write the CPU profile to the SD Card
+		if (check_button_pressed(RecBank)){
+			flags[WriteCPUProfile] = 1;
+		}
+#endif
+
 
 		//Edit+Play1 : Save and Exit
 		if (button_state[Edit] >= SHORT_PRESSED && button_state[Play1] >= SHORT_PRESSED && all_buttons_except(UP, (1<<Edit) | (1<<Play1)))
@@ -0,0 +1,289 @@
+/*
+ * time_stretch.c
+ *
+ * WSOLA time-stretch
+ *
+ * The speed pointer (play_buff->out) moves through the sample at the speed set by PITCH, exactly as it does
+ * when resampling, so buffering, end-of-sample and the stop point work the same in both modes.
+ * The sound comes from two grains that read at the sample's own rate (its original pitch):
+ * every TS_HOP_FRAMES, the grain that was fading in starts fading out, and a new grain starts
+ * near the speed pointer. The new grain's start is chosen within +/-TS_SEEK_FRAMES to best match the
+ * waveform of the grain fading out (highest normalized cross-correlation), so the crossfade doesn't comb-filter.
+ *
+ * The crossfade is a sin^2 window (equal gain, the two halves sum to 1.0) from ts_fade_lut.h, applied in Q15 fixed-point.
+ * A grain reads ahead of the speed pointer by up to time_stretch_lookahead() bytes,
+ * which read_storage_to_buffer() adds to the amount it buffers ahead.
+ *
+ */
+
+#include "globals.h"
+#include "sdram_driver.h"
+#include "circular_buffer.h"
+#include "time_stretch.h"
+#include "ts_fade_lut.h"
+
+#ifdef BENCHMARK_AUDIO_KERNELS
+#include "audio_codec.h"
+#include "audio_sdram.h"
+#include "ITM.h"
+#endif
+
+#define TS_SEEK_WIN_FRAMES	(2 * TS_SEEK_FRAMES + TS_CORR_FRAMES)
+#define TS_CORR_POINTS		(TS_CORR_FRAMES / TS_CORR_DECIMATE)
+
+#if TS_HOP_FRAMES != 512
+#error "ts_fade_lut.h has 512 entries: re-generate it for the new TS_HOP_FRAMES"
+#endif
+
+
+void reset_time_stretch(TimeStretchState *ts, CircularBuffer *buf)
+{
+	ts->old_addr 		= buf->out;
+	ts->new_addr 		= buf->out;
+	ts->pos_frac 		= 0;
+	ts->out_frac 		= 0.0f;
+	ts->hop_ctr 		= 0;
+	ts->seek_back_limit = 0;
+}
+
+//
+// Bytes that a grain can read ahead of play_buff->out
+// rate is the grain's read rate in file frames per output frame, block_align is the frame size in the play_buff
+//
+uint32_t time_stretch_lookahead(float rate, uint8_t block_align)
+{
+	return ((uint32_t)((float)(2 * TS_HOP_FRAMES) * rate) + TS_SEEK_FRAMES + TS_CORR_FRAMES + 2) * block_align;
+}
+
+//Moves addr by frames (which may be negative) in the direction of playback, wrapping around the buffer
+static inline uint32_t offset_frame_addr(CircularBuffer *b, uint32_t addr, int32_t frames, uint8_t block_align, uint8_t rev)
+{
+	uint32_t bytes;
+
+	if (rev) frames = -frames;
+
+	if (frames >= 0)
+	{
+		bytes = frames * block_align;
+		if ((b->max - addr) <= bytes)	addr -= b->size - bytes;
+		else							addr += bytes;
+	}
+	else
+	{
+		bytes = (-frames) * block_align;
+		if ((addr - b->min) < bytes)	addr += b->size - bytes;
+		else							addr -= bytes;
+	}
+	return addr;
+}
+
+//Reads one frame (L, R) with linear interpolation towards the next frame in the direction of playback
+static inline void read_grain_frame(CircularBuffer *b, uint32_t addr, uint32_t frac, uint8_t block_align, uint8_t rev, int32_t *L, int32_t *R)
+{
+	uint32_t next_addr;
+	int32_t aL, aR, bL, bR;
+
+	next_addr = offset_frame_addr(b, addr, 1, block_align, rev);
+
+	while(SDRAM_IS_BUSY){;}
+	aL = *((int16_t *)addr);
+	bL = *((int16_t *)next_addr);
+
+	//frac is reduced to Q15 so the product fits in 32 bits
+	*L = aL + (((bL - aL) * (int32_t)(frac >> 1)) >> 15);
+
+	if (block_align == 4)
+	{
+		aR = *((int16_t *)(addr+2));
+		bR = *((int16_t *)(next_addr+2));
+		*R = aR + (((bR - aR) * (int32_t)(frac >> 1)) >> 15);
+	}
+	else
+		*R = *L;
+}
+
+//Mono version of one frame (average of L+R for stereo files), without interpolation. Used for matching grains.
+static inline int16_t read_match_frame(uint32_t addr, uint8_t block_align)
+{
+	while(SDRAM_IS_BUSY){;}
+	if (block_align == 4)	return (*((int16_t *)addr) + *((int16_t *)(addr+2))) >> 1;
+	else					return *((int16_t *)addr);
+}
+
+//
+// Score of a grain starting at win[0], compared to ref[]:
+// cross-correlation normalized by the candidate's energy (sign preserved), so loud candidates aren't favored
+//
+static float match_score(const int16_t *ref, const int16_t *win)
+{
+	uint32_t j;
+	int32_t corr = 0;
+	int32_t energy = 1;
+
+	for (j=0; j<TS_CORR_POINTS; j++)
+	{
+		corr 	+= (ref[j] * win[j * TS_CORR_DECIMATE]) >> 8;
+		energy 	+= (win[j * TS_CORR_DECIMATE] * win[j * TS_CORR_DECIMATE]) >> 8;
+	}
+
+	return ((float)corr * (float)(corr < 0 ? -corr : corr)) / (float)energy;
+}
+
+//
+// Returns the play_buff address where the next grain should start:
+// near play_buff->out, where it best continues the grain that's about to fade out (ts->old_addr)
+//
+static uint32_t find_grain_start(TimeStretchState *ts, CircularBuffer *buf, uint8_t block_align, uint8_t rev)
+{
+	int16_t ref[TS_CORR_POINTS];
+	int16_t win[TS_SEEK_WIN_FRAMES];
+	uint32_t addr, j;
+	int32_t d, d_min, d_best, d_coarse;
+	float score, best_score;
+
+	for (j=0; j<TS_CORR_POINTS; j++)
+		ref[j] = read_match_frame(offset_frame_addr(buf, ts->old_addr, j * TS_CORR_DECIMATE, block_align, rev), block_align);
+
+	//win[i] is the frame at (i - TS_SEEK_FRAMES) from play_buff->out
+	addr = offset_frame_addr(buf, buf->out, -TS_SEEK_FRAMES, block_align, rev);
+	for (j=0; j<TS_SEEK_WIN_FRAMES; j++)
+	{
+		win[j] = read_match_frame(addr, block_align);
+		addr = offset_frame_addr(buf, addr, 1, block_align, rev);
+	}
+
+	d_min = -(int32_t)ts->seek_back_limit;
+
+	//Coarse search
+	d_best = 0;
+	best_score = match_score(ref, &win[TS_SEEK_FRAMES]);
+	for (d = -TS_SEEK_FRAMES; d <= TS_SEEK_FRAMES; d += TS_SEEK_STEP)
+	{
+		if (d < d_min || d == 0) continue;
+
+		score = match_score(ref, &win[TS_SEEK_FRAMES + d]);
+		if (score > best_score) {best_score = score; d_best = d;}
+	}
+
+	//Fine search around the best coarse candidate
+	d_coarse = d_best;
+	for (d = d_coarse - TS_SEEK_STEP + 1; d < d_coarse + TS_SEEK_STEP; d++)
+	{
+		if (d < d_min || d > TS_SEEK_FRAMES || d == d_coarse) continue;
+
+		score = match_score(ref, &win[TS_SEEK_FRAMES + d]);
+		if (score > best_score) {best_score = score; d_best = d;}
+	}
+
+	return offset_frame_addr(buf, buf->out, d_best, block_align, rev);
+}
+
+//
+// Fills len frames of outL (and outR if stereo_out) with time-stretched audio, and moves the speed pointer (buf->out)
+// speed: file frames the speed pointer moves per output frame (the resample rate rs, as used when not time-stretching)
+// rate: file frames the grains read per output frame (file sample rate / codec sample rate)
+// block_align: frame size in the play_buff (2 = mono, 4 = stereo)
+//
+void time_stretch_read(TimeStretchState *ts, CircularBuffer *buf, float speed, float rate, uint8_t block_align, uint8_t rev, uint8_t stereo_out, int32_t *outL, int32_t *outR, uint32_t len)
+{
+	uint32_t i;
+	uint32_t rate_q16, whole;
+	int32_t oL, oR, nL, nR;
+	int32_t w_in, w_out;
+
+	rate_q16 = (uint32_t)(rate * 65536.0f);
+
+	for (i=0; i<len; i++)
+	{
+		read_grain_frame(buf, ts->old_addr, ts->pos_frac, block_align, rev, &oL, &oR);
+		read_grain_frame(buf, ts->new_addr, ts->pos_frac, block_align, rev, &nL, &nR);
+
+		w_in = ts_fade_lut[ts->hop_ctr];
+		w_out = 32768 - w_in;
+
+		if (stereo_out)
+		{
+			outL[i] = (oL * w_out + nL * w_in) >> 15;
+			outR[i] = (oR * w_out + nR * w_in) >> 15;
+		}
+		else
+			outL[i] = (((oL + oR) >> 1) * w_out + ((nL + nR) >> 1) * w_in) >> 15;
+
+		ts->pos_frac += rate_q16;
+		if (ts->pos_frac >= 65536)
+		{
+			whole = ts->pos_frac >> 16;
+			ts->old_addr = offset_frame_addr(buf, ts->old_addr, whole, block_align, rev);
+			ts->new_addr = offset_frame_addr(buf, ts->new_addr, whole, block_align, rev);
+			ts->pos_frac &= 0xFFFF;
+		}
+
+		if (++ts->hop_ctr >= TS_HOP_FRAMES)
+		{
+			ts->hop_ctr = 0;
+			ts->old_addr = ts->new_addr;
+			ts->new_addr = find_grain_start(ts, buf, block_align, rev);
+		}
+	}
+
+	//Move the speed pointer
+	ts->out_frac += speed * (float)len;
+	whole = (uint32_t)ts->out_frac;
+	ts->out_frac -= (float)whole;
+
+	if (whole)
+	{
+		CB_offset_out_address(buf, whole * block_align, rev);
+
+		if (ts->seek_back_limit < TS_SEEK_FRAMES)
+			ts->seek_back_limit = (whole >= TS_SEEK_FRAMES - ts->seek_back_limit) ? TS_SEEK_FRAMES : ts->seek_back_limit + whole;
+	}
+}
+
+
+#ifdef BENCHMARK_AUDIO_KERNELS
+
+uint32_t time_stretch_cycles_avg;
+uint32_t time_stretch_cycles_max;
+
+//
+// Measures the cycles per block of time_stretch_read() on a stereo file at half speed, with the DWT cycle counter.
+// The blocks where a new grain starts (and the search runs) are the most expensive, so the max is reported as well as the average.
+// Results are sent on ITM port 0 (average, then max)
+//
+void benchmark_time_stretch(void)
+{
+	static int32_t outL[HT16_CHAN_BUFF_LEN];
+	static int32_t outR[HT16_CHAN_BUFF_LEN];
+	CircularBuffer buf;
+	TimeStretchState ts;
+	uint32_t rep, start, cycles, total = 0;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	buf.min = PLAY_BUFF_START;
+	buf.max = PLAY_BUFF_START + PLAY_BUFF_SLOT_SIZE;
+	buf.size = PLAY_BUFF_SLOT_SIZE;
+	buf.in = buf.min;
+	buf.out = buf.min;
+	buf.wrapping = 0;
+
+	reset_time_stretch(&ts, &buf);
+	time_stretch_cycles_max = 0;
+
+	for (rep=0; rep<BENCHMARK_REPS; rep++)
+	{
+		start = DWT->CYCCNT;
+		time_stretch_read(&ts, &buf, 0.5f, 1.0f, 4, 0, 1, outL, outR, HT16_CHAN_BUFF_LEN);
+		cycles = DWT->CYCCNT - start;
+
+		total += cycles;
+		if (cycles > time_stretch_cycles_max) time_stretch_cycles_max = cycles;
+	}
+	time_stretch_cycles_avg = total / BENCHMARK_REPS;
+
+	ITM_SendValue(0, time_stretch_cycles_avg);
+	ITM_SendValue(0, time_stretch_cycles_max);
+}
+#endif
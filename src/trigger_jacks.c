@@ -12,13 +12,15 @@
 #include "params.h"
 #include "adc.h"
 #include "sampler.h"
+#include "event_queue.h"
+#include "profiler.h"
 
 enum TriggerStates 			jack_state[NUM_TRIG_JACKS];
 extern uint8_t 				flags[NUM_FLAGS];
-extern uint32_t 			play_trig_timestamp[2];
+extern uint32_t 			play_trig_timestamp[NUM_PLAY_CHAN];
 
-extern uint32_t				voct_latch_value[2];
-extern int16_t				bracketed_cvadc[NUM_CV_ADCS];
+extern uint32_t				voct_latch_value[NUM_PLAY_CHAN];
+extern volatile int32_t		pitch_cv_now[NUM_PLAY_CHAN];
 enum PlayStates 			play_state[NUM_PLAY_CHAN];
 
 volatile uint32_t 			sys_tmr;
@@ -33,7 +35,7 @@ void Trigger_Jack_Debounce_IRQHandler(void)
 
 
 	if (TIM_GetITStatus(TrigJack_TIM, TIM_IT_Update) != RESET) {
-		
+		PROFILE_START(PROF_TRIG_DEBOUNCE);
 
 		for (i=0;i<NUM_TRIG_JACKS;i++)
 		{
@@ -66,33 +68,29 @@ void Trigger_Jack_Debounce_IRQHandler(void)
 
 				switch (i)
 				{
-					case TrigJack_Play1: //we detect a trigger within 0.338ms after voltage appears on the jack
-						if (play_state[0] == PLAYING) 
-							play_state[0] = PLAY_FADEDOWN;
-
-						voct_latch_value[0]			= bracketed_cvadc[0];
+					//we detect a trigger within 0.338ms after voltage appears on the jack
+					//The sound keeps playing until the trigger delay is over: then it's handed off to a tail voice (see retrigger_playing_at())
+					case TrigJack_Play1:
+						voct_latch_value[0]			= pitch_cv_now[0];
 						flags[Play1TrigDelaying]	= 1;
 						play_trig_timestamp[0]		= sys_tmr;
 						break;
 					
 					case TrigJack_Play2:
 //						DEBUG3_ON;
-						if (play_state[1] == PLAYING) 
-							play_state[1] = PLAY_FADEDOWN;
-
-						voct_latch_value[1]			= bracketed_cvadc[1];
+						voct_latch_value[1]			= pitch_cv_now[1];
 						flags[Play2TrigDelaying]	= 1;
 						play_trig_timestamp[1]		= sys_tmr;
 						break;
 
 					case TrigJack_Rec:
-						flags[RecTrig]=1;
+						post_event(EV_REC_TRIG, 0);
 						break;
 					case TrigJack_Rev1:
-						flags[Rev1Trig]=1;
+						post_event(EV_REV_TRIG, 0);
 						break;
 					case TrigJack_Rev2:
-						flags[Rev2Trig]=1;
+						post_event(EV_REV_TRIG, 1);
 						break;
 				}
 
@@ -105,6 +103,8 @@ void Trigger_Jack_Debounce_IRQHandler(void)
 
 		process_cv_adc(); 
 
+		PROFILE_END(PROF_TRIG_DEBOUNCE);
+
 		// Clear TIM update interrupt
 		TIM_ClearITPendingBit(TrigJack_TIM, TIM_IT_Update);
 	}
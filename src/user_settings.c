@@ -43,122 +43,191 @@ void set_default_user_settings(void)
 	global_mode[STARTUPBANK_CH2] = 0;
 
 	global_mode[TRIG_DELAY] = 8;
+
+	global_mode[TIME_STRETCH] = 0;
+
+	global_mode[LOOP_CROSSFADE] = 2;
 }
 
 
-FRESULT save_user_settings(void)
+static FIL		settings_file;
+static uint8_t	settings_save_step = NUM_SETTINGS_ENUM;
+static FRESULT	settings_save_res;
+
+//
+// Opens the settings file. Each call to save_user_settings_step() then writes one block
+//
+void begin_save_user_settings(void)
+{
+	settings_save_step = NoSetting;
+	settings_save_res = FR_OK;
+}
+
+//
+// Writes the next block of the settings file
+// Returns 1 when the file is closed (or failed)
+//
+uint8_t save_user_settings_step(void)
 {
-	FRESULT 	res;
 	char		filepath[_MAX_LFN];
-	FIL			settings_file;
 
-	// Check sys_dir is ok
-	res = check_sys_dir();
-	if (res==FR_OK)
+	switch (settings_save_step)
 	{
-		// Create/overwrite the settings file
-		str_cat(filepath, SYS_DIR_SLASH, SETTINGS_FILE);
-		res = f_open(&settings_file, filepath, FA_CREATE_ALWAYS | FA_WRITE); 
-		if (res!=FR_OK) return(res);
+		case NoSetting:
+			// Check sys_dir is ok
+			settings_save_res = check_sys_dir();
+			if (settings_save_res!=FR_OK) break;
+
+			// Create/overwrite the settings file
+			str_cat(filepath, SYS_DIR_SLASH, SETTINGS_FILE);
+			settings_save_res = f_open(&settings_file, filepath, FA_CREATE_ALWAYS | FA_WRITE); 
+			if (settings_save_res!=FR_OK) break;
+
+			//Write the header
+			f_printf(&settings_file, "##\n");
+			f_printf(&settings_file, "## 4ms Stereo Triggered Sampler\n");
+			f_printf(&settings_file, "## Settings File\n");
+			f_printf(&settings_file, "## http://www.4mscompany.com/sts.php\n");
+			f_printf(&settings_file, "##\n");
+			f_printf(&settings_file, "## [STEREO MODE] can be \"stereo\" or \"mono\" (default)\n");
+			f_printf(&settings_file, "## [RECORD SAMPLE BITS] can be 24 or 16 (default)\n");
+			f_printf(&settings_file, "## [AUTO STOP ON SAMPLE CHANGE] can be \"No\", \"Looping Only\" or \"Yes\" (default)\n");
+			f_printf(&settings_file, "## [PLAY BUTTON STOPS WITH LENGTH AT FULL] can be \"No\" or \"Yes\" (default)\n");
+			f_printf(&settings_file, "## [QUANTIZE CHANNEL 1 1V/OCT JACK] can be \"Yes\" or \"No\" (default)\n");
+			f_printf(&settings_file, "## [QUANTIZE CHANNEL 2 1V/OCT JACK] can be \"Yes\" or \"No\" (default)\n");
+			f_printf(&settings_file, "## [SHORT SAMPLE PERCUSSIVE ENVELOPE] can be \"No\" or \"Yes\" (default)\n");
+			f_printf(&settings_file, "## [CROSSFADE SAMPLE END POINTS] can be \"No\" or \"Yes\" (default)\n");
+			f_printf(&settings_file, "## [STARTUP BANK CHANNEL 1] can be a number between 0 and 59 (default is 0, which is the White bank)\n");
+			f_printf(&settings_file, "## [STARTUP BANK CHANNEL 2] can be a number between 0 and 59 (default is 0, which is the White bank)\n");
+			f_printf(&settings_file, "## [TIME STRETCH] can be \"No\" (default) or \"Yes\". With Yes, Pitch changes the playback speed but not the pitch\n");
+			f_printf(&settings_file, "## [LOOP CROSSFADE] can be a number between 0 and 10: the crossfade in ms where a looping sample wraps around (default is 2)\n");
+			f_printf(&settings_file, "## [TRIG DELAY] can be a number between 1 and 10 which translates to a delay between 0.5ms and 20ms, respectively (default is 5)\n");
+			f_printf(&settings_file, "##\n");
+			f_printf(&settings_file, "## Deleting this file will restore default settings\n");
+			f_printf(&settings_file, "##\n\n");
+			break;
+
+		case StereoMode:
+			f_printf(&settings_file, "[STEREO MODE]\n");
+
+			if (global_mode[STEREO_MODE])
+				f_printf(&settings_file, "stereo\n\n");
+			else
+				f_printf(&settings_file, "mono\n\n");
+			break;
+
+		case RecordSampleBits:
+			f_printf(&settings_file, "[RECORD SAMPLE BITS]\n");
+
+			if (global_mode[REC_24BITS])
+				f_printf(&settings_file, "24\n\n");
+			else
+				f_printf(&settings_file, "16\n\n");
+			break;
+
+		case AutoStopSampleChange:
+			f_printf(&settings_file, "[AUTO STOP ON SAMPLE CHANGE]\n");
+
+			if (global_mode[AUTO_STOP_ON_SAMPLE_CHANGE]==AutoStop_ALWAYS)
+				f_printf(&settings_file, "Yes\n\n");
+			else
+			if (global_mode[AUTO_STOP_ON_SAMPLE_CHANGE]==AutoStop_OFF)
+				f_printf(&settings_file, "No\n\n");
+			else
+			if (global_mode[AUTO_STOP_ON_SAMPLE_CHANGE]==AutoStop_LOOPING)
+				f_printf(&settings_file, "Looping Only\n\n");
+			break;
+
+		case PlayStopsLengthFull:
+			f_printf(&settings_file, "[PLAY BUTTON STOPS WITH LENGTH AT FULL]\n");
+
+			if (global_mode[LENGTH_FULL_START_STOP])
+				f_printf(&settings_file, "Yes\n\n");
+			else
+				f_printf(&settings_file, "No\n\n");
+			break;
+
+		case QuantizeChannel1:
+			f_printf(&settings_file, "[QUANTIZE CHANNEL 1 1V/OCT JACK]\n");
+
+			if (global_mode[QUANTIZE_CH1])			f_printf(&settings_file, "Yes\n\n");
+			else									f_printf(&settings_file, "No\n\n");
+			break;
+
+		case QuantizeChannel2:
+			f_printf(&settings_file, "[QUANTIZE CHANNEL 2 1V/OCT JACK]\n");
+
+			if (global_mode[QUANTIZE_CH2])			f_printf(&settings_file, "Yes\n\n");
+			else									f_printf(&settings_file, "No\n\n");
+			break;
+
+		case PercEnvelope:
+			f_printf(&settings_file, "[SHORT SAMPLE PERCUSSIVE ENVELOPE]\n");
+
+			if (global_mode[PERC_ENVELOPE])			f_printf(&settings_file, "Yes\n\n");
+			else									f_printf(&settings_file, "No\n\n");
+			break;
+
+		case FadeEnvelope:
+			f_printf(&settings_file, "[CROSSFADE SAMPLE END POINTS]\n");
+
+			if (global_mode[FADEUPDOWN_ENVELOPE])	f_printf(&settings_file, "Yes\n\n");
+			else									f_printf(&settings_file, "No\n\n");
+			break;
+
+		case StartUpBank_ch1:
+			f_printf(&settings_file, "[STARTUP BANK CHANNEL 1]\n");
+			f_printf(&settings_file, "%d\n\n", global_mode[STARTUPBANK_CH1]);
+			break;
+
+		case StartUpBank_ch2:
+			f_printf(&settings_file, "[STARTUP BANK CHANNEL 2]\n");
+			f_printf(&settings_file, "%d\n\n", global_mode[STARTUPBANK_CH2]);
+			break;
+
+		case TimeStretch:
+			f_printf(&settings_file, "[TIME STRETCH]\n");
+
+			if (global_mode[TIME_STRETCH])			f_printf(&settings_file, "Yes\n\n");
+			else									f_printf(&settings_file, "No\n\n");
+			break;
+
+		case LoopCrossfade:
+			f_printf(&settings_file, "[LOOP CROSSFADE]\n");
+			f_printf(&settings_file, "%d\n\n", global_mode[LOOP_CROSSFADE]);
+			break;
+
+		case TrigDelay:
+			f_printf(&settings_file, "[TRIG DELAY]\n");
+			f_printf(&settings_file, "%d\n\n", global_mode[TRIG_DELAY]);
+
+			settings_save_res = f_close(&settings_file);
+			break;
+
+		default:
+			return(1);
+	}
 
-		//Write the header
-		f_printf(&settings_file, "##\n");
-		f_printf(&settings_file, "## 4ms Stereo Triggered Sampler\n");
-		f_printf(&settings_file, "## Settings File\n");
-		f_printf(&settings_file, "## http://www.4mscompany.com/sts.php\n");
-		f_printf(&settings_file, "##\n");
-		f_printf(&settings_file, "## [STEREO MODE] can be \"stereo\" or \"mono\" (default)\n");
-		f_printf(&settings_file, "## [RECORD SAMPLE BITS] can be 24 or 16 (default)\n");
-		f_printf(&settings_file, "## [AUTO STOP ON SAMPLE CHANGE] can be \"No\", \"Looping Only\" or \"Yes\" (default)\n");
-		f_printf(&settings_file, "## [PLAY BUTTON STOPS WITH LENGTH AT FULL] can be \"No\" or \"Yes\" (default)\n");
-		f_printf(&settings_file, "## [QUANTIZE CHANNEL 1 1V/OCT JACK] can be \"Yes\" or \"No\" (default)\n");
-		f_printf(&settings_file, "## [QUANTIZE CHANNEL 2 1V/OCT JACK] can be \"Yes\" or \"No\" (default)\n");
-		f_printf(&settings_file, "## [SHORT SAMPLE PERCUSSIVE ENVELOPE] can be \"No\" or \"Yes\" (default)\n");
-		f_printf(&settings_file, "## [CROSSFADE SAMPLE END POINTS] can be \"No\" or \"Yes\" (default)\n");
-		f_printf(&settings_file, "## [STARTUP BANK CHANNEL 1] can be a number between 0 and 59 (default is 0, which is the White bank)\n");
-		f_printf(&settings_file, "## [STARTUP BANK CHANNEL 2] can be a number between 0 and 59 (default is 0, which is the White bank)\n");
-		f_printf(&settings_file, "## [TRIG DELAY] can be a number between 1 and 10 which translates to a delay between 0.5ms and 20ms, respectively (default is 5)\n");
-		f_printf(&settings_file, "##\n");
-		f_printf(&settings_file, "## Deleting this file will restore default settings\n");
-		f_printf(&settings_file, "##\n\n");
-
-		// Write the stereo mode setting
-		f_printf(&settings_file, "[STEREO MODE]\n");
-
-		if (global_mode[STEREO_MODE])
-			f_printf(&settings_file, "stereo\n\n");
-		else
-			f_printf(&settings_file, "mono\n\n");
-
-		// Write the 24bit record mode setting
-		f_printf(&settings_file, "[RECORD SAMPLE BITS]\n");
-
-		if (global_mode[REC_24BITS])
-			f_printf(&settings_file, "24\n\n");
-		else
-			f_printf(&settings_file, "16\n\n");
-
-		// Write the Auto Stop on Sample Change mode setting
-		f_printf(&settings_file, "[AUTO STOP ON SAMPLE CHANGE]\n");
-
-		if (global_mode[AUTO_STOP_ON_SAMPLE_CHANGE]==AutoStop_ALWAYS)
-			f_printf(&settings_file, "Yes\n\n");
-		else
-		if (global_mode[AUTO_STOP_ON_SAMPLE_CHANGE]==AutoStop_OFF)
-			f_printf(&settings_file, "No\n\n");
-		else
-		if (global_mode[AUTO_STOP_ON_SAMPLE_CHANGE]==AutoStop_LOOPING)
-			f_printf(&settings_file, "Looping Only\n\n");
-
-		// Write the Auto Stop on Sample Change mode setting
-		f_printf(&settings_file, "[PLAY BUTTON STOPS WITH LENGTH AT FULL]\n");
-
-		if (global_mode[LENGTH_FULL_START_STOP])
-			f_printf(&settings_file, "Yes\n\n");
-		else
-			f_printf(&settings_file, "No\n\n");
-
-		// Write the Quantize Channel 1 setting
-		f_printf(&settings_file, "[QUANTIZE CHANNEL 1 1V/OCT JACK]\n");
-
-		if (global_mode[QUANTIZE_CH1])			f_printf(&settings_file, "Yes\n\n");
-		else									f_printf(&settings_file, "No\n\n");
-
-		// Write the Quantize Channel 2 setting
-		f_printf(&settings_file, "[QUANTIZE CHANNEL 2 1V/OCT JACK]\n");
-
-		if (global_mode[QUANTIZE_CH2])			f_printf(&settings_file, "Yes\n\n");
-		else									f_printf(&settings_file, "No\n\n");
-
-		// Write the Perc Envelope setting
-		f_printf(&settings_file, "[SHORT SAMPLE PERCUSSIVE ENVELOPE]\n");
-
-		if (global_mode[PERC_ENVELOPE])			f_printf(&settings_file, "Yes\n\n");
-		else									f_printf(&settings_file, "No\n\n");
-
-		// Write the Fade Up/Down Envelope setting
-		f_printf(&settings_file, "[CROSSFADE SAMPLE END POINTS]\n");
-
-		if (global_mode[FADEUPDOWN_ENVELOPE])	f_printf(&settings_file, "Yes\n\n");
-		else									f_printf(&settings_file, "No\n\n");
-
-		// Write the Channel 1 startup bank setting
-		f_printf(&settings_file, "[STARTUP BANK CHANNEL 1]\n");
-		f_printf(&settings_file, "%d\n\n", global_mode[STARTUPBANK_CH1]);
-
-		// Write the Channel 2 startup bank setting
-		f_printf(&settings_file, "[STARTUP BANK CHANNEL 2]\n");
-		f_printf(&settings_file, "%d\n\n", global_mode[STARTUPBANK_CH2]);
-
-		// Write the Trig Delay setting
-		f_printf(&settings_file, "[TRIG DELAY]\n");
-		f_printf(&settings_file, "%d\n\n", global_mode[TRIG_DELAY]);
+	if (settings_save_res!=FR_OK)
+		settings_save_step = NUM_SETTINGS_ENUM;
+	else
+		settings_save_step++;
 
+	return (settings_save_step >= NUM_SETTINGS_ENUM);
+}
 
-		res = f_close(&settings_file);
-	}
+FRESULT save_user_settings_result(void)
+{
+	return (settings_save_res);
+}
 
-	return (res);
+FRESULT save_user_settings(void)
+{
+	begin_save_user_settings();
+
+	while (!save_user_settings_step()) {;}
+
+	return (settings_save_res);
 }
 
 
@@ -251,6 +320,16 @@ FRESULT read_user_settings(void)
 					cur_setting_found = StartUpBank_ch2; //Fade up/dpwn envelope
 					continue;
 				}	
+				if (str_startswith_nocase(read_buffer, "[TIME STRETCH"))
+				{
+					cur_setting_found = TimeStretch; //Pitch changes speed only
+					continue;
+				}
+				if (str_startswith_nocase(read_buffer, "[LOOP CROSSFADE"))
+				{
+					cur_setting_found = LoopCrossfade; //Crossfade where a loop wraps around
+					continue;
+				}
 				if (str_startswith_nocase(read_buffer, "[TRIG DELAY"))
 				{
 					cur_setting_found = TrigDelay; //Trigger delay for play trig
@@ -357,6 +436,24 @@ FRESULT read_user_settings(void)
 
 				cur_setting_found = NoSetting; //back to looking for headers
 			}
+			if (cur_setting_found==TimeStretch)
+			{
+				if (str_startswith_nocase(read_buffer, "Yes"))
+					global_mode[TIME_STRETCH] = 1;
+				else
+					global_mode[TIME_STRETCH] = 0;
+
+				cur_setting_found = NoSetting; //back to looking for headers
+			}
+
+			if (cur_setting_found==LoopCrossfade)
+			{
+				global_mode[LOOP_CROSSFADE] = str_xt_int(read_buffer);
+				if (global_mode[LOOP_CROSSFADE] > 10) global_mode[LOOP_CROSSFADE] = 2;
+
+				cur_setting_found = NoSetting; //back to looking for headers
+			}
+
 			if (cur_setting_found==TrigDelay)
 			{
 				global_mode[TRIG_DELAY] = str_xt_int(read_buffer);
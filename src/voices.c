@@ -0,0 +1,262 @@
+/*
+ * voices.c
+ *
+ * Tail voices for crossfaded re-triggers
+ *
+ * start_tail_voice() is called from retrigger_playing() and retrigger_playing_at() (main loop) just before the new sound starts.
+ * It copies the channel's play_buff, position and resample rate into a free tail voice.
+ * The tail then reads the data that's already in the SDRAM buffer (it never reads the SD Card),
+ * and fades out over TAIL_FADE_FRAMES, or less if there isn't that much buffered ahead.
+ * If the new sound has to be buffered from scratch in the same slot, begin_playing() starts it past the tail's data
+ * (tail_safe_buff_start()), so the tail keeps fading while the new sound pre-buffers.
+ *
+ * mix_tail_voices() is called at the end of play_audio_from_buffer() and adds the channel's tails to its output.
+ *
+ */
+
+#include "globals.h"
+#include "params.h"
+#include "sampler.h"
+#include "sdram_driver.h"
+#include "circular_buffer.h"
+#include "voices.h"
+#include "sdcard_speed.h"
+
+extern uint8_t 			global_mode[NUM_GLOBAL_MODES];
+extern float 			f_param[NUM_PLAY_CHAN][NUM_F_PARAMS];
+extern uint8_t			i_param[NUM_ALL_CHAN][NUM_I_PARAMS];
+
+extern enum PlayStates 	play_state[NUM_PLAY_CHAN];
+extern CircularBuffer* 	play_buff[NUM_PLAY_CHAN][NUM_SAMPLES_PER_BANK];
+extern uint8_t 			sample_num_now_playing[NUM_PLAY_CHAN];
+extern uint8_t 			sample_bank_now_playing[NUM_PLAY_CHAN];
+extern Sample 			samples[MAX_NUM_BANKS][NUM_SAMPLES_PER_BANK];
+extern SdCardSpeed 		sdcard_speed;
+
+static TailVoice 		tails[NUM_TAIL_VOICES];
+
+static inline int32_t _SSAT16(int32_t x);
+static inline int32_t _SSAT16(int32_t x) {asm("ssat %[dst], #16, %[src]" : [dst] "=r" (x) : [src] "r" (x)); return x;}
+
+
+static float active_tail_cost(void)
+{
+	uint8_t i;
+	float cost = 0;
+
+	for (i=0; i<NUM_TAIL_VOICES; i++)
+		if (tails[i].active) cost += tails[i].cost;
+
+	return cost;
+}
+
+//
+// Returns a free tail voice, stealing the most expensive ones if needed to stay under TAIL_COST_BUDGET
+// Returns 0 if the new voice alone is over the budget
+//
+static TailVoice *alloc_tail_voice(float cost)
+{
+	uint8_t i;
+	TailVoice *t, *victim;
+
+	if (cost > TAIL_COST_BUDGET) return 0;
+
+	while (1)
+	{
+		t = 0;
+		victim = 0;
+		for (i=0; i<NUM_TAIL_VOICES; i++)
+		{
+			if (!tails[i].active) 									{if (!t) t = &tails[i];}
+			else if (!victim || tails[i].cost > victim->cost) 		victim = &tails[i];
+		}
+
+		if (t && (active_tail_cost() + cost) <= TAIL_COST_BUDGET) return t;
+
+		victim->active = 0;
+	}
+}
+
+//
+// Hands off what's playing on chan to a tail voice, which fades out from the given gain
+// The caller must start_playing() right after. Returns 0 if no tail voice could be started.
+//
+uint8_t start_tail_voice(uint8_t chan, float gain)
+{
+	TailVoice 	*t;
+	Sample 		*s_sample;
+	uint8_t 	samplenum;
+	uint8_t 	block_align;
+	float 		rs;
+	float 		cost;
+	uint32_t 	frames;
+	uint32_t 	blocks;
+
+	samplenum 	= sample_num_now_playing[chan];
+	s_sample 	= &samples[ sample_bank_now_playing[chan] ][samplenum];
+
+	//Same resampling rate and buffer format as play_audio_from_buffer()
+	rs = f_param[chan][PITCH] * ((float)s_sample->sampleRate / f_BASE_SAMPLE_RATE);
+	if (rs > sdcard_speed.max_rs) rs = sdcard_speed.max_rs;
+	block_align = (s_sample->numChannels == 2) ? 4 : 2;
+
+	cost = rs * block_align;
+
+	__disable_irq();
+
+	//Only play what's already buffered ahead. This is checked before a voice is allocated,
+	//so a tail that's too short to start doesn't steal another tail's voice
+	frames 			= CB_distance(play_buff[chan][samplenum], i_param[chan][REV]) / block_align;
+	frames 			= (uint32_t)((float)frames / rs);
+	blocks 			= frames / HT16_CHAN_BUFF_LEN;
+	if (blocks > TAIL_FADE_BLOCKS) blocks = TAIL_FADE_BLOCKS;
+	if (blocks < 2) {__enable_irq(); return 0;}
+
+	t = alloc_tail_voice(cost);
+	if (!t) {__enable_irq(); return 0;}
+
+	t->buf 			= *play_buff[chan][samplenum];
+	t->rev 			= i_param[chan][REV];
+	t->blocks_left 	= blocks;
+	t->chan 		= chan;
+	t->block_align 	= block_align;
+	t->pos_frac 	= 0;
+	t->rs_q16 		= (uint32_t)(rs * 65536.0f);
+	t->gain 		= (int32_t)(gain * 65536.0f);
+	t->gain_dec 	= t->gain / (t->blocks_left * HT16_CHAN_BUFF_LEN);
+	t->cost 		= cost;
+	t->active 		= 1;
+
+	//Silence the channel until start_playing() sets its new state, so the tail and the channel don't both play the old sound
+	play_state[chan] = SILENT;
+
+	__enable_irq();
+
+	return 1;
+}
+
+//
+// Returns the address where a voice that buffers play_buff[chan][samplenum] from scratch should start,
+// so the data it writes (forwards, or backwards if rev) never overwrites what a tail voice on that slot still reads.
+// A voice reads ahead by less than the play_buff size, so it never wraps around to the tails' data.
+// Returns the slot's min if no tail reads from it
+//
+uint32_t tail_safe_buff_start(uint8_t chan, uint8_t samplenum, uint8_t rev)
+{
+	CircularBuffer 	*b = play_buff[chan][samplenum];
+	TailVoice 		*t;
+	uint8_t 		i, found;
+	uint32_t 		ref, span;
+	int32_t 		d, lo, hi, pos;
+	int32_t 		half = b->size / 2;
+
+	found = 0;
+	ref = b->min;
+	lo = 0;
+	hi = 0;
+
+	for (i=0; i<NUM_TAIL_VOICES; i++)
+	{
+		t = &tails[i];
+		if (!t->active || t->chan != chan || t->buf.min != b->min) continue;
+
+		if (!found) {ref = t->buf.out; found = 1;}
+
+		//Signed distance from the first tail's position: the tails on one slot are all close together
+		d = (int32_t)(t->buf.out - ref);
+		if (d > half) 			d -= b->size;
+		else if (d <= -half) 	d += b->size;
+
+		//Bytes the tail still reads, in either direction, plus the interpolation frame and alignment
+		span = ((((uint32_t)t->blocks_left * HT16_CHAN_BUFF_LEN * t->rs_q16) >> 16) + 4) * t->block_align;
+
+		if ((d + (int32_t)span) > hi) hi = d + span;
+		if ((d - (int32_t)span) < lo) lo = d - span;
+	}
+
+	if (!found) return b->min;
+
+	pos = (int32_t)(ref - b->min) + (rev ? lo : hi);
+	if (pos < 0) 					pos += b->size;
+	else if (pos >= (int32_t)b->size) pos -= b->size;
+
+	//Keep stereo frames aligned
+	return b->min + (pos & ~3);
+}
+
+static inline uint32_t next_frame_addr(CircularBuffer *b, uint32_t addr, uint8_t block_align, uint8_t rev)
+{
+	if (!rev)	{addr += block_align; if (addr >= b->max) addr -= b->size;}
+	else		{if ((addr - b->min) < block_align) addr += b->size - block_align; else addr -= block_align;}
+	return addr;
+}
+
+//
+// Reads one block from the tail voice with linear interpolation, and adds it to outL/outR with the fade-out gain
+// (A tail is only heard for a few ms while fading out, so linear interpolation is plenty)
+//
+static void mix_tail_voice(TailVoice *t, int32_t *outL, int32_t *outR)
+{
+	uint16_t i;
+	uint32_t a_addr, b_addr;
+	int32_t aL, aR, bL, bR;
+	int32_t sL, sR;
+	uint8_t stereo_out = global_mode[STEREO_MODE];
+
+	for (i=0; i<HT16_CHAN_BUFF_LEN; i++)
+	{
+		a_addr = t->buf.out;
+		b_addr = next_frame_addr(&t->buf, a_addr, t->block_align, t->rev);
+
+		while(SDRAM_IS_BUSY){;}
+		aL = *((int16_t *)a_addr);
+		bL = *((int16_t *)b_addr);
+
+		if (t->block_align == 4)
+		{
+			aR = *((int16_t *)(a_addr+2));
+			bR = *((int16_t *)(b_addr+2));
+		} else {
+			aR = aL;
+			bR = bL;
+		}
+
+		//pos_frac is reduced to Q15 so the product fits in 32 bits: (bL-aL) can span 17 bits
+		sL = aL + (((bL - aL) * (int32_t)(t->pos_frac >> 1)) >> 15);
+		sR = aR + (((bR - aR) * (int32_t)(t->pos_frac >> 1)) >> 15);
+
+		if (stereo_out)
+		{
+			outL[i] = _SSAT16(outL[i] + ((sL * (t->gain>>4)) >> 12));
+			outR[i] = _SSAT16(outR[i] + ((sR * (t->gain>>4)) >> 12));
+		}
+		else
+			outL[i] = _SSAT16(outL[i] + ((((sL + sR)>>1) * (t->gain>>4)) >> 12));
+
+		t->gain -= t->gain_dec;
+		if (t->gain < 0) t->gain = 0;
+
+		t->pos_frac += t->rs_q16;
+		if (t->pos_frac >= 65536)
+		{
+			CB_offset_out_address(&t->buf, (t->pos_frac >> 16) * t->block_align, t->rev);
+			t->pos_frac &= 0xFFFF;
+		}
+	}
+}
+
+void mix_tail_voices(uint8_t chan, int32_t *outL, int32_t *outR)
+{
+	uint8_t i;
+
+	for (i=0; i<NUM_TAIL_VOICES; i++)
+	{
+		if (tails[i].active && tails[i].chan == chan)
+		{
+			mix_tail_voice(&tails[i], outL, outR);
+
+			if (!(--tails[i].blocks_left))
+				tails[i].active = 0;
+		}
+	}
+}
@@ -16,6 +16,8 @@
 #include "bank.h"
 #include "calibration.h"
 #include "sts_fs_index.h"
+#include "sts_fs_catalog.h"
+#include "event_queue.h"
 
 extern volatile uint32_t 		sys_tmr;
 extern enum g_Errors 			g_error;
@@ -103,6 +105,7 @@ void toggle_recording(void)
 	{
 		if (global_mode[ENABLE_RECORDING])
 		{
+			claim_rec_buff();
 			CB_init(rec_buff, 0);
 WATCH_REC_BUFF_IN = rec_buff->in;
 WATCH_REC_BUFF_OUT = rec_buff->out;
@@ -623,6 +626,8 @@ WATCH_REC_BUFF_OUT = rec_buff->out;
 				samples[sample_bank_now_recording][sample_num_now_recording].startOfData = 44;
 				samples[sample_bank_now_recording][sample_num_now_recording].PCM = 1;
 				samples[sample_bank_now_recording][sample_num_now_recording].file_found = 1;
+				samples[sample_bank_now_recording][sample_num_now_recording].file_datetime = 0;
+				samples[sample_bank_now_recording][sample_num_now_recording].hdr_verified = 1;
 
 				samples[sample_bank_now_recording][sample_num_now_recording].inst_start = 0;
 				samples[sample_bank_now_recording][sample_num_now_recording].inst_end = samplebytes_recorded;
@@ -631,11 +636,14 @@ WATCH_REC_BUFF_OUT = rec_buff->out;
 
 				enable_bank(sample_bank_now_recording);
 
+				//New file on the card: rebuild the catalog used by assignment mode
+				invalidate_sample_catalog();
+
 				sample_fname_now_recording[0] = 0;
 				sample_num_now_recording = 0xFF;
 				sample_bank_now_recording = 0xFF;
-				flags[ForceFileReload1] = 1;
-				flags[ForceFileReload2] = 1;
+				post_event(EV_FORCE_RELOAD, 0);
+				post_event(EV_FORCE_RELOAD, 1);
 
 				if (rec_state == CLOSING_FILE)
 					rec_state = REC_OFF;